@@ -0,0 +1,207 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/benchmarks/AsyncLoggerBenchmark.cpp
+// DESCRIPTION: Débit du logger asynchrone (messages/s) selon le nombre de
+//              threads producteurs, file sans verrou contre file à mutex, et
+//              coût côté appelant du format différé.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#include "Benchmark.h"
+#include <Logger/RingBuffer.h>
+#include <Logger/Sinks/AsyncSink.h>
+#include <Logger/Sinks/NullSink.h>
+#include <atomic>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace nkentseu;
+using namespace nkentseu::logger;
+using namespace nkentseu::logger::bench;
+
+namespace {
+
+    /// Nombre de threads producteurs testés
+    const uint32 PRODUCER_COUNTS[] = { 1, 2, 4, 8, 16 };
+
+    /// Messages produits au total pour chaque mesure
+    const uint64 TOTAL_MESSAGES = 1 << 20;
+
+    /// Capacité de la file
+    const size_t QUEUE_CAPACITY = 8192;
+
+    // -------------------------------------------------------------------------
+    // File de référence: std::queue protégée par un mutex (ancien backend)
+    // -------------------------------------------------------------------------
+    class MutexQueue {
+        public:
+            bool TryPush(LogMessage&& message) {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                if (m_Queue.size() >= QUEUE_CAPACITY) return false;
+                m_Queue.push(std::move(message));
+                return true;
+            }
+
+            template <typename Handler>
+            size_t PopBatch(Handler&& handler, size_t maxCount) {
+                size_t count = 0;
+                std::unique_lock<std::mutex> lock(m_Mutex);
+                while (count < maxCount && !m_Queue.empty()) {
+                    LogMessage message = std::move(m_Queue.front());
+                    m_Queue.pop();
+                    lock.unlock();
+                    handler(message);
+                    ++count;
+                    lock.lock();
+                }
+                return count;
+            }
+
+        private:
+            std::mutex m_Mutex;
+            std::queue<LogMessage> m_Queue;
+    };
+
+    /**
+     * @brief Mesure le débit producteurs -> consommateur unique sur une file
+     * @return Messages par seconde
+     */
+    template <typename Queue>
+    double MeasureQueue(Queue& queue, uint32 producers) {
+        const uint64 perProducer = TOTAL_MESSAGES / producers;
+        const uint64 expected = perProducer * producers;
+
+        std::atomic<bool> go(false);
+        std::atomic<uint64> consumed(0);
+
+        std::thread consumer([&] {
+            while (consumed.load(std::memory_order_relaxed) < expected) {
+                size_t count = queue.PopBatch([](LogMessage& message) {
+                    DoNotOptimize(message.sourceLine);
+                }, 256);
+                if (count == 0) std::this_thread::yield();
+                consumed.fetch_add(count, std::memory_order_relaxed);
+            }
+        });
+
+        std::vector<std::thread> threads;
+        for (uint32 t = 0; t < producers; ++t) {
+            threads.emplace_back([&, t] {
+                while (!go.load()) std::this_thread::yield();
+                for (uint64 i = 0; i < perProducer; ++i) {
+                    LogMessage message;
+                    message.sourceLine = static_cast<uint32>(i);
+                    message.threadId = t;
+                    while (!queue.TryPush(std::move(message))) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        Stopwatch watch;
+        go = true;
+        for (auto& thread : threads) thread.join();
+        consumer.join();
+
+        return static_cast<double>(expected) / watch.ElapsedSeconds();
+    }
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+// File brute: MPSCRingBuffer contre std::queue + mutex
+// -----------------------------------------------------------------------------
+BENCHMARK_CASE(AsyncQueue_Throughput) {
+    char label[64];
+
+    for (uint32 producers : PRODUCER_COUNTS) {
+        MutexQueue mutexQueue;
+        std::snprintf(label, sizeof(label), "mutex queue, %2u producer(s)", producers);
+        Report(label, MeasureQueue(mutexQueue, producers) / 1e6, "M msg/s");
+
+        MPSCRingBuffer<LogMessage> ringBuffer(QUEUE_CAPACITY);
+        std::snprintf(label, sizeof(label), "MPSC ring buffer, %2u producer(s)", producers);
+        Report(label, MeasureQueue(ringBuffer, producers) / 1e6, "M msg/s");
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Bout en bout: AsyncLogger::Log avec un NullSink
+// -----------------------------------------------------------------------------
+BENCHMARK_CASE(AsyncLogger_Throughput) {
+    char label[64];
+    const std::string text = "Player moved to (128.5, 64.25)";
+
+    for (uint32 producers : PRODUCER_COUNTS) {
+        AsyncLogger logger("bench", QUEUE_CAPACITY);
+        logger.AddSink(std::make_shared<NullSink>());
+        logger.SetLevel(LogLevel::Trace);
+        logger.SetOverflowPolicy(OverflowPolicy::Block);
+        logger.SetBlockTimeout(1000);
+        logger.Start();
+
+        const uint64 perProducer = TOTAL_MESSAGES / producers;
+        std::vector<std::thread> threads;
+
+        Stopwatch watch;
+        for (uint32 t = 0; t < producers; ++t) {
+            threads.emplace_back([&] {
+                for (uint64 i = 0; i < perProducer; ++i) {
+                    logger.Log(LogLevel::Info, text);
+                }
+            });
+        }
+        for (auto& thread : threads) thread.join();
+        logger.Stop();
+
+        const double seconds = watch.ElapsedSeconds();
+        const uint64 delivered = perProducer * producers - logger.GetOverflowStats().GetTotalLost();
+
+        std::snprintf(label, sizeof(label), "AsyncLogger, %2u producer(s)", producers);
+        Report(label, static_cast<double>(delivered) / seconds / 1e6, "M msg/s");
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Coût côté appelant: formatage immédiat (vsnprintf) contre format différé.
+// Le logger n'est pas démarré pendant la mesure: seule la mise en file est
+// chronométrée, le formatage est mesuré ensuite lors du vidage.
+// -----------------------------------------------------------------------------
+BENCHMARK_CASE(AsyncLogger_DeferredFormat) {
+    const uint32 messageCount = 1 << 15;
+    const char* const stage = "shadow-pass";
+
+    for (int deferredFormat = 0; deferredFormat < 2; ++deferredFormat) {
+        AsyncLogger logger("bench", messageCount);
+        logger.AddSink(std::make_shared<NullSink>());
+        logger.SetLevel(LogLevel::Trace);
+
+        Stopwatch watch;
+        for (uint32 i = 0; i < messageCount; ++i) {
+            const double x = i * 0.5, y = i * 0.25, ms = 16.0 + i * 1e-4;
+            if (deferredFormat) {
+                logger.LogDeferred(LogLevel::Info, __FILE__, __LINE__, __FUNCTION__,
+                                   "frame %u: %s at (%.2f, %.2f) took %.3f ms", i, stage, x, y, ms);
+            } else {
+                logger.Log(LogLevel::Info, __FILE__, __LINE__, __FUNCTION__,
+                           "frame %u: %s at (%.2f, %.2f) took %.3f ms", i, stage, x, y, ms);
+            }
+        }
+        const double callerSeconds = watch.ElapsedSeconds();
+
+        watch.Restart();
+        logger.Flush();
+        const double drainSeconds = watch.ElapsedSeconds();
+
+        const char* name = deferredFormat ? "deferred" : "eager   ";
+        char label[64];
+        std::snprintf(label, sizeof(label), "%s, caller side", name);
+        Report(label, callerSeconds * 1e9 / messageCount, "ns/msg");
+        std::snprintf(label, sizeof(label), "%s, worker side", name);
+        Report(label, drainSeconds * 1e9 / messageCount, "ns/msg");
+    }
+}
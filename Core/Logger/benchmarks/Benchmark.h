@@ -0,0 +1,109 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/benchmarks/Benchmark.h
+// DESCRIPTION: Mini-framework de benchmarks pour le module Logger.
+//              Enregistrement automatique des cas et affichage des résultats.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Nkentseu/Types.h>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger::bench
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+        namespace bench {
+
+            // ---------------------------------------------------------------------
+            // STRUCTURE: BenchmarkCase
+            // DESCRIPTION: Cas de benchmark enregistré
+            // ---------------------------------------------------------------------
+            struct BenchmarkCase {
+                /// Nom du cas (utilisé pour le filtrage en ligne de commande)
+                const char* name;
+
+                /// Fonction exécutant le cas
+                void (*function)();
+            };
+
+            /**
+             * @brief Obtient la liste des cas enregistrés
+             * @return Référence sur la liste globale
+             */
+            inline std::vector<BenchmarkCase>& GetBenchmarks() {
+                static std::vector<BenchmarkCase> benchmarks;
+                return benchmarks;
+            }
+
+            // ---------------------------------------------------------------------
+            // STRUCTURE: BenchmarkRegistrar
+            // DESCRIPTION: Enregistre un cas lors de l'initialisation statique
+            // ---------------------------------------------------------------------
+            struct BenchmarkRegistrar {
+                BenchmarkRegistrar(const char* name, void (*function)()) {
+                    GetBenchmarks().push_back({ name, function });
+                }
+            };
+
+            // ---------------------------------------------------------------------
+            // CLASSE: Stopwatch
+            // DESCRIPTION: Chronomètre haute résolution
+            // ---------------------------------------------------------------------
+            class Stopwatch {
+                public:
+                    Stopwatch() : m_Start(std::chrono::steady_clock::now()) {}
+
+                    /// Redémarre le chronomètre
+                    void Restart() { m_Start = std::chrono::steady_clock::now(); }
+
+                    /// Temps écoulé en secondes
+                    double ElapsedSeconds() const {
+                        return std::chrono::duration<double>(std::chrono::steady_clock::now() - m_Start).count();
+                    }
+
+                private:
+                    std::chrono::steady_clock::time_point m_Start;
+            };
+
+            /**
+             * @brief Affiche une ligne de résultat
+             * @param name Nom de la mesure
+             * @param value Valeur mesurée
+             * @param unit Unité de la valeur
+             */
+            inline void Report(const char* name, double value, const char* unit) {
+                std::printf("  %-48s %14.2f %s\n", name, value, unit);
+            }
+
+            /**
+             * @brief Empêche le compilateur d'éliminer une valeur calculée
+             * @param value Valeur à conserver
+             */
+            template <typename T>
+            inline void DoNotOptimize(const T& value) {
+                #if defined(__GNUC__) || defined(__clang__)
+                    asm volatile("" : : "r,m"(value) : "memory");
+                #else
+                    static volatile const void* sink;
+                    sink = &value;
+                #endif
+            }
+
+        } // namespace bench
+    } // namespace logger
+} // namespace nkentseu
+
+// -----------------------------------------------------------------------------
+// MACRO D'ENREGISTREMENT
+// -----------------------------------------------------------------------------
+
+#define BENCHMARK_CASE(Name) \
+    static void Benchmark_##Name(); \
+    static nkentseu::logger::bench::BenchmarkRegistrar s_BenchmarkRegistrar_##Name(#Name, &Benchmark_##Name); \
+    static void Benchmark_##Name()
@@ -0,0 +1,67 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/benchmarks/ClockBenchmark.cpp
+// DESCRIPTION: Coût d'un horodatage (ns) pour chaque source de LogClock,
+//              comparé à l'ancien double appel de system_clock par message.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#include "Benchmark.h"
+#include <Logger/LogClock.h>
+#include <chrono>
+
+using namespace nkentseu;
+using namespace nkentseu::logger;
+using namespace nkentseu::logger::bench;
+
+namespace {
+
+    /// Horodatages par mesure
+    const uint64 STAMP_COUNT = 1 << 22;
+
+    /**
+     * @brief Mesure le coût moyen d'une fonction d'horodatage
+     * @return Nanosecondes par appel
+     */
+    template <typename Stamp>
+    double Measure(Stamp&& stamp) {
+        uint64 total = 0;
+        Stopwatch watch;
+        for (uint64 i = 0; i < STAMP_COUNT; ++i) {
+            total += stamp();
+        }
+        const double seconds = watch.ElapsedSeconds();
+
+        DoNotOptimize(total);
+        return seconds * 1e9 / static_cast<double>(STAMP_COUNT);
+    }
+
+    uint64 SystemClockNs() {
+        return static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+    }
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+// Coût par horodatage selon la source
+// -----------------------------------------------------------------------------
+BENCHMARK_CASE(LogClock_CostPerTimestamp) {
+    Report("system_clock x2 (ancien LogMessage)", Measure([] {
+        return SystemClockNs() + SystemClockNs();
+    }), "ns");
+
+    const ClockSource sources[] = { ClockSource::System, ClockSource::Monotonic, ClockSource::Tsc };
+    const char* labels[] = { "LogClock System", "LogClock Monotonic", "LogClock Tsc" };
+
+    for (int i = 0; i < 3; ++i) {
+        if (sources[i] == ClockSource::Tsc && !LogClock::IsTscAvailable()) {
+            Report("LogClock Tsc (indisponible)", 0.0, "ns");
+            continue;
+        }
+        LogClock::SetSource(sources[i]);
+        Report(labels[i], Measure([] { return LogClock::Now(); }), "ns");
+    }
+
+    LogClock::SetSource(ClockSource::System);
+}
@@ -0,0 +1,68 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/benchmarks/CompressionBenchmark.cpp
+// DESCRIPTION: Débit (Mo/s d'entrée) et taux de compression du codec gzip
+//              intégré sur un texte de journal typique, par niveau.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#include "Benchmark.h"
+#include <Logger/Deflate.h>
+#include <cstdio>
+#include <string>
+
+using namespace nkentseu;
+using namespace nkentseu::logger;
+using namespace nkentseu::logger::bench;
+
+namespace {
+
+    /// Lignes du texte compressé (environ 16 Mo)
+    const uint64 LINE_COUNT = 160000;
+
+    /**
+     * @brief Texte de journal: horodatage, niveau, thread, champs variables
+     */
+    std::string MakeLogText() {
+        static const char* const levels[] = { "INFO", "INFO", "INFO", "DEBUG", "WARN", "ERROR" };
+        static const char* const routes[] = { "/api/v1/items", "/api/v1/users", "/health", "/api/v1/orders" };
+
+        std::string text;
+        text.reserve(LINE_COUNT * 110);
+        uint32 state = 12345;
+        char line[192];
+        for (uint64 i = 0; i < LINE_COUNT; ++i) {
+            state = state * 1103515245u + 12345u;
+            const int length = std::snprintf(line, sizeof(line),
+                "[2026-01-01 10:%02u:%02u.%03u] [%s] [worker-%u] GET %s/%u -> 200 in %u us (bytes=%u)\n",
+                static_cast<uint32>(i / 60000 % 60), static_cast<uint32>(i / 1000 % 60),
+                static_cast<uint32>(i % 1000), levels[(state >> 29) % 6],
+                (state >> 8) % 8, routes[(state >> 12) % 4], (state >> 4) % 100000,
+                (state >> 16) % 5000, (state >> 3) % 65536);
+            text.append(line, static_cast<size_t>(length));
+        }
+        return text;
+    }
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+// Débit et taux de GzipCompress selon le niveau
+// -----------------------------------------------------------------------------
+BENCHMARK_CASE(Gzip_LogText) {
+    const std::string text = MakeLogText();
+    const double megabytes = static_cast<double>(text.size()) / 1e6;
+
+    for (int level : { 1, DeflateEncoder::DEFAULT_LEVEL, 9 }) {
+        Stopwatch watch;
+        const std::string compressed = GzipCompress(text.data(), text.size(), level);
+        const double seconds = watch.ElapsedSeconds();
+        DoNotOptimize(compressed);
+
+        char label[64];
+        std::snprintf(label, sizeof(label), "level %d, throughput", level);
+        Report(label, megabytes / seconds, "MB/s");
+        std::snprintf(label, sizeof(label), "level %d, ratio", level);
+        Report(label, static_cast<double>(text.size()) / static_cast<double>(compressed.size()), "x");
+    }
+}
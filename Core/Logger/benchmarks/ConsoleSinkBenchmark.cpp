@@ -0,0 +1,112 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/benchmarks/ConsoleSinkBenchmark.cpp
+// DESCRIPTION: Débit du ConsoleSink (lignes/s) et nombre d'appels système
+//              d'écriture: une ligne et un flush par message contre la sortie
+//              groupée (un write par lot ou par image). La sortie standard
+//              est redirigée vers /dev/null pendant la mesure.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#include "Benchmark.h"
+#include <Logger/Sinks/ConsoleSink.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#if defined(__linux__) || defined(__APPLE__)
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+using namespace nkentseu;
+using namespace nkentseu::logger;
+using namespace nkentseu::logger::bench;
+
+namespace {
+
+    /// Lignes écrites par mesure
+    const uint64 LINE_COUNT = 200000;
+
+    /**
+     * @brief Nombre d'appels système d'écriture du processus
+     * @return Compteur syscw de /proc/self/io (0 si indisponible)
+     */
+    uint64 ReadWriteSyscalls() {
+        #if defined(__linux__)
+            std::ifstream io("/proc/self/io");
+            std::string key;
+            uint64 value = 0;
+            while (io >> key >> value) {
+                if (key == "syscw:") return value;
+            }
+        #endif
+        return 0;
+    }
+
+    /**
+     * @brief Mesure un ConsoleSink sur stdout redirigé vers /dev/null
+     * @param name Libellé
+     * @param batched Sortie groupée
+     * @param linesPerBatch Lignes par lot (BeginBatch/EndBatch) ou par image
+     *        (Flush), 0 pour des lignes isolées
+     * @param frames true pour terminer chaque groupe par Flush (boucle d'image)
+     */
+    void Measure(const char* name, bool batched, uint64 linesPerBatch, bool frames) {
+        #if defined(__linux__) || defined(__APPLE__)
+            std::fflush(stdout);
+            const int saved = dup(STDOUT_FILENO);
+            const int null = open("/dev/null", O_WRONLY);
+            dup2(null, STDOUT_FILENO);
+            close(null);
+        #endif
+
+        double seconds = 0.0;
+        uint64 syscalls = 0;
+        {
+            ConsoleSink sink(ConsoleStream::StdOut, true);
+            sink.SetBatchedOutput(batched);
+
+            LogMessage message(LogLevel::Info, "Mouse moved to (512, 384)", "bench");
+
+            const uint64 before = ReadWriteSyscalls();
+            Stopwatch watch;
+            for (uint64 i = 0; i < LINE_COUNT; ++i) {
+                const bool first = linesPerBatch > 0 && i % linesPerBatch == 0;
+                const bool last = linesPerBatch > 0 && (i + 1) % linesPerBatch == 0;
+                if (first && !frames) sink.BeginBatch();
+                sink.Log(message);
+                if (last) {
+                    if (frames) sink.Flush();
+                    else sink.EndBatch();
+                }
+            }
+            sink.Flush();
+            seconds = watch.ElapsedSeconds();
+            syscalls = ReadWriteSyscalls() - before;
+        }
+
+        #if defined(__linux__) || defined(__APPLE__)
+            std::cout.flush();
+            dup2(saved, STDOUT_FILENO);
+            close(saved);
+        #endif
+
+        char label[64];
+        std::snprintf(label, sizeof(label), "%s, throughput", name);
+        Report(label, static_cast<double>(LINE_COUNT) / seconds / 1e6, "M lines/s");
+        std::snprintf(label, sizeof(label), "%s, write syscalls", name);
+        Report(label, static_cast<double>(syscalls), "syscalls");
+    }
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+// ConsoleSink: flush par ligne contre sortie groupée
+// -----------------------------------------------------------------------------
+BENCHMARK_CASE(ConsoleSink_Batching) {
+    Measure("stream, flush per line", false, 0, false);
+    Measure("stream, async batches of 256", false, 256, false);
+    Measure("batched, async batches of 256", true, 256, false);
+    Measure("batched, frames of 64 lines", true, 64, true);
+}
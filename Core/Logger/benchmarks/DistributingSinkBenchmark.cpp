@@ -0,0 +1,116 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/benchmarks/DistributingSinkBenchmark.cpp
+// DESCRIPTION: DistributingSink avec un sous-sink lent (écriture bloquante
+//              simulée) et un sous-sink rapide: débit côté appelant et délai
+//              avant que le sous-sink rapide ait tout reçu, en distribution
+//              séquentielle puis parallèle.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#include "Benchmark.h"
+#include <Logger/Sinks/DistributingSink.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+
+using namespace nkentseu;
+using namespace nkentseu::logger;
+using namespace nkentseu::logger::bench;
+
+namespace {
+
+    /// Flux continu, et rafale plus courte que la file d'un sous-sink
+    const uint64 STREAM_COUNT = 200000;
+    const uint64 BURST_COUNT = 4096;
+
+    /// Le sous-sink lent bloque 200 µs tous les 64 messages (~3 µs/message)
+    const uint64 SLOW_PERIOD = 64;
+    const uint32 SLOW_PAUSE_US = 200;
+
+    // -------------------------------------------------------------------------
+    // Sous-sink qui compte les messages, avec une pause périodique optionnelle
+    // -------------------------------------------------------------------------
+    class CountingSink : public ISink {
+        public:
+            explicit CountingSink(bool slow)
+                : m_Formatter(std::make_unique<Formatter>())
+                , m_Slow(slow) {
+            }
+
+            void Log(const LogMessage& message) override {
+                DoNotOptimize(message);
+                const uint64 index = count.fetch_add(1, std::memory_order_relaxed) + 1;
+                if (m_Slow && index % SLOW_PERIOD == 0) {
+                    std::this_thread::sleep_for(std::chrono::microseconds(SLOW_PAUSE_US));
+                }
+            }
+            void Flush() override {}
+            void SetFormatter(std::unique_ptr<Formatter>) override {}
+            void SetPattern(const std::string&) override {}
+            Formatter* GetFormatter() const override { return m_Formatter.get(); }
+            std::string GetPattern() const override { return m_Formatter->GetPattern(); }
+
+            std::atomic<uint64> count{0};
+
+        private:
+            std::unique_ptr<Formatter> m_Formatter;
+            bool m_Slow;
+    };
+
+    /**
+     * @brief Distribue des messages à un sous-sink rapide et un lent
+     * @param name Libellé
+     * @param count Nombre de messages
+     * @param parallel Distribution parallèle
+     * @param policy Politique du sous-sink lent (mode parallèle)
+     */
+    void Measure(const char* name, uint64 count, bool parallel, SinkGroupPolicy policy) {
+        auto fast = std::make_shared<CountingSink>(false);
+        auto slow = std::make_shared<CountingSink>(true);
+        DistributingSink sink({fast, slow});
+        sink.SetParallel(parallel);
+        sink.SetSinkPolicy(slow, policy);
+
+        LogMessage message(LogLevel::Info, "Mouse moved to (512, 384)", "bench");
+
+        Stopwatch watch;
+        for (uint64 i = 0; i < count; ++i) {
+            sink.Log(message);
+        }
+        const double callerSeconds = watch.ElapsedSeconds();
+
+        while (fast->count.load(std::memory_order_relaxed) < count) {
+            std::this_thread::yield();
+        }
+        const double fastSeconds = watch.ElapsedSeconds();
+
+        sink.Flush();
+        const std::vector<SubSinkStats> stats = sink.GetSinkStats();
+
+        char label[64];
+        std::snprintf(label, sizeof(label), "%s, caller", name);
+        Report(label, static_cast<double>(count) / callerSeconds / 1e6, "M msgs/s");
+        std::snprintf(label, sizeof(label), "%s, fast child done", name);
+        Report(label, fastSeconds * 1e3, "ms");
+        std::snprintf(label, sizeof(label), "%s, fast max Log", name);
+        Report(label, static_cast<double>(stats[0].maxLatency) / 1e3, "us");
+        std::snprintf(label, sizeof(label), "%s, slow dropped", name);
+        Report(label, static_cast<double>(stats[1].dropped), "msgs");
+    }
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+// DistributingSink: un sous-sink lent, distribution séquentielle ou parallèle
+// -----------------------------------------------------------------------------
+BENCHMARK_CASE(DistributingSink_SlowChild) {
+    Measure("stream, sequential", STREAM_COUNT, false, SinkGroupPolicy::Block);
+    Measure("stream, parallel Block", STREAM_COUNT, true, SinkGroupPolicy::Block);
+    Measure("stream, parallel DropWhenBehind", STREAM_COUNT, true, SinkGroupPolicy::DropWhenBehind);
+    Measure("burst, sequential", BURST_COUNT, false, SinkGroupPolicy::Block);
+    Measure("burst, parallel Block", BURST_COUNT, true, SinkGroupPolicy::Block);
+}
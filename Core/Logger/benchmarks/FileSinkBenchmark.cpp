@@ -0,0 +1,305 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/benchmarks/FileSinkBenchmark.cpp
+// DESCRIPTION: Débit du FileSink (lignes/s) et nombre d'appels système
+//              d'écriture selon la stratégie de flush, comparés à l'ancien
+//              comportement (std::unitbuf + std::endl), pour les backends
+//              flux standard et descripteur brut (writev).
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#include "Benchmark.h"
+#include <Logger/Sinks/BinarySink.h>
+#include <Logger/Sinks/DailyFileSink.h>
+#include <Logger/Sinks/FileSink.h>
+#include <Logger/Sinks/MappedFileSink.h>
+#include <Logger/Sinks/RotatingFileSink.h>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+using namespace nkentseu;
+using namespace nkentseu::logger;
+using namespace nkentseu::logger::bench;
+
+namespace {
+
+    /// Lignes écrites par mesure
+    const uint64 LINE_COUNT = 200000;
+
+    /**
+     * @brief Nombre d'appels système d'écriture du processus
+     * @return Compteur syscw de /proc/self/io (0 si indisponible)
+     */
+    uint64 ReadWriteSyscalls() {
+        #if defined(__linux__)
+            std::ifstream io("/proc/self/io");
+            std::string key;
+            uint64 value = 0;
+            while (io >> key >> value) {
+                if (key == "syscw:") return value;
+            }
+        #endif
+        return 0;
+    }
+
+    /// Chemin du fichier de mesure
+    std::string BenchmarkFile() {
+        return (std::filesystem::temp_directory_path() / "nk_filesink_bench.log").string();
+    }
+
+    /**
+     * @brief Affiche le débit et les appels système d'une mesure
+     */
+    void ReportRun(const char* name, double seconds, uint64 syscalls) {
+        char label[64];
+        std::snprintf(label, sizeof(label), "%s, throughput", name);
+        Report(label, static_cast<double>(LINE_COUNT) / seconds / 1e6, "M lines/s");
+        std::snprintf(label, sizeof(label), "%s, write syscalls", name);
+        Report(label, static_cast<double>(syscalls), "syscalls");
+    }
+
+    /**
+     * @brief Ancien comportement: flux en unitbuf, une ligne suivie de std::endl
+     */
+    void MeasureLegacy() {
+        const std::string path = BenchmarkFile();
+        std::ofstream stream(path, std::ios_base::out | std::ios_base::trunc);
+        stream << std::unitbuf;
+
+        LogMessage message(LogLevel::Info, "Player moved to (128.5, 64.25)", "bench");
+        Formatter formatter;
+
+        const uint64 syscallsBefore = ReadWriteSyscalls();
+        Stopwatch watch;
+        for (uint64 i = 0; i < LINE_COUNT; ++i) {
+            stream << formatter.Format(message) << std::endl;
+        }
+        const double seconds = watch.ElapsedSeconds();
+
+        ReportRun("unitbuf + endl (previous)", seconds, ReadWriteSyscalls() - syscallsBefore);
+        stream.close();
+        std::filesystem::remove(path);
+    }
+
+    /// Lignes par lot simulé (taille de lot du logger asynchrone)
+    const uint64 BATCH_SIZE = 256;
+
+    /**
+     * @brief FileSink avec une stratégie de flush et un backend donnés
+     * @param batched true pour regrouper les lignes par lots comme le logger asynchrone
+     */
+    void MeasurePolicy(const char* name, const FlushPolicy& policy,
+                       FileBackendType backend = FileBackendType::Stream, bool batched = false) {
+        const std::string path = BenchmarkFile();
+        {
+            FileSink sink(path, true);
+            sink.SetFlushPolicy(policy);
+            sink.SetBackend(backend);
+
+            LogMessage message(LogLevel::Info, "Player moved to (128.5, 64.25)", "bench");
+
+            const uint64 syscallsBefore = ReadWriteSyscalls();
+            Stopwatch watch;
+            for (uint64 i = 0; i < LINE_COUNT; ++i) {
+                if (batched && i % BATCH_SIZE == 0) sink.BeginBatch();
+                sink.Log(message);
+                if (batched && (i % BATCH_SIZE == BATCH_SIZE - 1 || i + 1 == LINE_COUNT)) sink.EndBatch();
+            }
+            sink.Flush();
+            const double seconds = watch.ElapsedSeconds();
+
+            ReportRun(name, seconds, ReadWriteSyscalls() - syscallsBefore);
+        }
+        std::filesystem::remove(path);
+    }
+
+    /**
+     * @brief MappedFileSink: copies en mémoire, un appel système par bloc
+     */
+    void MeasureMapped(const char* name, size_t chunkSize) {
+        const std::string path = BenchmarkFile();
+        {
+            MappedFileSink sink(path, true, chunkSize);
+
+            LogMessage message(LogLevel::Info, "Player moved to (128.5, 64.25)", "bench");
+
+            const uint64 syscallsBefore = ReadWriteSyscalls();
+            Stopwatch watch;
+            for (uint64 i = 0; i < LINE_COUNT; ++i) {
+                sink.Log(message);
+            }
+            const double seconds = watch.ElapsedSeconds();
+
+            ReportRun(name, seconds, ReadWriteSyscalls() - syscallsBefore);
+        }
+        std::filesystem::remove(path);
+    }
+
+    /**
+     * @brief Écrit LINE_COUNT messages détaillés avec un sink et rapporte débit et taille
+     */
+    template <typename Sink>
+    void MeasureRecords(const char* name, Sink& sink, const std::string& path) {
+        LogMessage message(LogLevel::Info, "Player moved to (128.5, 64.25)",
+                           "src/Gameplay/PlayerController.cpp", 214, "UpdateMovement", "gameplay");
+
+        Stopwatch watch;
+        for (uint64 i = 0; i < LINE_COUNT; ++i) {
+            message.timestamp += 10000;
+            sink.Log(message);
+        }
+        sink.Flush();
+        const double seconds = watch.ElapsedSeconds();
+
+        char label[64];
+        std::snprintf(label, sizeof(label), "%s, throughput", name);
+        Report(label, static_cast<double>(LINE_COUNT) / seconds / 1e6, "M lines/s");
+        std::snprintf(label, sizeof(label), "%s, size per line", name);
+        Report(label, static_cast<double>(std::filesystem::file_size(path)) / LINE_COUNT, "bytes");
+    }
+
+    /**
+     * @brief RotatingFileSink tamponné, rotation tous les 1 MiB
+     * @param statPerLine true pour reproduire l'ancien comportement (taille
+     *        relue sur disque après chaque ligne)
+     */
+    void MeasureRotating(const char* name, bool background, bool statPerLine) {
+        const std::filesystem::path dir = std::filesystem::temp_directory_path() / "nk_rotating_bench";
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir);
+        {
+            RotatingFileSink sink((dir / "bench.log").string(), 1024 * 1024, 4);
+            sink.SetFlushPolicy(FlushPolicy::Buffered());
+            sink.SetBackgroundRotation(background);
+
+            LogMessage message(LogLevel::Info, "Player moved to (128.5, 64.25)", "bench");
+
+            // Pire appel: une rotation sur le thread de log s'y voit
+            double worstCall = 0.0;
+            Stopwatch watch;
+            for (uint64 i = 0; i < LINE_COUNT; ++i) {
+                Stopwatch call;
+                sink.Log(message);
+                if (statPerLine) DoNotOptimize(sink.GetFileSize());
+                const double elapsed = call.ElapsedSeconds();
+                if (elapsed > worstCall) worstCall = elapsed;
+            }
+            sink.Flush();
+            const double seconds = watch.ElapsedSeconds();
+
+            char label[64];
+            std::snprintf(label, sizeof(label), "%s, throughput", name);
+            Report(label, static_cast<double>(LINE_COUNT) / seconds / 1e6, "M lines/s");
+            std::snprintf(label, sizeof(label), "%s, worst call", name);
+            Report(label, worstCall * 1e6, "us");
+        }
+        std::filesystem::remove_all(dir);
+    }
+
+    /**
+     * @brief FileSink ou DailyFileSink tamponné, sans rotation pendant la mesure
+     * @param localTimePerLine true pour reproduire l'ancien contrôle (heure
+     *        système et conversion en heure locale à chaque ligne)
+     */
+    void MeasureDaily(const char* name, bool daily, bool localTimePerLine) {
+        const std::string path = BenchmarkFile();
+        std::filesystem::remove(path);
+        {
+            std::unique_ptr<FileSink> sink = daily ?
+                std::make_unique<DailyFileSink>(path) : std::make_unique<FileSink>(path, true);
+            sink->SetFlushPolicy(FlushPolicy::Buffered());
+
+            LogMessage message(LogLevel::Info, "Player moved to (128.5, 64.25)", "bench");
+
+            Stopwatch watch;
+            for (uint64 i = 0; i < LINE_COUNT; ++i) {
+                sink->Log(message);
+                if (localTimePerLine) {
+                    const std::time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+                    DoNotOptimize(std::localtime(&now)->tm_mday);
+                }
+            }
+            sink->Flush();
+            const double seconds = watch.ElapsedSeconds();
+
+            char label[64];
+            std::snprintf(label, sizeof(label), "%s, throughput", name);
+            Report(label, static_cast<double>(LINE_COUNT) / seconds / 1e6, "M lines/s");
+        }
+        std::filesystem::remove(path);
+    }
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+// FileSink: stratégies de flush
+// -----------------------------------------------------------------------------
+BENCHMARK_CASE(FileSink_FlushPolicies) {
+    MeasureLegacy();
+    MeasurePolicy("unbuffered", FlushPolicy::Unbuffered());
+    MeasurePolicy("buffered 64 KiB (1 s, >= Error)", FlushPolicy::Buffered());
+    MeasurePolicy("explicit only, 1 MiB", FlushPolicy::ExplicitOnly(1024 * 1024));
+}
+
+// -----------------------------------------------------------------------------
+// FileSink: flux standard contre descripteur brut (writev)
+// -----------------------------------------------------------------------------
+BENCHMARK_CASE(FileSink_Backends) {
+    MeasurePolicy("stream, unbuffered", FlushPolicy::Unbuffered(), FileBackendType::Stream);
+    MeasurePolicy("descriptor, unbuffered", FlushPolicy::Unbuffered(), FileBackendType::Descriptor);
+    MeasurePolicy("stream, async batches of 256", FlushPolicy::Unbuffered(), FileBackendType::Stream, true);
+    MeasurePolicy("descriptor, async batches of 256", FlushPolicy::Unbuffered(), FileBackendType::Descriptor, true);
+    MeasurePolicy("stream, buffered 64 KiB", FlushPolicy::Buffered(), FileBackendType::Stream);
+    MeasurePolicy("descriptor, buffered 64 KiB", FlushPolicy::Buffered(), FileBackendType::Descriptor);
+}
+
+// -----------------------------------------------------------------------------
+// MappedFileSink: fichier projeté en mémoire
+// -----------------------------------------------------------------------------
+BENCHMARK_CASE(MappedFileSink_Throughput) {
+    MeasurePolicy("FileSink unbuffered (reference)", FlushPolicy::Unbuffered());
+    MeasureMapped("mapped, 1 MiB chunks", 1024 * 1024);
+    MeasureMapped("mapped, 4 MiB chunks", MappedFileSink::DEFAULT_CHUNK_SIZE);
+}
+
+// -----------------------------------------------------------------------------
+// BinarySink: enregistrements binaires contre texte formaté
+// -----------------------------------------------------------------------------
+BENCHMARK_CASE(BinarySink_Throughput) {
+    const std::string path = BenchmarkFile();
+    {
+        FileSink sink(path, true);
+        sink.SetPattern(patterns::Detailed);
+        sink.SetFlushPolicy(FlushPolicy::Buffered());
+        MeasureRecords("FileSink, detailed pattern", sink, path);
+    }
+    {
+        BinarySink sink(path, true);
+        sink.SetPattern(patterns::Detailed);
+        MeasureRecords("BinarySink", sink, path);
+    }
+    std::filesystem::remove(path);
+}
+
+// -----------------------------------------------------------------------------
+// RotatingFileSink: taille comptée en mémoire, rotation sur place ou de fond
+// -----------------------------------------------------------------------------
+BENCHMARK_CASE(RotatingFileSink_Throughput) {
+    MeasureRotating("stat per line (previous)", false, true);
+    MeasureRotating("tracked size, inline", false, false);
+    MeasureRotating("tracked size, background", true, false);
+}
+
+// -----------------------------------------------------------------------------
+// DailyFileSink: échéance précalculée contre heure locale à chaque ligne
+// -----------------------------------------------------------------------------
+BENCHMARK_CASE(DailyFileSink_Throughput) {
+    MeasureDaily("FileSink (reference)", false, false);
+    MeasureDaily("local time per line (previous)", true, true);
+    MeasureDaily("precomputed deadline", true, false);
+}
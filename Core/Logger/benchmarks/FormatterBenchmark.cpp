@@ -0,0 +1,84 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/benchmarks/FormatterBenchmark.cpp
+// DESCRIPTION: Débit du formatage (lignes/s) sur les patterns prédéfinis,
+//              Formatter interprété contre CompiledFormatter, avec des
+//              horodatages qui avancent comme dans un flux de log réel.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#include "Benchmark.h"
+#include <Logger/CompiledFormatter.h>
+#include <Logger/Formatter.h>
+#include <Logger/LogMessage.h>
+#include <string>
+
+using namespace nkentseu;
+using namespace nkentseu::logger;
+using namespace nkentseu::logger::bench;
+
+namespace {
+
+    /// Lignes formatées par mesure
+    const uint64 LINE_COUNT = 1 << 20;
+
+    /// Écart entre deux messages consécutifs (10 µs: ~100 000 lignes/s simulées)
+    const uint64 MESSAGE_SPACING_NS = 10000;
+
+    /**
+     * @brief Mesure le débit d'une fonction de formatage
+     * @param format Fonction (const LogMessage&) -> std::string
+     * @return Lignes par seconde
+     */
+    template <typename FormatFunction>
+    double Measure(FormatFunction&& format) {
+        LogMessage message(LogLevel::Info, "Player moved to (128.5, 64.25)", "bench");
+        message.sourceFile = __FILE__;
+        message.sourceLine = __LINE__;
+        message.functionName = __FUNCTION__;
+
+        uint64 totalSize = 0;
+
+        Stopwatch watch;
+        for (uint64 i = 0; i < LINE_COUNT; ++i) {
+            message.timestamp += MESSAGE_SPACING_NS;
+            totalSize += format(message).size();
+        }
+        const double seconds = watch.ElapsedSeconds();
+
+        DoNotOptimize(totalSize);
+        return static_cast<double>(LINE_COUNT) / seconds;
+    }
+
+    /**
+     * @brief Mesure le Formatter interprété (pattern dynamique)
+     */
+    double MeasureInterpreted(const char* pattern) {
+        // Espace final: pattern inconnu, pas de délégation à la version compilée
+        Formatter formatter(std::string(pattern) + " ");
+        return Measure([&](const LogMessage& message) { return formatter.Format(message); });
+    }
+
+    /**
+     * @brief Mesure la version compilée d'un pattern
+     */
+    template <const char* Pattern>
+    double MeasureCompiled() {
+        return Measure([](const LogMessage& message) { return CompiledFormatter<Pattern>::Format(message); });
+    }
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+// Formatter interprété contre CompiledFormatter sur les patterns prédéfinis
+// -----------------------------------------------------------------------------
+BENCHMARK_CASE(Formatter_Throughput) {
+    Report("default pattern, interpreted", MeasureInterpreted(patterns::Default) / 1e6, "M lines/s");
+    Report("default pattern, compiled", MeasureCompiled<patterns::Default>() / 1e6, "M lines/s");
+    Report("detailed pattern, interpreted", MeasureInterpreted(patterns::Detailed) / 1e6, "M lines/s");
+    Report("detailed pattern, compiled", MeasureCompiled<patterns::Detailed>() / 1e6, "M lines/s");
+    Report("json pattern, interpreted", MeasureInterpreted(patterns::Json) / 1e6, "M lines/s");
+    Report("json pattern, compiled", MeasureCompiled<patterns::Json>() / 1e6, "M lines/s");
+    Report("simple pattern, interpreted", MeasureInterpreted(patterns::Simple) / 1e6, "M lines/s");
+    Report("simple pattern, compiled", MeasureCompiled<patterns::Simple>() / 1e6, "M lines/s");
+}
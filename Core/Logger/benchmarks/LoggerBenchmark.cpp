@@ -0,0 +1,113 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/benchmarks/LoggerBenchmark.cpp
+// DESCRIPTION: Débit du logger synchrone (messages/s) selon le nombre de
+//              threads qui loggent en même temps vers les mêmes sinks.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#include "Benchmark.h"
+#include <Logger/Logger.h>
+#include <Logger/Sinks/NullSink.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace nkentseu;
+using namespace nkentseu::logger;
+using namespace nkentseu::logger::bench;
+
+namespace {
+
+    /// Nombre de threads testés
+    const uint32 THREAD_COUNTS[] = { 1, 2, 4, 8, 16 };
+
+    /// Messages produits au total pour chaque mesure
+    const uint64 TOTAL_MESSAGES = 1 << 20;
+
+    // -------------------------------------------------------------------------
+    // Sink qui accepte la ligne pré-formatée et ne fait rien d'autre:
+    // seul le coût du logger (liste de sinks, formatage) est mesuré
+    // -------------------------------------------------------------------------
+    class DiscardSink : public NullSink {
+        public:
+            DiscardSink()
+                : m_Formatter(std::make_unique<Formatter>()) {
+            }
+
+            void LogFormatted(const LogMessage&, const std::string& formatted) override {
+                DoNotOptimize(formatted.size());
+            }
+            bool SupportsPreformatted() const override { return true; }
+            Formatter* GetFormatter() const override { return m_Formatter.get(); }
+
+        private:
+            std::unique_ptr<Formatter> m_Formatter;
+    };
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+// Logger synchrone partagé: tous les threads dispatchent vers deux sinks
+// -----------------------------------------------------------------------------
+BENCHMARK_CASE(Logger_ConcurrentDispatch) {
+    char label[64];
+
+    for (uint32 threadCount : THREAD_COUNTS) {
+        Logger logger("bench");
+        logger.SetPattern("%v");
+        logger.AddSink(std::make_shared<DiscardSink>());
+        logger.AddSink(std::make_shared<DiscardSink>());
+
+        const uint64 perThread = TOTAL_MESSAGES / threadCount;
+        std::atomic<bool> go(false);
+        std::vector<std::thread> threads;
+
+        for (uint32 t = 0; t < threadCount; ++t) {
+            threads.emplace_back([&] {
+                while (!go.load()) std::this_thread::yield();
+                for (uint64 i = 0; i < perThread; ++i) {
+                    logger.Info("Player moved to (128.5, 64.25)");
+                }
+            });
+        }
+
+        Stopwatch watch;
+        go = true;
+        for (auto& thread : threads) thread.join();
+        const double seconds = watch.ElapsedSeconds();
+
+        std::snprintf(label, sizeof(label), "Logger, %2u thread(s)", threadCount);
+        Report(label, static_cast<double>(perThread * threadCount) / seconds / 1e6, "M msg/s");
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Rafale d'un même site d'appel (trace par image): coût par appel sans
+// étape de limitation, puis avec suppression des répétitions
+// -----------------------------------------------------------------------------
+BENCHMARK_CASE(Logger_RepeatedCallSite) {
+    const uint64 messageCount = 1 << 20;
+
+    for (int limited = 0; limited < 2; ++limited) {
+        Logger logger("bench");
+        logger.SetPattern("%v");
+        logger.AddSink(std::make_shared<DiscardSink>());
+
+        if (limited) {
+            RateLimitConfig config;
+            config.repeatWindowMs = 1000;
+            logger.SetRateLimit(config);
+        }
+
+        Stopwatch watch;
+        for (uint64 i = 0; i < messageCount; ++i) {
+            logger.Log(LogLevel::Info, __FILE__, __LINE__, __FUNCTION__,
+                       "mouse moved to (%d, %d)", static_cast<int>(i & 1023), static_cast<int>(i >> 10));
+        }
+        const double seconds = watch.ElapsedSeconds();
+
+        Report(limited ? "repeats suppressed" : "no rate limit     ", seconds * 1e9 / messageCount, "ns/call");
+    }
+}
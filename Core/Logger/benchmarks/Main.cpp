@@ -0,0 +1,28 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/benchmarks/Main.cpp
+// DESCRIPTION: Point d'entrée des benchmarks du module Logger.
+//              Usage: LoggerBenchmarks [filtre]
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#include "Benchmark.h"
+#include <cstring>
+
+int main(int argc, char* argv[]) {
+    using namespace nkentseu::logger::bench;
+
+    const char* filter = argc > 1 ? argv[1] : nullptr;
+
+    for (const auto& benchmark : GetBenchmarks()) {
+        if (filter && std::strstr(benchmark.name, filter) == nullptr) {
+            continue;
+        }
+
+        std::printf("[%s]\n", benchmark.name);
+        benchmark.function();
+        std::printf("\n");
+    }
+
+    return 0;
+}
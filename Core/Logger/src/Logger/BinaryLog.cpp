@@ -0,0 +1,206 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/BinaryLog.cpp
+// DESCRIPTION: Implémentation du lecteur de journaux binaires.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#include "Logger/BinaryLog.h"
+#include <cstring>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        namespace {
+
+            /// Identifiant de chaîne maximal accepté (protège contre un fichier corrompu)
+            const uint64 MAX_STRING_ID = 1u << 24;
+
+            /// Longueur de chaîne maximale acceptée
+            const uint64 MAX_STRING_LENGTH = 64u << 20;
+
+        } // namespace
+
+        /**
+         * @brief Constructeur
+         */
+        BinaryLogReader::BinaryLogReader(const std::string& filename)
+            : m_File(filename, std::ios::binary)
+            , m_LastTimestamp(0)
+            , m_RecordCount(0)
+            , m_Valid(false)
+            , m_Error(false) {
+            uint8 tag = 0;
+            m_Valid = m_File.is_open() && ReadByte(tag) &&
+                      tag == static_cast<uint8>(binary::MAGIC[0]) && ReadSegment();
+        }
+
+        /**
+         * @brief Vérifie si le fichier est ouvert et commence par un segment
+         */
+        bool BinaryLogReader::IsOpen() const {
+            return m_Valid;
+        }
+
+        /**
+         * @brief Lit le message suivant
+         */
+        bool BinaryLogReader::Next(LogMessage& message) {
+            if (!m_Valid || m_Error) {
+                return false;
+            }
+
+            uint8 tag = 0;
+
+            // Fin de fichier entre deux éléments: fin normale
+            while (ReadByte(tag)) {
+                bool complete = false;
+
+                if (tag == binary::TAG_STRING) {
+                    uint64 id = 0;
+                    std::string text;
+                    complete = ReadVarint(id) && ReadString(text) && id > 0 && id <= MAX_STRING_ID;
+                    if (complete) {
+                        if (m_Strings.size() <= id) {
+                            m_Strings.resize(static_cast<size_t>(id) + 1, "");
+                        }
+                        m_Storage.push_back(std::move(text));
+                        m_Strings[static_cast<size_t>(id)] = m_Storage.back().c_str();
+                    }
+                } else if (tag == binary::TAG_PATTERN) {
+                    complete = ReadString(m_Pattern);
+                } else if (tag == static_cast<uint8>(binary::MAGIC[0])) {
+                    complete = ReadSegment();
+                } else if (tag == binary::TAG_RECORD || tag == binary::TAG_DEFERRED) {
+                    uint64 delta = 0, logger = 0, file = 0, line = 0, function = 0;
+                    uint64 thread = 0, threadName = 0, format = 0;
+                    uint8 level = 0;
+
+                    complete = ReadVarint(delta) && ReadByte(level) && ReadVarint(logger) &&
+                               ReadVarint(file) && ReadVarint(line) && ReadVarint(function) &&
+                               ReadVarint(thread) && ReadVarint(threadName) &&
+                               (tag != binary::TAG_DEFERRED || ReadVarint(format)) &&
+                               ReadString(m_Text);
+
+                    if (complete) {
+                        m_LastTimestamp += static_cast<uint64>(binary::ZigZagDecode(delta));
+
+                        message.timestamp = m_LastTimestamp;
+                        message.level = static_cast<LogLevel>(level);
+                        message.loggerName = GetString(logger);
+                        message.sourceFile = GetString(file);
+                        message.sourceLine = static_cast<uint32>(line);
+                        message.functionName = GetString(function);
+                        message.threadId = static_cast<uint32>(thread);
+                        message.SetThreadName(GetString(threadName));
+                        message.message.Assign(m_Text.data(), m_Text.size());
+                        message.deferredFormat = tag == binary::TAG_DEFERRED ? GetString(format) : nullptr;
+
+                        ++m_RecordCount;
+                        return true;
+                    }
+                }
+
+                if (!complete) {
+                    // Élément tronqué ou étiquette inconnue
+                    m_Error = true;
+                    return false;
+                }
+            }
+
+            return false;
+        }
+
+        /**
+         * @brief Indique si la lecture s'est arrêtée sur des données invalides
+         */
+        bool BinaryLogReader::HasError() const {
+            return m_Error;
+        }
+
+        /**
+         * @brief Pattern enregistré par le sink
+         */
+        const std::string& BinaryLogReader::GetPattern() const {
+            return m_Pattern;
+        }
+
+        /**
+         * @brief Nombre de messages lus
+         */
+        uint64 BinaryLogReader::GetRecordCount() const {
+            return m_RecordCount;
+        }
+
+        /**
+         * @brief Lit un octet
+         */
+        bool BinaryLogReader::ReadByte(uint8& value) {
+            const int c = m_File.get();
+            if (c == std::char_traits<char>::eof()) {
+                return false;
+            }
+            value = static_cast<uint8>(c);
+            return true;
+        }
+
+        /**
+         * @brief Lit un varint
+         */
+        bool BinaryLogReader::ReadVarint(uint64& value) {
+            value = 0;
+            for (uint32 shift = 0; shift < 64; shift += 7) {
+                uint8 byte = 0;
+                if (!ReadByte(byte)) {
+                    return false;
+                }
+                value |= static_cast<uint64>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @brief Lit une chaîne
+         */
+        bool BinaryLogReader::ReadString(std::string& value) {
+            uint64 length = 0;
+            if (!ReadVarint(length) || length > MAX_STRING_LENGTH) {
+                return false;
+            }
+            value.resize(static_cast<size_t>(length));
+            m_File.read(&value[0], static_cast<std::streamsize>(length));
+            return static_cast<uint64>(m_File.gcount()) == length;
+        }
+
+        /**
+         * @brief Lit la fin de MAGIC et le timestamp de base
+         */
+        bool BinaryLogReader::ReadSegment() {
+            char magic[sizeof(binary::MAGIC) - 1];
+            m_File.read(magic, sizeof(magic));
+            if (m_File.gcount() != static_cast<std::streamsize>(sizeof(magic)) ||
+                std::memcmp(magic, binary::MAGIC + 1, sizeof(magic)) != 0) {
+                return false;
+            }
+
+            // Nouveau segment: nouvelle table de chaînes
+            m_Storage.clear();
+            m_Strings.assign(1, "");
+            return ReadVarint(m_LastTimestamp);
+        }
+
+        /**
+         * @brief Chaîne d'identifiant donné
+         */
+        const char* BinaryLogReader::GetString(uint64 id) const {
+            return id < m_Strings.size() ? m_Strings[id] : "";
+        }
+
+    } // namespace logger
+} // namespace nkentseu
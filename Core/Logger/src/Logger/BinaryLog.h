@@ -0,0 +1,183 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/BinaryLog.h
+// DESCRIPTION: Format binaire des journaux (BinarySink) et lecteur associé.
+//              Les enregistrements sont compacts (entiers varint, chaînes
+//              remplacées par des identifiants) et ne sont formatés en texte
+//              qu'à la lecture.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Logger/Export.h"
+#include "Logger/LogMessage.h"
+#include <Nkentseu/Types.h>
+#include <deque>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        namespace binary {
+
+            // ---------------------------------------------------------------------
+            // FORMAT
+            //
+            // Un fichier est une suite de segments (un par ouverture du sink):
+            //
+            //   Segment : MAGIC (8 octets) | varint timestamp de base (ns)
+            //   String  : TAG_STRING  | varint id | varint longueur | octets
+            //   Pattern : TAG_PATTERN | varint longueur | octets
+            //   Record  : TAG_RECORD  | varint zigzag(delta timestamp) | u8 niveau
+            //             | varint logger | varint fichier | varint ligne
+            //             | varint fonction | varint thread | varint nom de thread
+            //             | varint longueur | octets du message
+            //   Deferred: TAG_DEFERRED | mêmes champs que Record jusqu'au nom de
+            //             thread | varint format | varint longueur | arguments
+            //             capturés (voir DeferredFormat.h)
+            //
+            // Chaque chaîne est définie une fois par segment, avant son premier
+            // usage; l'identifiant 0 désigne la chaîne vide. Le format d'un
+            // message différé est une chaîne comme les autres: le texte n'est
+            // produit qu'au décodage. Le delta de
+            // timestamp est relatif à l'enregistrement précédent (ou à la base).
+            // ---------------------------------------------------------------------
+
+            /// Début de segment ('N' sert aussi d'étiquette)
+            constexpr char MAGIC[8] = { 'N', 'K', 'B', 'L', 'O', 'G', '\x01', '\n' };
+
+            /// Définition d'une chaîne
+            constexpr uint8 TAG_STRING = 0x01;
+
+            /// Message de log
+            constexpr uint8 TAG_RECORD = 0x02;
+
+            /// Pattern conseillé pour l'affichage
+            constexpr uint8 TAG_PATTERN = 0x03;
+
+            /// Message à format différé (format et arguments capturés)
+            constexpr uint8 TAG_DEFERRED = 0x04;
+
+            /**
+             * @brief Ajoute un entier non signé en varint (7 bits par octet)
+             */
+            inline void AppendVarint(std::string& out, uint64 value) {
+                while (value >= 0x80) {
+                    out += static_cast<char>((value & 0x7F) | 0x80);
+                    value >>= 7;
+                }
+                out += static_cast<char>(value);
+            }
+
+            /**
+             * @brief Encode un entier signé pour un varint court (zigzag)
+             */
+            inline uint64 ZigZagEncode(int64 value) {
+                return (static_cast<uint64>(value) << 1) ^ static_cast<uint64>(value >> 63);
+            }
+
+            /**
+             * @brief Décode un entier zigzag
+             */
+            inline int64 ZigZagDecode(uint64 value) {
+                return static_cast<int64>(value >> 1) ^ -static_cast<int64>(value & 1);
+            }
+
+        } // namespace binary
+
+        // -------------------------------------------------------------------------
+        // CLASSE: BinaryLogReader
+        // DESCRIPTION: Lit un fichier écrit par BinarySink et reconstruit les
+        //              LogMessage, à formater avec n'importe quel Formatter.
+        //              Un message différé est rendu tel quel (IsDeferred()):
+        //              son texte se produit avec FormatDeferred.
+        //              Un enregistrement tronqué (arrêt brutal) termine la
+        //              lecture et positionne HasError().
+        // -------------------------------------------------------------------------
+        class LOGGER_API BinaryLogReader {
+            public:
+                /**
+                 * @brief Constructeur
+                 * @param filename Fichier à lire
+                 */
+                explicit BinaryLogReader(const std::string& filename);
+
+                /**
+                 * @brief Vérifie si le fichier est ouvert et commence par un segment
+                 */
+                bool IsOpen() const;
+
+                /**
+                 * @brief Lit le message suivant
+                 * @param message Message reconstruit (chaînes valides jusqu'au prochain appel)
+                 * @return false en fin de fichier ou sur erreur
+                 */
+                bool Next(LogMessage& message);
+
+                /**
+                 * @brief Indique si la lecture s'est arrêtée sur des données invalides
+                 */
+                bool HasError() const;
+
+                /**
+                 * @brief Pattern enregistré par le sink (vide si aucun)
+                 */
+                const std::string& GetPattern() const;
+
+                /**
+                 * @brief Nombre de messages lus
+                 */
+                uint64 GetRecordCount() const;
+
+            private:
+                /// Lit un octet
+                bool ReadByte(uint8& value);
+
+                /// Lit un varint
+                bool ReadVarint(uint64& value);
+
+                /// Lit une chaîne (longueur varint + octets)
+                bool ReadString(std::string& value);
+
+                /// Lit la fin de MAGIC et le timestamp de base
+                bool ReadSegment();
+
+                /// Chaîne d'identifiant donné ("" si inconnu)
+                const char* GetString(uint64 id) const;
+
+                /// Fichier lu
+                std::ifstream m_File;
+
+                /// Chaînes du segment courant (pointeurs stables)
+                std::deque<std::string> m_Storage;
+
+                /// Table identifiant -> chaîne du segment courant
+                std::vector<const char*> m_Strings;
+
+                /// Pattern enregistré
+                std::string m_Pattern;
+
+                /// Tampon de lecture du texte des messages
+                std::string m_Text;
+
+                /// Timestamp du dernier enregistrement
+                uint64 m_LastTimestamp;
+
+                /// Nombre de messages lus
+                uint64 m_RecordCount;
+
+                /// Premier segment valide
+                bool m_Valid;
+
+                /// Données invalides rencontrées
+                bool m_Error;
+        };
+
+    } // namespace logger
+} // namespace nkentseu
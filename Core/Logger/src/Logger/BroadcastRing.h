@@ -0,0 +1,381 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/BroadcastRing.h
+// DESCRIPTION: File circulaire bornée multi-producteurs / multi-consommateurs
+//              en diffusion: chaque consommateur lit tous les éléments avec
+//              son propre curseur. Un consommateur "tolérant aux pertes" en
+//              retard d'une file complète est dépassé au lieu de bloquer les
+//              producteurs.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Logger/RingBuffer.h"
+#include <Nkentseu/Types.h>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        // -------------------------------------------------------------------------
+        // CLASSE: BroadcastRingBuffer
+        // DESCRIPTION: Variante diffusée de MPSCRingBuffer. Les producteurs
+        //              réservent un slot comme dans MPSCRingBuffer; à la
+        //              publication, le slot reçoit le nombre de consommateurs
+        //              qui doivent encore le lire. Chaque consommateur réserve
+        //              des positions en avançant son curseur par CAS, lit les
+        //              slots puis les libère; le dernier à libérer un slot le
+        //              rend aux producteurs.
+        //
+        //              File pleine: le producteur dépasse les consommateurs
+        //              tolérants aux pertes bloqués sur le slot visé (avance de
+        //              leur curseur et libération à leur place, comptées comme
+        //              pertes). Seuls les consommateurs bloquants retiennent
+        //              les producteurs. Le CAS sur le curseur garantit qu'un
+        //              slot réservé par son consommateur n'est jamais libéré
+        //              par un autre thread pendant sa lecture.
+        // -------------------------------------------------------------------------
+        template <typename T>
+        class BroadcastRingBuffer {
+            public:
+                // ---------------------------------------------------------------------
+                // CONSTRUCTEURS
+                // ---------------------------------------------------------------------
+
+                /**
+                 * @brief Constructeur
+                 * @param capacity Capacité demandée (arrondie à la puissance de 2 supérieure)
+                 * @param consumerCount Nombre de consommateurs (au moins 1)
+                 */
+                BroadcastRingBuffer(size_t capacity, size_t consumerCount)
+                    : m_Capacity(RoundUpToPowerOfTwo(capacity < 2 ? 2 : capacity))
+                    , m_Mask(m_Capacity - 1)
+                    , m_ConsumerCount(consumerCount < 1 ? 1 : consumerCount)
+                    , m_Slots(new Slot[m_Capacity])
+                    , m_Consumers(new Consumer[m_ConsumerCount])
+                    , m_EnqueuePos(0) {
+                    for (size_t i = 0; i < m_Capacity; ++i) {
+                        m_Slots[i].sequence.store(i, std::memory_order_relaxed);
+                        m_Slots[i].remaining.store(0, std::memory_order_relaxed);
+                    }
+                }
+
+                BroadcastRingBuffer(const BroadcastRingBuffer&) = delete;
+                BroadcastRingBuffer& operator=(const BroadcastRingBuffer&) = delete;
+
+                // ---------------------------------------------------------------------
+                // CÔTÉ PRODUCTEUR (thread-safe, sans verrou)
+                // ---------------------------------------------------------------------
+
+                /**
+                 * @brief Tente d'ajouter un élément (déplacé dans le slot)
+                 * @param value Élément à ajouter
+                 * @return true si ajouté, false si un consommateur bloquant retient le slot
+                 */
+                bool TryPush(T&& value) {
+                    size_t pos = m_EnqueuePos.load(std::memory_order_relaxed);
+
+                    for (;;) {
+                        Slot& slot = m_Slots[pos & m_Mask];
+                        size_t sequence = slot.sequence.load(std::memory_order_acquire);
+                        intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+                        if (diff == 0) {
+                            if (m_EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                                slot.value = std::move(value);
+                                slot.remaining.store(static_cast<uint32>(m_ConsumerCount), std::memory_order_relaxed);
+                                slot.sequence.store(pos + 1, std::memory_order_release);
+                                return true;
+                            }
+                        } else if (diff < 0) {
+                            // Slot encore lu au tour précédent: dépasser les
+                            // consommateurs tolérants aux pertes qui le retiennent
+                            if (!SkipLaggingConsumers(pos - m_Capacity, true)) {
+                                return false;
+                            }
+                            pos = m_EnqueuePos.load(std::memory_order_relaxed);
+                        } else {
+                            pos = m_EnqueuePos.load(std::memory_order_relaxed);
+                        }
+                    }
+                }
+
+                /**
+                 * @brief Dépasse tous les consommateurs sur l'élément le plus ancien
+                 * @return true si au moins un consommateur a été dépassé
+                 *
+                 * Politique "écraser le plus ancien" appliquée à tous les
+                 * consommateurs, y compris bloquants. Un consommateur en train
+                 * de lire cet élément n'est pas concerné (curseur déjà avancé).
+                 */
+                bool TryDiscardOldest() {
+                    const size_t pos = m_EnqueuePos.load(std::memory_order_relaxed);
+                    return pos >= m_Capacity && SkipLaggingConsumers(pos - m_Capacity, false);
+                }
+
+                // ---------------------------------------------------------------------
+                // CÔTÉ CONSOMMATEUR (un thread à la fois par consommateur)
+                // ---------------------------------------------------------------------
+
+                /**
+                 * @brief Traite jusqu'à maxCount éléments publiés pour un consommateur
+                 * @param consumer Index du consommateur
+                 * @param handler Fonction appelée avec une référence sur chaque élément
+                 * @param maxCount Nombre maximum d'éléments à traiter
+                 * @return Nombre d'éléments traités
+                 *
+                 * Les positions du lot sont réservées d'un bloc puis chaque slot
+                 * est libéré dès que le handler retourne. Avec plusieurs
+                 * consommateurs, d'autres threads lisent le même élément en
+                 * parallèle: le handler ne doit pas le modifier.
+                 */
+                template <typename Handler>
+                size_t PopBatch(size_t consumer, Handler&& handler, size_t maxCount) {
+                    std::atomic<size_t>& cursor = m_Consumers[consumer].cursor;
+                    size_t pos = cursor.load(std::memory_order_relaxed);
+                    size_t count = 0;
+
+                    for (;;) {
+                        // Éléments publiés et consécutifs à partir du curseur
+                        count = 0;
+                        while (count < maxCount &&
+                               m_Slots[(pos + count) & m_Mask].sequence.load(std::memory_order_acquire) == pos + count + 1) {
+                            ++count;
+                        }
+                        if (count == 0) {
+                            return 0;
+                        }
+                        if (cursor.compare_exchange_weak(pos, pos + count, std::memory_order_acq_rel)) {
+                            break;
+                        }
+                        // Dépassé par un producteur: reprendre au nouveau curseur
+                    }
+
+                    for (size_t i = 0; i < count; ++i) {
+                        handler(m_Slots[(pos + i) & m_Mask].value);
+                        Release(pos + i);
+                    }
+                    return count;
+                }
+
+                /**
+                 * @brief Vérifie si un consommateur n'a rien à lire
+                 * @param consumer Index du consommateur
+                 */
+                bool IsEmpty(size_t consumer) const {
+                    size_t pos = m_Consumers[consumer].cursor.load(std::memory_order_relaxed);
+                    return m_Slots[pos & m_Mask].sequence.load(std::memory_order_acquire) != pos + 1;
+                }
+
+                /**
+                 * @brief Vérifie si aucun consommateur n'a rien à lire
+                 */
+                bool IsEmpty() const {
+                    for (size_t i = 0; i < m_ConsumerCount; ++i) {
+                        if (!IsEmpty(i)) return false;
+                    }
+                    return true;
+                }
+
+                // ---------------------------------------------------------------------
+                // CONFIGURATION DES CONSOMMATEURS
+                // ---------------------------------------------------------------------
+
+                /**
+                 * @brief Rend un consommateur tolérant aux pertes (ou bloquant)
+                 * @param consumer Index du consommateur
+                 * @param lossy true: dépassé quand il retient les producteurs
+                 */
+                void SetLossy(size_t consumer, bool lossy) {
+                    m_Consumers[consumer].lossy.store(lossy, std::memory_order_relaxed);
+                }
+
+                /**
+                 * @brief Indique si un consommateur est tolérant aux pertes
+                 */
+                bool IsLossy(size_t consumer) const {
+                    return m_Consumers[consumer].lossy.load(std::memory_order_relaxed);
+                }
+
+                /**
+                 * @brief Nombre d'éléments sautés pour un consommateur
+                 */
+                uint64 GetSkipped(size_t consumer) const {
+                    return m_Consumers[consumer].skipped.load(std::memory_order_relaxed);
+                }
+
+                /**
+                 * @brief Remet les compteurs d'éléments sautés à zéro
+                 */
+                void ResetSkipped() {
+                    for (size_t i = 0; i < m_ConsumerCount; ++i) {
+                        m_Consumers[i].skipped.store(0, std::memory_order_relaxed);
+                    }
+                }
+
+                // ---------------------------------------------------------------------
+                // INFORMATIONS
+                // ---------------------------------------------------------------------
+
+                /**
+                 * @brief Obtient la capacité réelle de la file
+                 */
+                size_t Capacity() const {
+                    return m_Capacity;
+                }
+
+                /**
+                 * @brief Obtient le nombre de consommateurs
+                 */
+                size_t ConsumerCount() const {
+                    return m_ConsumerCount;
+                }
+
+                /**
+                 * @brief Éléments en attente pour un consommateur (approximatif)
+                 */
+                size_t SizeApprox(size_t consumer) const {
+                    size_t cursor = m_Consumers[consumer].cursor.load(std::memory_order_relaxed);
+                    size_t enqueuePos = m_EnqueuePos.load(std::memory_order_relaxed);
+                    return enqueuePos > cursor ? enqueuePos - cursor : 0;
+                }
+
+                /**
+                 * @brief Éléments en attente pour le consommateur le plus en retard
+                 */
+                size_t SizeApprox() const {
+                    size_t size = 0;
+                    for (size_t i = 0; i < m_ConsumerCount; ++i) {
+                        size_t pending = SizeApprox(i);
+                        if (pending > size) size = pending;
+                    }
+                    return size;
+                }
+
+                /**
+                 * @brief Position du prochain élément réservé par un producteur
+                 *
+                 * Tout élément poussé avant cet appel a une position inférieure.
+                 */
+                size_t GetWritePosition() const {
+                    return m_EnqueuePos.load(std::memory_order_seq_cst);
+                }
+
+                /**
+                 * @brief Position du prochain élément lu par un consommateur
+                 * @param consumer Index du consommateur
+                 */
+                size_t GetReadPosition(size_t consumer) const {
+                    return m_Consumers[consumer].cursor.load(std::memory_order_acquire);
+                }
+
+            private:
+                // ---------------------------------------------------------------------
+                // TYPES PRIVÉS
+                // ---------------------------------------------------------------------
+
+                /// Slot: séquence, lecteurs restants et valeur préallouée
+                struct Slot {
+                    std::atomic<size_t> sequence;
+                    std::atomic<uint32> remaining;
+                    T value;
+                };
+
+                /// État d'un consommateur, seul sur sa ligne de cache
+                struct alignas(LOGGER_CACHE_LINE_SIZE) Consumer {
+                    /// Prochaine position à lire
+                    std::atomic<size_t> cursor{0};
+
+                    /// Dépassé par les producteurs plutôt que de les bloquer
+                    std::atomic<bool> lossy{false};
+
+                    /// Éléments sautés (dépassements)
+                    std::atomic<uint64> skipped{0};
+                };
+
+                // ---------------------------------------------------------------------
+                // MÉTHODES PRIVÉES
+                // ---------------------------------------------------------------------
+
+                /**
+                 * @brief Libère une position lue; le dernier lecteur rend le slot
+                 */
+                void Release(size_t pos) {
+                    Slot& slot = m_Slots[pos & m_Mask];
+                    if (m_ConsumerCount == 1 ||
+                        slot.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                        slot.sequence.store(pos + m_Capacity, std::memory_order_release);
+                    }
+                }
+
+                /**
+                 * @brief Saute la position donnée pour les consommateurs arrêtés dessus
+                 * @param pos Position publiée la plus ancienne
+                 * @param lossyOnly Ne dépasser que les consommateurs tolérants aux pertes
+                 * @return true si au moins un consommateur a été dépassé
+                 */
+                bool SkipLaggingConsumers(size_t pos, bool lossyOnly) {
+                    // Position pas (encore) publiée: rien à sauter
+                    if (m_Slots[pos & m_Mask].sequence.load(std::memory_order_acquire) != pos + 1) {
+                        return false;
+                    }
+
+                    bool skipped = false;
+                    for (size_t i = 0; i < m_ConsumerCount; ++i) {
+                        Consumer& consumer = m_Consumers[i];
+                        if (lossyOnly && !consumer.lossy.load(std::memory_order_relaxed)) {
+                            continue;
+                        }
+
+                        size_t expected = pos;
+                        if (consumer.cursor.compare_exchange_strong(expected, pos + 1, std::memory_order_acq_rel)) {
+                            consumer.skipped.fetch_add(1, std::memory_order_relaxed);
+                            Release(pos);
+                            skipped = true;
+                        }
+                    }
+                    return skipped;
+                }
+
+                /**
+                 * @brief Arrondit à la puissance de 2 supérieure
+                 */
+                static size_t RoundUpToPowerOfTwo(size_t value) {
+                    size_t result = 1;
+                    while (result < value) result <<= 1;
+                    return result;
+                }
+
+                // ---------------------------------------------------------------------
+                // VARIABLES MEMBRE PRIVÉES
+                // ---------------------------------------------------------------------
+
+                /// Nombre de slots (puissance de 2)
+                const size_t m_Capacity;
+
+                /// Masque d'indexation (capacité - 1)
+                const size_t m_Mask;
+
+                /// Nombre de consommateurs
+                const size_t m_ConsumerCount;
+
+                /// Slots préalloués
+                std::unique_ptr<Slot[]> m_Slots;
+
+                /// Curseurs des consommateurs
+                std::unique_ptr<Consumer[]> m_Consumers;
+
+                /// Position d'écriture partagée par les producteurs
+                alignas(LOGGER_CACHE_LINE_SIZE) std::atomic<size_t> m_EnqueuePos;
+        };
+
+    } // namespace logger
+} // namespace nkentseu
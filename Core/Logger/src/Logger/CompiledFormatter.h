@@ -0,0 +1,322 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/CompiledFormatter.h
+// DESCRIPTION: Formatter dont le pattern est analysé à la compilation. Chaque
+//              pattern produit un type spécialisé: segments littéraux joints,
+//              tokens déroulés et traités sans switch à l'exécution.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Logger/Formatter.h"
+#include "Logger/FormatUtils.h"
+#include "Logger/LogLevel.h"
+#include "Logger/LogMessage.h"
+#include <array>
+#include <string>
+#include <utility>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        namespace compiled {
+
+            // ---------------------------------------------------------------------
+            // ANALYSE DU PATTERN À LA COMPILATION
+            // ---------------------------------------------------------------------
+
+            /// Token d'un pattern compilé
+            struct CompiledToken {
+                /// Type du token
+                PatternToken::Type type = PatternToken::Type::Literal;
+
+                /// Début du texte dans le pool de littéraux (tokens Literal)
+                size_t offset = 0;
+
+                /// Longueur du texte (tokens Literal)
+                size_t length = 0;
+            };
+
+            /// Résultat de la lecture d'un élément de pattern
+            struct ScannedToken {
+                PatternToken::Type type;
+                size_t literalStart;
+                size_t literalLength;
+                size_t next;
+            };
+
+            /// Séquence remplacée par le token DateTime
+            constexpr char DATE_TIME_SEQUENCE[] = "%Y-%m-%d %H:%M:%S";
+
+            /**
+             * @brief Longueur d'une chaîne à la compilation
+             */
+            constexpr size_t Length(const char* text) {
+                size_t length = 0;
+                while (text[length] != '\0') ++length;
+                return length;
+            }
+
+            /**
+             * @brief Vérifie si text commence par prefix à la position pos
+             */
+            constexpr bool StartsWith(const char* text, size_t pos, const char* prefix) {
+                for (size_t i = 0; prefix[i] != '\0'; ++i) {
+                    if (text[pos + i] != prefix[i]) return false;
+                }
+                return true;
+            }
+
+            /**
+             * @brief Type de token associé à un caractère après '%'
+             * @return true si le caractère désigne un token connu
+             */
+            constexpr bool TokenFromChar(char c, PatternToken::Type& type) {
+                using Type = PatternToken::Type;
+                switch (c) {
+                    case 'Y': type = Type::Year; return true;
+                    case 'm': type = Type::Month; return true;
+                    case 'd': type = Type::Day; return true;
+                    case 'H': type = Type::Hour; return true;
+                    case 'M': type = Type::Minute; return true;
+                    case 'S': type = Type::Second; return true;
+                    case 'e': type = Type::Millis; return true;
+                    case 'f': type = Type::Micros; return true;
+                    case 'l': type = Type::Level; return true;
+                    case 'L': type = Type::LevelShort; return true;
+                    case 't': type = Type::ThreadId; return true;
+                    case 'T': type = Type::ThreadName; return true;
+                    case 's': type = Type::SourceFile; return true;
+                    case '#': type = Type::SourceLine; return true;
+                    case 'F': type = Type::Function; return true;
+                    case 'v': type = Type::Message; return true;
+                    case 'n': type = Type::LoggerName; return true;
+                    case '^': type = Type::ColorStart; return true;
+                    case '$': type = Type::ColorEnd; return true;
+                    default: return false;
+                }
+            }
+
+            /**
+             * @brief Lit l'élément de pattern commençant à pos
+             *
+             * Mêmes règles que Formatter::ParsePattern: "%%" donne '%', une
+             * séquence inconnue "%x" reste littérale, la séquence date-heure
+             * complète devient un token DateTime.
+             */
+            constexpr ScannedToken Scan(const char* pattern, size_t pos) {
+                using Type = PatternToken::Type;
+
+                if (pattern[pos] == '%' && pattern[pos + 1] != '\0') {
+                    if (StartsWith(pattern, pos, DATE_TIME_SEQUENCE)) {
+                        return { Type::DateTime, 0, 0, pos + Length(DATE_TIME_SEQUENCE) };
+                    }
+                    if (pattern[pos + 1] == '%') {
+                        return { Type::Literal, pos + 1, 1, pos + 2 };
+                    }
+
+                    Type type = Type::Literal;
+                    if (TokenFromChar(pattern[pos + 1], type)) {
+                        return { type, 0, 0, pos + 2 };
+                    }
+                    return { Type::Literal, pos, 2, pos + 2 };
+                }
+
+                size_t end = pos + 1;
+                while (pattern[end] != '\0' && pattern[end] != '%') ++end;
+                return { Type::Literal, pos, end - pos, end };
+            }
+
+            /**
+             * @brief Nombre de tokens après fusion des littéraux adjacents
+             */
+            constexpr size_t CountTokens(const char* pattern) {
+                size_t count = 0;
+                bool previousLiteral = false;
+
+                for (size_t pos = 0; pattern[pos] != '\0';) {
+                    ScannedToken token = Scan(pattern, pos);
+                    bool literal = token.type == PatternToken::Type::Literal;
+                    if (!(literal && previousLiteral)) ++count;
+                    previousLiteral = literal;
+                    pos = token.next;
+                }
+
+                return count;
+            }
+
+            /// Pattern analysé: tokens + littéraux joints bout à bout
+            template <size_t TokenCount, size_t PoolSize>
+            struct CompiledPattern {
+                std::array<CompiledToken, TokenCount> tokens = {};
+                std::array<char, PoolSize> literals = {};
+            };
+
+            /**
+             * @brief Analyse complète d'un pattern
+             */
+            template <size_t TokenCount, size_t PoolSize>
+            constexpr CompiledPattern<TokenCount, PoolSize> Compile(const char* pattern) {
+                CompiledPattern<TokenCount, PoolSize> result;
+                size_t tokenIndex = 0;
+                size_t poolSize = 0;
+                bool previousLiteral = false;
+
+                for (size_t pos = 0; pattern[pos] != '\0';) {
+                    ScannedToken token = Scan(pattern, pos);
+                    bool literal = token.type == PatternToken::Type::Literal;
+
+                    if (literal) {
+                        if (!previousLiteral) {
+                            result.tokens[tokenIndex].type = PatternToken::Type::Literal;
+                            result.tokens[tokenIndex].offset = poolSize;
+                            result.tokens[tokenIndex].length = 0;
+                            ++tokenIndex;
+                        }
+                        for (size_t i = 0; i < token.literalLength; ++i) {
+                            result.literals[poolSize++] = pattern[token.literalStart + i];
+                        }
+                        result.tokens[tokenIndex - 1].length += token.literalLength;
+                    } else {
+                        result.tokens[tokenIndex].type = token.type;
+                        ++tokenIndex;
+                    }
+
+                    previousLiteral = literal;
+                    pos = token.next;
+                }
+
+                return result;
+            }
+
+        } // namespace compiled
+
+        // -------------------------------------------------------------------------
+        // CLASSE: CompiledFormatter
+        // DESCRIPTION: Formatter spécialisé pour un pattern connu à la compilation.
+        //              Le pattern doit être un tableau constexpr à lien externe
+        //              (voir patterns:: dans Pattern.h):
+        //
+        //                  std::string line = CompiledFormatter<patterns::Default>::Format(msg);
+        //
+        //              Le Formatter interprété reste la solution pour les patterns
+        //              définis à l'exécution; il délègue automatiquement aux patterns
+        //              prédéfinis compilés.
+        // -------------------------------------------------------------------------
+        template <const char* Pattern>
+        class CompiledFormatter {
+            public:
+                /**
+                 * @brief Ajoute la ligne formatée à result
+                 * @param message Message à formater
+                 * @param useColors true pour inclure les codes couleur
+                 * @param result Résultat en construction
+                 */
+                static void FormatTo(const LogMessage& message, bool useColors, std::string& result) {
+                    FormatAll(message, useColors, result, std::make_index_sequence<TOKEN_COUNT>());
+                }
+
+                /**
+                 * @brief Formate un message
+                 * @param message Message à formater
+                 * @param useColors true pour inclure les codes couleur
+                 * @return Ligne formatée
+                 */
+                static std::string Format(const LogMessage& message, bool useColors = false) {
+                    std::string result;
+                    result.reserve(256);
+                    FormatTo(message, useColors, result);
+                    return result;
+                }
+
+                /**
+                 * @brief Obtient le pattern source
+                 * @return Pattern
+                 */
+                static constexpr const char* GetPattern() {
+                    return Pattern;
+                }
+
+            private:
+                /// Nombre de tokens après fusion
+                static constexpr size_t TOKEN_COUNT = compiled::CountTokens(Pattern);
+
+                /// Taille du pool de littéraux (majorée par la longueur du pattern)
+                static constexpr size_t POOL_SIZE = compiled::Length(Pattern) + 1;
+
+                /// Pattern analysé
+                static constexpr compiled::CompiledPattern<TOKEN_COUNT, POOL_SIZE> COMPILED =
+                    compiled::Compile<TOKEN_COUNT, POOL_SIZE>(Pattern);
+
+                template <size_t... Indices>
+                static void FormatAll(const LogMessage& message, bool useColors, std::string& result,
+                                    std::index_sequence<Indices...>) {
+                    (FormatToken<Indices>(message, useColors, result), ...);
+                }
+
+                /**
+                 * @brief Formate le token Index (choisi à la compilation)
+                 */
+                template <size_t Index>
+                static void FormatToken(const LogMessage& message, bool useColors, std::string& result) {
+                    using Type = PatternToken::Type;
+                    constexpr compiled::CompiledToken token = COMPILED.tokens[Index];
+
+                    if constexpr (token.type == Type::Literal) {
+                        result.append(COMPILED.literals.data() + token.offset, token.length);
+                    } else if constexpr (token.type == Type::DateTime) {
+                        result.append(GetCachedDateTime(message), DATE_TIME_LENGTH);
+                    } else if constexpr (token.type == Type::Year) {
+                        AppendNumber(result, GetCachedLocalTime(message).tm_year + 1900, 4);
+                    } else if constexpr (token.type == Type::Month) {
+                        AppendNumber(result, GetCachedLocalTime(message).tm_mon + 1, 2);
+                    } else if constexpr (token.type == Type::Day) {
+                        AppendNumber(result, GetCachedLocalTime(message).tm_mday, 2);
+                    } else if constexpr (token.type == Type::Hour) {
+                        AppendNumber(result, GetCachedLocalTime(message).tm_hour, 2);
+                    } else if constexpr (token.type == Type::Minute) {
+                        AppendNumber(result, GetCachedLocalTime(message).tm_min, 2);
+                    } else if constexpr (token.type == Type::Second) {
+                        AppendNumber(result, GetCachedLocalTime(message).tm_sec, 2);
+                    } else if constexpr (token.type == Type::Millis) {
+                        AppendNumber(result, message.GetMillis() % 1000, 3);
+                    } else if constexpr (token.type == Type::Micros) {
+                        AppendNumber(result, message.GetMicros() % 1000000, 6);
+                    } else if constexpr (token.type == Type::Level) {
+                        result += LogLevelToString(message.level);
+                    } else if constexpr (token.type == Type::LevelShort) {
+                        result += LogLevelToShortString(message.level);
+                    } else if constexpr (token.type == Type::ThreadId) {
+                        AppendNumber(result, message.threadId);
+                    } else if constexpr (token.type == Type::ThreadName) {
+                        if (message.threadName[0] != '\0') {
+                            result += message.threadName;
+                        } else {
+                            AppendNumber(result, message.threadId);
+                        }
+                    } else if constexpr (token.type == Type::SourceFile) {
+                        result += ExtractFileName(message.sourceFile);
+                    } else if constexpr (token.type == Type::SourceLine) {
+                        if (message.sourceLine > 0) {
+                            AppendNumber(result, message.sourceLine);
+                        }
+                    } else if constexpr (token.type == Type::Function) {
+                        result += message.functionName;
+                    } else if constexpr (token.type == Type::Message) {
+                        result.append(message.message.Data(), message.message.Size());
+                    } else if constexpr (token.type == Type::LoggerName) {
+                        result += message.loggerName[0] != '\0' ? message.loggerName : "default";
+                    } else if constexpr (token.type == Type::ColorStart) {
+                        if (useColors) result += LogLevelToANSIColorCode(message.level);
+                    } else if constexpr (token.type == Type::ColorEnd) {
+                        if (useColors) result += ANSIResetCode();
+                    }
+                }
+        };
+
+    } // namespace logger
+} // namespace nkentseu
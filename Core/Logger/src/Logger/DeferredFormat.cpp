@@ -0,0 +1,418 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/DeferredFormat.cpp
+// DESCRIPTION: Production du texte des messages à arguments capturés.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#include "Logger/DeferredFormat.h"
+#include <cstdio>
+#include <cstring>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        namespace {
+
+            /// Texte produit pour un argument de type incompatible avec sa conversion
+            const char MISMATCH_TEXT[] = "(?)";
+
+            /// Argument capturé relu
+            struct CapturedArg {
+                deferred::ArgType type = deferred::ArgType::Int;
+                size_t width = sizeof(uint64);
+                uint64 bits = 0;
+                bool hasAddress = false;
+                const char* text = nullptr;
+                size_t length = 0;
+            };
+
+            // ---------------------------------------------------------------------
+            // Lecture séquentielle des arguments capturés
+            // ---------------------------------------------------------------------
+            class ArgReader {
+                public:
+                    ArgReader(const char* payload, size_t size)
+                        : m_Cursor(payload), m_End(payload + size) {
+                    }
+
+                    /**
+                     * @brief Lit l'argument suivant
+                     * @return false s'il n'en reste plus
+                     */
+                    bool Next(CapturedArg& arg) {
+                        if (m_Cursor >= m_End) {
+                            return false;
+                        }
+
+                        const uint8 tag = static_cast<uint8>(*m_Cursor++);
+                        const size_t width = tag >> deferred::WIDTH_SHIFT;
+                        arg.type = static_cast<deferred::ArgType>(tag & deferred::TYPE_MASK);
+                        arg.width = width != 0 ? width : sizeof(uint64);
+                        arg.hasAddress = false;
+
+                        if (arg.type == deferred::ArgType::String) {
+                            // Chaîne C: son adresse précède la longueur
+                            arg.hasAddress = width != 0;
+                            if (arg.hasAddress) {
+                                if (static_cast<size_t>(m_End - m_Cursor) < sizeof(arg.bits)) {
+                                    return Invalid();
+                                }
+                                std::memcpy(&arg.bits, m_Cursor, sizeof(arg.bits));
+                                m_Cursor += sizeof(arg.bits);
+                            }
+
+                            uint32 length = 0;
+                            if (static_cast<size_t>(m_End - m_Cursor) < sizeof(length)) {
+                                return Invalid();
+                            }
+                            std::memcpy(&length, m_Cursor, sizeof(length));
+                            m_Cursor += sizeof(length);
+
+                            if (static_cast<size_t>(m_End - m_Cursor) < static_cast<size_t>(length) + 1) {
+                                return Invalid();
+                            }
+                            arg.text = m_Cursor;
+                            arg.length = length;
+                            m_Cursor += length + 1;
+                            return true;
+                        }
+
+                        if (static_cast<size_t>(m_End - m_Cursor) < sizeof(arg.bits)) {
+                            return Invalid();
+                        }
+                        std::memcpy(&arg.bits, m_Cursor, sizeof(arg.bits));
+                        m_Cursor += sizeof(arg.bits);
+                        return true;
+                    }
+
+                private:
+                    /// Capture tronquée: plus aucun argument
+                    bool Invalid() {
+                        m_Cursor = m_End;
+                        return false;
+                    }
+
+                    const char* m_Cursor;
+                    const char* m_End;
+            };
+
+            /**
+             * @brief Valeur entière signée d'un argument
+             */
+            int64 AsInt(const CapturedArg& arg) {
+                switch (arg.type) {
+                    case deferred::ArgType::Double: {
+                        double number = 0.0;
+                        std::memcpy(&number, &arg.bits, sizeof(number));
+                        return static_cast<int64>(number);
+                    }
+                    case deferred::ArgType::String:
+                        return 0;
+                    default:
+                        return static_cast<int64>(arg.bits);
+                }
+            }
+
+            /**
+             * @brief Valeur non signée d'un argument, sur sa taille ou celle du modificateur
+             * @param modifierWidth 1 pour hh, 2 pour h, 0 sans effet
+             */
+            uint64 AsUnsigned(const CapturedArg& arg, size_t modifierWidth) {
+                uint64 value = arg.type == deferred::ArgType::Double ?
+                    static_cast<uint64>(AsInt(arg)) : arg.bits;
+
+                size_t width = arg.width;
+                if (modifierWidth != 0 && modifierWidth < width) {
+                    width = modifierWidth;
+                }
+                if (width < sizeof(uint64)) {
+                    value &= (uint64(1) << (width * 8)) - 1;
+                }
+                return value;
+            }
+
+            /**
+             * @brief Valeur signée d'un argument, tronquée par h ou hh
+             * @param modifierWidth 1 pour hh, 2 pour h, 0 sans effet
+             */
+            int64 AsSigned(const CapturedArg& arg, size_t modifierWidth) {
+                const int64 value = AsInt(arg);
+                if (modifierWidth == 1) {
+                    return static_cast<signed char>(value);
+                }
+                if (modifierWidth == 2) {
+                    return static_cast<short>(value);
+                }
+                return value;
+            }
+
+            /**
+             * @brief Valeur réelle d'un argument
+             */
+            double AsDouble(const CapturedArg& arg) {
+                switch (arg.type) {
+                    case deferred::ArgType::Double: {
+                        double number = 0.0;
+                        std::memcpy(&number, &arg.bits, sizeof(number));
+                        return number;
+                    }
+                    case deferred::ArgType::Int:
+                        return static_cast<double>(static_cast<int64>(arg.bits));
+                    case deferred::ArgType::String:
+                        return 0.0;
+                    default:
+                        return static_cast<double>(arg.bits);
+                }
+            }
+
+            /**
+             * @brief Ajoute une conversion printf d'une seule valeur
+             *
+             * Les textes courts passent par la pile; les autres sont formatés
+             * directement dans le tampon agrandi.
+             */
+            template <typename T>
+            void AppendConversion(MessageBuffer& out, const char* spec, T value) {
+                char local[128];
+                const int size = std::snprintf(local, sizeof(local), spec, value);
+                if (size < 0) {
+                    return;
+                }
+                if (static_cast<size_t>(size) < sizeof(local)) {
+                    out.Append(local, static_cast<size_t>(size));
+                    return;
+                }
+
+                char* target = out.Extend(static_cast<size_t>(size));
+                std::snprintf(target, static_cast<size_t>(size) + 1, spec, value);
+            }
+
+            /// Spécification printf reconstruite (drapeaux, largeur, précision, conversion)
+            struct Spec {
+                char text[48];
+                size_t length = 0;
+
+                /// Ajoute un caractère (ignoré au-delà de la capacité)
+                void Put(char c) {
+                    if (length + 4 < sizeof(text)) {
+                        text[length++] = c;
+                    }
+                }
+
+                /// Ajoute un entier décimal
+                void PutNumber(int value) {
+                    char digits[16];
+                    const int count = std::snprintf(digits, sizeof(digits), "%d", value);
+                    for (int i = 0; i < count; ++i) {
+                        Put(digits[i]);
+                    }
+                }
+
+                /// Termine par le modificateur et la conversion voulus
+                const char* Finish(const char* suffix) {
+                    size_t i = length;
+                    for (; *suffix && i + 1 < sizeof(text); ++suffix) {
+                        text[i++] = *suffix;
+                    }
+                    text[i] = '\0';
+                    return text;
+                }
+            };
+
+            /**
+             * @brief Indique si c est un chiffre décimal
+             */
+            bool IsDigit(char c) {
+                return c >= '0' && c <= '9';
+            }
+
+        } // namespace
+
+        /**
+         * @brief Produit le texte d'un message capturé
+         */
+        void FormatDeferred(const char* format, const char* payload, size_t size, MessageBuffer& out) {
+            out.Clear();
+            if (format == nullptr) {
+                return;
+            }
+
+            ArgReader args(payload, size);
+            const char* cursor = format;
+
+            while (*cursor != '\0') {
+                // Texte littéral jusqu'à la prochaine spécification
+                const char* percent = std::strchr(cursor, '%');
+                if (percent == nullptr) {
+                    out.Append(cursor, std::strlen(cursor));
+                    break;
+                }
+                out.Append(cursor, static_cast<size_t>(percent - cursor));
+                cursor = percent + 1;
+
+                if (*cursor == '%') {
+                    out.Append("%", 1);
+                    ++cursor;
+                    continue;
+                }
+
+                Spec spec;
+                spec.Put('%');
+                bool missing = false;
+                CapturedArg arg;
+
+                // Drapeaux
+                while (*cursor != '\0' && std::strchr("-+ #0", *cursor) != nullptr) {
+                    spec.Put(*cursor++);
+                }
+
+                // Largeur (littérale ou '*')
+                if (*cursor == '*') {
+                    ++cursor;
+                    if (args.Next(arg)) {
+                        spec.PutNumber(static_cast<int>(AsInt(arg)));
+                    } else {
+                        missing = true;
+                    }
+                } else {
+                    while (IsDigit(*cursor)) {
+                        spec.Put(*cursor++);
+                    }
+                }
+
+                // Précision (littérale ou '*', négative = absente)
+                if (*cursor == '.') {
+                    ++cursor;
+                    if (*cursor == '*') {
+                        ++cursor;
+                        if (args.Next(arg)) {
+                            const int precision = static_cast<int>(AsInt(arg));
+                            if (precision >= 0) {
+                                spec.Put('.');
+                                spec.PutNumber(precision);
+                            }
+                        } else {
+                            missing = true;
+                        }
+                    } else {
+                        spec.Put('.');
+                        while (IsDigit(*cursor)) {
+                            spec.Put(*cursor++);
+                        }
+                    }
+                }
+
+                // Modificateurs de longueur: la taille vient de la valeur capturée,
+                // seuls h (short) et hh (char) la réduisent
+                size_t modifierWidth = 0;
+                if (cursor[0] == 'h') {
+                    modifierWidth = cursor[1] == 'h' ? 1 : 2;
+                }
+                while (*cursor != '\0' && std::strchr("hljztLq", *cursor) != nullptr) {
+                    ++cursor;
+                }
+
+                const char conversion = *cursor;
+                if (conversion == '\0') {
+                    // Spécification incomplète en fin de format: recopiée
+                    out.Append(percent, static_cast<size_t>(cursor - percent));
+                    break;
+                }
+                ++cursor;
+
+                if (conversion == 'n') {
+                    args.Next(arg);
+                    continue;
+                }
+
+                if (missing || !args.Next(arg)) {
+                    out.Append(percent, static_cast<size_t>(cursor - percent));
+                    continue;
+                }
+
+                const bool isString = arg.type == deferred::ArgType::String;
+
+                switch (conversion) {
+                    case 'd':
+                    case 'i':
+                        if (isString) {
+                            out.Append(MISMATCH_TEXT, sizeof(MISMATCH_TEXT) - 1);
+                        } else {
+                            AppendConversion(out, spec.Finish("lld"),
+                                             static_cast<long long>(AsSigned(arg, modifierWidth)));
+                        }
+                        break;
+
+                    case 'u':
+                    case 'o':
+                    case 'x':
+                    case 'X': {
+                        const char suffix[] = { 'l', 'l', conversion, '\0' };
+                        if (isString) {
+                            out.Append(MISMATCH_TEXT, sizeof(MISMATCH_TEXT) - 1);
+                        } else {
+                            AppendConversion(out, spec.Finish(suffix),
+                                             static_cast<unsigned long long>(AsUnsigned(arg, modifierWidth)));
+                        }
+                        break;
+                    }
+
+                    case 'c':
+                        if (isString) {
+                            out.Append(MISMATCH_TEXT, sizeof(MISMATCH_TEXT) - 1);
+                        } else {
+                            AppendConversion(out, spec.Finish("c"), static_cast<int>(AsInt(arg)));
+                        }
+                        break;
+
+                    case 'e':
+                    case 'E':
+                    case 'f':
+                    case 'F':
+                    case 'g':
+                    case 'G':
+                    case 'a':
+                    case 'A': {
+                        const char suffix[] = { conversion, '\0' };
+                        if (isString) {
+                            out.Append(MISMATCH_TEXT, sizeof(MISMATCH_TEXT) - 1);
+                        } else {
+                            AppendConversion(out, spec.Finish(suffix), AsDouble(arg));
+                        }
+                        break;
+                    }
+
+                    case 's':
+                        if (!isString) {
+                            out.Append(MISMATCH_TEXT, sizeof(MISMATCH_TEXT) - 1);
+                        } else if (spec.length == 1) {
+                            // %s simple: copie directe
+                            out.Append(arg.text, arg.length);
+                        } else {
+                            AppendConversion(out, spec.Finish("s"), arg.text);
+                        }
+                        break;
+
+                    case 'p':
+                        if (isString && !arg.hasAddress) {
+                            out.Append(MISMATCH_TEXT, sizeof(MISMATCH_TEXT) - 1);
+                        } else {
+                            AppendConversion(out, spec.Finish("p"),
+                                             reinterpret_cast<void*>(static_cast<uintptr_t>(arg.bits)));
+                        }
+                        break;
+
+                    default:
+                        // Conversion inconnue: recopiée telle quelle
+                        out.Append(percent, static_cast<size_t>(cursor - percent));
+                        break;
+                }
+            }
+        }
+
+    } // namespace logger
+} // namespace nkentseu
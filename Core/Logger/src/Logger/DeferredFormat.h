@@ -0,0 +1,237 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/DeferredFormat.h
+// DESCRIPTION: Capture typée des arguments d'un format printf. Les arguments
+//              sont copiés dans le tampon du message; le texte n'est produit
+//              qu'au moment de l'écriture (thread de traitement de AsyncLogger).
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Logger/Export.h"
+#include "Logger/MessageBuffer.h"
+#include <Nkentseu/Types.h>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        namespace deferred {
+
+            // ---------------------------------------------------------------------
+            // FORMAT DE CAPTURE
+            //
+            // Chaque argument occupe dans le tampon du message:
+            //
+            //   Entier, réel, pointeur : u8 type | 8 octets (valeur brute)
+            //   Chaîne C++             : u8 type | u32 longueur | octets | '\0'
+            //   Chaîne C               : u8 type | 8 octets (adresse) | u32 longueur
+            //                            | octets | '\0'
+            //
+            // Les 4 bits de poids fort de l'octet de type portent la taille de
+            // l'argument après promotion (comme un argument variadique): %u, %x
+            // et %o masquent un entier négatif à cette taille, comme printf.
+            // Pour une chaîne C, ils valent 8 et l'adresse suit (%p). Une
+            // capture sans taille (0) est lue comme 8 octets, sans adresse.
+            //
+            // Le format lui-même n'est pas copié: seule son adresse est conservée
+            // (LogMessage::deferredFormat), il doit donc être un littéral ou une
+            // chaîne à durée de vie statique.
+            // ---------------------------------------------------------------------
+
+            /// Type d'un argument capturé
+            enum class ArgType : uint8 {
+                /// Entier signé (int64)
+                Int = 1,
+
+                /// Entier non signé (uint64)
+                UInt = 2,
+
+                /// Réel (double)
+                Double = 3,
+
+                /// Pointeur (%p)
+                Pointer = 4,
+
+                /// Chaîne copiée
+                String = 5
+            };
+
+            /// Bits de l'octet de type qui portent le type
+            constexpr uint8 TYPE_MASK = 0x0F;
+
+            /// Décalage de la taille dans l'octet de type
+            constexpr int WIDTH_SHIFT = 4;
+
+            /// Taille d'un argument scalaire capturé
+            constexpr size_t SCALAR_SIZE = 1 + sizeof(uint64);
+
+            /// Type réduit d'un argument (tableaux et fonctions décayés)
+            template <typename T>
+            using Decayed = std::decay_t<T>;
+
+            /// Chaînes C acceptées (copiées à la capture)
+            template <typename T>
+            constexpr bool IsCString = std::is_same<Decayed<T>, const char*>::value ||
+                                       std::is_same<Decayed<T>, char*>::value;
+
+            /// Chaînes C++ acceptées (copiées à la capture)
+            template <typename T>
+            constexpr bool IsStdString = std::is_same<Decayed<T>, std::string>::value ||
+                                         std::is_same<Decayed<T>, std::string_view>::value;
+
+            /// Types acceptés par la capture
+            template <typename T>
+            constexpr bool IsSupported = std::is_arithmetic<Decayed<T>>::value ||
+                                         std::is_enum<Decayed<T>>::value ||
+                                         std::is_pointer<Decayed<T>>::value ||
+                                         std::is_null_pointer<Decayed<T>>::value ||
+                                         IsStdString<T>;
+
+            /**
+             * @brief Texte d'un argument chaîne ("(null)" pour un pointeur nul)
+             */
+            template <typename T>
+            inline std::string_view StringOf(const T& value) {
+                if constexpr (IsCString<T>) {
+                    const char* text = value;
+                    return text ? std::string_view(text) : std::string_view("(null)");
+                } else {
+                    return std::string_view(value);
+                }
+            }
+
+            /**
+             * @brief Nombre d'octets occupés par un argument capturé
+             */
+            template <typename T>
+            inline size_t EncodedSize(const T& value) {
+                static_assert(IsSupported<T>,
+                    "Argument non capturable: utiliser un entier, un réel, une enum, "
+                    "un pointeur, une chaîne C, std::string ou std::string_view");
+
+                if constexpr (IsCString<T>) {
+                    return 1 + sizeof(uint64) + sizeof(uint32) + StringOf(value).size() + 1;
+                } else if constexpr (IsStdString<T>) {
+                    return 1 + sizeof(uint32) + StringOf(value).size() + 1;
+                } else {
+                    return SCALAR_SIZE;
+                }
+            }
+
+            /**
+             * @brief Octet de type portant aussi la taille de l'argument
+             */
+            inline char TypeByte(ArgType type, size_t width) {
+                return static_cast<char>(static_cast<uint8>(type) | static_cast<uint8>(width << WIDTH_SHIFT));
+            }
+
+            /**
+             * @brief Écrit une valeur scalaire (type et taille + 8 octets)
+             */
+            inline char* WriteScalar(char* out, ArgType type, size_t width, uint64 bits) {
+                *out++ = TypeByte(type, width);
+                std::memcpy(out, &bits, sizeof(bits));
+                return out + sizeof(bits);
+            }
+
+            /**
+             * @brief Écrit un argument capturé
+             * @return Position suivant l'argument
+             */
+            template <typename T>
+            inline char* Encode(char* out, const T& value) {
+                using D = Decayed<T>;
+
+                if constexpr (IsCString<T> || IsStdString<T>) {
+                    const std::string_view text = StringOf(value);
+                    const uint32 length = static_cast<uint32>(text.size());
+
+                    if constexpr (IsCString<T>) {
+                        // Adresse conservée pour %p
+                        const uint64 address = static_cast<uint64>(reinterpret_cast<uintptr_t>(
+                            static_cast<const void*>(value)));
+                        *out++ = TypeByte(ArgType::String, sizeof(address));
+                        std::memcpy(out, &address, sizeof(address));
+                        out += sizeof(address);
+                    } else {
+                        *out++ = TypeByte(ArgType::String, 0);
+                    }
+                    std::memcpy(out, &length, sizeof(length));
+                    out += sizeof(length);
+                    std::memcpy(out, text.data(), text.size());
+                    out += text.size();
+                    *out++ = '\0';
+                    return out;
+                } else if constexpr (std::is_enum<D>::value) {
+                    return Encode(out, static_cast<std::underlying_type_t<D>>(value));
+                } else if constexpr (std::is_floating_point<D>::value) {
+                    const double number = static_cast<double>(value);
+                    uint64 bits = 0;
+                    std::memcpy(&bits, &number, sizeof(bits));
+                    return WriteScalar(out, ArgType::Double, sizeof(number), bits);
+                } else if constexpr (std::is_pointer<D>::value || std::is_null_pointer<D>::value) {
+                    return WriteScalar(out, ArgType::Pointer, sizeof(uint64),
+                                       static_cast<uint64>(reinterpret_cast<uintptr_t>(
+                                           static_cast<const volatile void*>(value))));
+                } else {
+                    // Taille après promotion: un short ou un char passe comme un int
+                    using Promoted = decltype(+value);
+                    if constexpr (std::is_signed<Promoted>::value) {
+                        return WriteScalar(out, ArgType::Int, sizeof(Promoted),
+                                           static_cast<uint64>(static_cast<int64>(value)));
+                    } else {
+                        return WriteScalar(out, ArgType::UInt, sizeof(Promoted), static_cast<uint64>(value));
+                    }
+                }
+            }
+
+            /**
+             * @brief Capture des arguments dans un tampon (remplace son contenu)
+             * @param out Tampon du message
+             * @param args Arguments à capturer
+             *
+             * Un seul agrandissement au plus: la taille totale est calculée
+             * avant la copie. Reste dans le stockage inline pour quelques
+             * scalaires et chaînes courtes.
+             */
+            template <typename... Args>
+            inline void Capture(MessageBuffer& out, const Args&... args) {
+                out.Clear();
+                if constexpr (sizeof...(Args) > 0) {
+                    const size_t total = (EncodedSize(args) + ...);
+                    char* cursor = out.Extend(total);
+                    ((cursor = Encode(cursor, args)), ...);
+                }
+            }
+
+        } // namespace deferred
+
+        /**
+         * @brief Produit le texte d'un message capturé (sémantique de printf)
+         * @param format Format printf d'origine
+         * @param payload Arguments capturés par deferred::Capture()
+         * @param size Taille des arguments capturés
+         * @param out Texte produit (remplacé)
+         *
+         * Les conversions sont appliquées à la valeur capturée, quel que soit
+         * son type d'origine: un entier passé à %f est converti en réel, les
+         * modificateurs l, ll, z... sont sans effet. Comme printf, %u, %x et
+         * %o lisent un entier négatif sur sa taille d'origine (ffffffff pour
+         * un int valant -1) et h, hh tronquent la valeur. Une chaîne C passée
+         * à %p affiche son adresse. Un argument manquant laisse la
+         * spécification telle quelle; une chaîne attendue mais absente (ou
+         * l'inverse) produit "(?)". %n n'écrit rien.
+         */
+        LOGGER_API void FormatDeferred(const char* format, const char* payload, size_t size, MessageBuffer& out);
+
+    } // namespace logger
+} // namespace nkentseu
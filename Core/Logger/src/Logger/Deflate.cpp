@@ -0,0 +1,1041 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/Deflate.cpp
+// DESCRIPTION: Implémentation du codec DEFLATE et du conteneur gzip.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#include "Logger/Deflate.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <queue>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        namespace {
+
+            // ---------------------------------------------------------------------
+            // CONSTANTES DU FORMAT
+            // ---------------------------------------------------------------------
+
+            /// Fenêtre LZ77 (32 Kio, maximum de DEFLATE)
+            const size_t WINDOW_SIZE = 32768;
+            const size_t WINDOW_MASK = WINDOW_SIZE - 1;
+
+            /// Longueurs de correspondance
+            const size_t MIN_MATCH = 3;
+            const size_t MAX_MATCH = 258;
+
+            /// Octets à garder devant la position pour chercher une correspondance
+            const size_t MIN_LOOKAHEAD = MAX_MATCH + MIN_MATCH + 1;
+
+            /// Distance maximale utilisée (marge de zlib sous la fenêtre)
+            const size_t MAX_DISTANCE = WINDOW_SIZE - MIN_LOOKAHEAD;
+
+            /// Table de hachage des préfixes de 3 octets
+            const uint32 HASH_BITS = 15;
+            const size_t HASH_SIZE = size_t(1) << HASH_BITS;
+
+            /// Position absente des chaînes
+            const uint32 NIL = 0xFFFFFFFFu;
+
+            /// Symboles par bloc Huffman
+            const size_t BLOCK_SYMBOLS = 16384;
+
+            /// Tailles des alphabets
+            const int LITERAL_CODES = 286;
+            const int DISTANCE_CODES = 30;
+            const int LENGTH_CODES = 19;
+            const int END_OF_BLOCK = 256;
+
+            /// Longueurs maximales des codes
+            const int MAX_BITS = 15;
+            const int MAX_LENGTH_BITS = 7;
+
+            const uint16 LENGTH_BASE[29] = {
+                3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+            };
+            const uint8 LENGTH_EXTRA[29] = {
+                0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+            };
+            const uint16 DISTANCE_BASE[30] = {
+                1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+                257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+            };
+            const uint8 DISTANCE_EXTRA[30] = {
+                0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+                7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+            };
+
+            /// Ordre de transmission des longueurs du code des longueurs
+            const uint8 LENGTH_ORDER[LENGTH_CODES] = {
+                16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15
+            };
+
+            /// Longueur maximale de chaîne parcourue et longueur suffisante par niveau
+            const uint16 CHAIN_LIMIT[10] = { 4, 4, 8, 16, 32, 64, 128, 256, 1024, 4096 };
+            const uint16 NICE_LENGTH[10] = { 8, 8, 16, 32, 64, 128, 128, 258, 258, 258 };
+
+            // ---------------------------------------------------------------------
+            // TABLES DÉRIVÉES
+            // ---------------------------------------------------------------------
+
+            /**
+             * @brief Codes de longueur et de distance, calculés une fois
+             */
+            struct CodeTables {
+                /// Code (0..28) d'une longueur - 3
+                uint8 lengthCode[256];
+
+                /// Code (0..29) d'une distance - 1
+                uint8 distanceCode[WINDOW_SIZE];
+
+                /// Table du CRC-32
+                uint32 crc[256];
+
+                CodeTables() {
+                    for (int code = 0; code < 29; ++code) {
+                        const int count = 1 << LENGTH_EXTRA[code];
+                        for (int i = 0; i < count && LENGTH_BASE[code] + i <= int(MAX_MATCH); ++i) {
+                            lengthCode[LENGTH_BASE[code] + i - MIN_MATCH] = static_cast<uint8>(code);
+                        }
+                    }
+                    for (int code = 0; code < DISTANCE_CODES; ++code) {
+                        const int count = 1 << DISTANCE_EXTRA[code];
+                        for (int i = 0; i < count; ++i) {
+                            distanceCode[DISTANCE_BASE[code] + i - 1] = static_cast<uint8>(code);
+                        }
+                    }
+                    for (uint32 n = 0; n < 256; ++n) {
+                        uint32 c = n;
+                        for (int k = 0; k < 8; ++k) {
+                            c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+                        }
+                        crc[n] = c;
+                    }
+                }
+            };
+
+            const CodeTables& Tables() {
+                static const CodeTables tables;
+                return tables;
+            }
+
+            /**
+             * @brief Inverse les length bits de poids faible de code
+             */
+            inline uint16 ReverseBits(uint32 code, int length) {
+                uint32 result = 0;
+                for (int i = 0; i < length; ++i) {
+                    result = (result << 1) | (code & 1);
+                    code >>= 1;
+                }
+                return static_cast<uint16>(result);
+            }
+
+            /**
+             * @brief Longueurs de Huffman limitées à maxBits
+             * @param frequencies Fréquences des symboles
+             * @param count Nombre de symboles
+             * @param maxBits Longueur maximale
+             * @param lengths Reçoit les longueurs (0 pour un symbole absent)
+             *
+             * Arbre de Huffman classique puis, si des feuilles dépassent
+             * maxBits, redistribution des longueurs comme dans zlib. Au moins
+             * deux symboles doivent avoir une fréquence non nulle.
+             */
+            void BuildLengths(const uint32* frequencies, int count, int maxBits, uint8* lengths) {
+                struct Node {
+                    uint64 weight;
+                    int parent;
+                };
+
+                std::vector<Node> nodes;
+                std::vector<int> symbols;
+                nodes.reserve(size_t(count) * 2);
+                for (int i = 0; i < count; ++i) {
+                    lengths[i] = 0;
+                    if (frequencies[i] > 0) {
+                        nodes.push_back(Node{frequencies[i], -1});
+                        symbols.push_back(i);
+                    }
+                }
+
+                const int leaves = static_cast<int>(symbols.size());
+                using Entry = std::pair<uint64, int>;
+                std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+                for (int i = 0; i < leaves; ++i) {
+                    queue.push(Entry(nodes[i].weight, i));
+                }
+                while (queue.size() > 1) {
+                    const Entry a = queue.top(); queue.pop();
+                    const Entry b = queue.top(); queue.pop();
+                    const int parent = static_cast<int>(nodes.size());
+                    nodes.push_back(Node{a.first + b.first, -1});
+                    nodes[a.second].parent = parent;
+                    nodes[b.second].parent = parent;
+                    queue.push(Entry(a.first + b.first, parent));
+                }
+
+                // Profondeur des feuilles, bornée: les débordements sont comptés
+                int lengthCount[MAX_BITS + 1] = {};
+                int overflow = 0;
+                for (int i = 0; i < leaves; ++i) {
+                    int depth = 0;
+                    for (int node = i; nodes[node].parent >= 0; node = nodes[node].parent) {
+                        ++depth;
+                    }
+                    if (depth > maxBits) {
+                        depth = maxBits;
+                        ++overflow;
+                    }
+                    ++lengthCount[depth];
+                }
+
+                // Chaque feuille descendue d'un niveau libre la place de deux
+                // feuilles au niveau maximal
+                while (overflow > 0) {
+                    int bits = maxBits - 1;
+                    while (lengthCount[bits] == 0) --bits;
+                    --lengthCount[bits];
+                    lengthCount[bits + 1] += 2;
+                    --lengthCount[maxBits];
+                    overflow -= 2;
+                }
+
+                // Les symboles les moins fréquents reçoivent les codes les plus longs
+                std::vector<int> order(leaves);
+                for (int i = 0; i < leaves; ++i) order[i] = i;
+                std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+                    return nodes[a].weight < nodes[b].weight;
+                });
+                int next = 0;
+                for (int bits = maxBits; bits >= 1; --bits) {
+                    for (int n = lengthCount[bits]; n > 0; --n) {
+                        lengths[symbols[order[next++]]] = static_cast<uint8>(bits);
+                    }
+                }
+            }
+
+            /**
+             * @brief Codes canoniques, inversés pour l'écriture poids faible d'abord
+             */
+            void BuildCodes(const uint8* lengths, int count, uint16* codes) {
+                uint32 lengthCount[MAX_BITS + 1] = {};
+                for (int i = 0; i < count; ++i) {
+                    ++lengthCount[lengths[i]];
+                }
+                lengthCount[0] = 0;
+
+                uint32 nextCode[MAX_BITS + 1] = {};
+                uint32 code = 0;
+                for (int bits = 1; bits <= MAX_BITS; ++bits) {
+                    code = (code + lengthCount[bits - 1]) << 1;
+                    nextCode[bits] = code;
+                }
+                for (int i = 0; i < count; ++i) {
+                    codes[i] = lengths[i] ? ReverseBits(nextCode[lengths[i]]++, lengths[i]) : 0;
+                }
+            }
+
+            /**
+             * @brief Garantit au moins deux symboles présents (arbre bien formé)
+             */
+            void EnsureTwoSymbols(uint32* frequencies, int count) {
+                int present = 0;
+                for (int i = 0; i < count && present < 2; ++i) {
+                    if (frequencies[i] > 0) ++present;
+                }
+                for (int i = 0; i < count && present < 2; ++i) {
+                    if (frequencies[i] == 0) {
+                        frequencies[i] = 1;
+                        ++present;
+                    }
+                }
+            }
+
+        } // namespace
+
+        // -------------------------------------------------------------------------
+        // STRUCTURE: DeflateEncoder::State
+        // DESCRIPTION: Fenêtre, chaînes de hachage, symboles du bloc courant et
+        //              écrivain de bits
+        // -------------------------------------------------------------------------
+        struct DeflateEncoder::State {
+            /// Fenêtre glissante de deux fenêtres (plus marge de lecture sur 8 octets)
+            std::vector<uint8> window;
+
+            /// Octets valides dans la fenêtre
+            size_t windowEnd = 0;
+
+            /// Position courante de l'analyse
+            size_t position = 0;
+
+            /// Dernière position de chaque empreinte et chaînage des précédentes
+            std::vector<uint32> head;
+            std::vector<uint32> previous;
+
+            /// Symboles du bloc: littéral ou longueur - 3, distance (0: littéral)
+            std::vector<uint8> symbolValue;
+            std::vector<uint16> symbolDistance;
+
+            /// Fréquences du bloc
+            uint32 literalFrequency[LITERAL_CODES];
+            uint32 distanceFrequency[DISTANCE_CODES];
+
+            /// Écrivain de bits (poids faible d'abord)
+            uint64 bitBuffer = 0;
+            int bitCount = 0;
+            std::string* out = nullptr;
+
+            /// Réglages du niveau
+            uint32 chainLimit;
+            size_t niceLength;
+
+            explicit State(int level)
+                : window(2 * WINDOW_SIZE + 8, 0)
+                , head(HASH_SIZE, NIL)
+                , previous(WINDOW_SIZE, NIL) {
+                level = std::max(1, std::min(9, level));
+                chainLimit = CHAIN_LIMIT[level];
+                niceLength = NICE_LENGTH[level];
+                symbolValue.reserve(BLOCK_SYMBOLS);
+                symbolDistance.reserve(BLOCK_SYMBOLS);
+                ResetBlock();
+            }
+
+            void ResetBlock() {
+                symbolValue.clear();
+                symbolDistance.clear();
+                std::memset(literalFrequency, 0, sizeof(literalFrequency));
+                std::memset(distanceFrequency, 0, sizeof(distanceFrequency));
+            }
+
+            void ResetStream() {
+                windowEnd = 0;
+                position = 0;
+                std::fill(head.begin(), head.end(), NIL);
+                std::fill(previous.begin(), previous.end(), NIL);
+                bitBuffer = 0;
+                bitCount = 0;
+                ResetBlock();
+            }
+
+            // ---------------------------------------------------------------------
+            // BITS
+            // ---------------------------------------------------------------------
+
+            void WriteBits(uint32 value, int count) {
+                bitBuffer |= static_cast<uint64>(value) << bitCount;
+                bitCount += count;
+                if (bitCount >= 32) {
+                    char bytes[4];
+                    for (int i = 0; i < 4; ++i) {
+                        bytes[i] = static_cast<char>(bitBuffer >> (8 * i));
+                    }
+                    out->append(bytes, 4);
+                    bitBuffer >>= 32;
+                    bitCount -= 32;
+                }
+            }
+
+            void AlignToByte() {
+                while (bitCount > 0) {
+                    out->push_back(static_cast<char>(bitBuffer & 0xFF));
+                    bitBuffer >>= 8;
+                    bitCount = bitCount > 8 ? bitCount - 8 : 0;
+                }
+                bitBuffer = 0;
+            }
+
+            // ---------------------------------------------------------------------
+            // LZ77
+            // ---------------------------------------------------------------------
+
+            inline uint32 Hash(size_t at) const {
+                const uint32 value = uint32(window[at]) | (uint32(window[at + 1]) << 8) |
+                                     (uint32(window[at + 2]) << 16);
+                return (value * 2654435761u) >> (32 - HASH_BITS);
+            }
+
+            /**
+             * @brief Insère la position dans sa chaîne et rend la tête précédente
+             */
+            inline uint32 Insert(size_t at) {
+                const uint32 hash = Hash(at);
+                const uint32 candidate = head[hash];
+                previous[at & WINDOW_MASK] = candidate;
+                head[hash] = static_cast<uint32>(at);
+                return candidate;
+            }
+
+            /**
+             * @brief Plus longue correspondance le long de la chaîne
+             */
+            size_t LongestMatch(uint32 candidate, size_t available, size_t& distance) {
+                const size_t limit = position > MAX_DISTANCE ? position - MAX_DISTANCE : 0;
+                const size_t maxLength = std::min(MAX_MATCH, available);
+                const uint8* current = window.data() + position;
+                size_t best = MIN_MATCH - 1;
+                uint32 chain = chainLimit;
+
+                while (candidate != NIL && candidate >= limit && candidate < position && chain-- > 0) {
+                    const uint8* match = window.data() + candidate;
+                    if (match[best] == current[best] && match[0] == current[0] && match[1] == current[1]) {
+                        size_t length = 0;
+                        while (length + 8 <= maxLength) {
+                            uint64 a, b;
+                            std::memcpy(&a, match + length, 8);
+                            std::memcpy(&b, current + length, 8);
+                            if (a != b) break;
+                            length += 8;
+                        }
+                        while (length < maxLength && match[length] == current[length]) {
+                            ++length;
+                        }
+                        if (length > best) {
+                            best = length;
+                            distance = position - candidate;
+                            if (length >= niceLength || length == maxLength) break;
+                        }
+                    }
+
+                    const uint32 next = previous[candidate & WINDOW_MASK];
+                    if (next == NIL || next >= candidate) break; // Entrée écrasée par le tour suivant
+                    candidate = next;
+                }
+                return best >= MIN_MATCH ? best : 0;
+            }
+
+            /**
+             * @brief Décale la fenêtre d'une demi-fenêtre
+             */
+            void Slide() {
+                std::memmove(window.data(), window.data() + WINDOW_SIZE, windowEnd - WINDOW_SIZE);
+                windowEnd -= WINDOW_SIZE;
+                position -= WINDOW_SIZE;
+                for (uint32& entry : head) {
+                    entry = (entry != NIL && entry >= WINDOW_SIZE) ? entry - uint32(WINDOW_SIZE) : NIL;
+                }
+                for (uint32& entry : previous) {
+                    entry = (entry != NIL && entry >= WINDOW_SIZE) ? entry - uint32(WINDOW_SIZE) : NIL;
+                }
+            }
+
+            /**
+             * @brief Analyse la fenêtre jusqu'à la marge (ou jusqu'au bout)
+             */
+            void Process(bool finishing) {
+                const CodeTables& tables = Tables();
+                const size_t margin = finishing ? 0 : MIN_LOOKAHEAD;
+
+                while (windowEnd - position > margin) {
+                    const size_t available = windowEnd - position;
+                    size_t length = 0;
+                    size_t distance = 0;
+
+                    if (available >= MIN_MATCH) {
+                        const uint32 candidate = Insert(position);
+                        if (candidate != NIL) {
+                            length = LongestMatch(candidate, available, distance);
+                        }
+                    }
+
+                    if (length >= MIN_MATCH) {
+                        const uint8 lengthSymbol = static_cast<uint8>(length - MIN_MATCH);
+                        symbolValue.push_back(lengthSymbol);
+                        symbolDistance.push_back(static_cast<uint16>(distance));
+                        ++literalFrequency[257 + tables.lengthCode[lengthSymbol]];
+                        ++distanceFrequency[tables.distanceCode[distance - 1]];
+
+                        // Les positions couvertes entrent dans les chaînes
+                        const size_t end = position + length;
+                        for (size_t at = position + 1; at < end && windowEnd - at >= MIN_MATCH; ++at) {
+                            Insert(at);
+                        }
+                        position = end;
+                    } else {
+                        const uint8 literal = window[position];
+                        symbolValue.push_back(literal);
+                        symbolDistance.push_back(0);
+                        ++literalFrequency[literal];
+                        ++position;
+                    }
+
+                    if (symbolValue.size() >= BLOCK_SYMBOLS) {
+                        FlushBlock(false);
+                    }
+                }
+            }
+
+            // ---------------------------------------------------------------------
+            // BLOCS
+            // ---------------------------------------------------------------------
+
+            /**
+             * @brief Émet les symboles du bloc sous codes Huffman dynamiques
+             */
+            void FlushBlock(bool last) {
+                const CodeTables& tables = Tables();
+
+                literalFrequency[END_OF_BLOCK] = 1;
+                EnsureTwoSymbols(literalFrequency, LITERAL_CODES);
+                EnsureTwoSymbols(distanceFrequency, DISTANCE_CODES);
+
+                uint8 literalLengths[LITERAL_CODES];
+                uint8 distanceLengths[DISTANCE_CODES];
+                BuildLengths(literalFrequency, LITERAL_CODES, MAX_BITS, literalLengths);
+                BuildLengths(distanceFrequency, DISTANCE_CODES, MAX_BITS, distanceLengths);
+
+                int literalCount = LITERAL_CODES;
+                while (literalCount > 257 && literalLengths[literalCount - 1] == 0) --literalCount;
+                int distanceCount = DISTANCE_CODES;
+                while (distanceCount > 1 && distanceLengths[distanceCount - 1] == 0) --distanceCount;
+
+                // Longueurs des deux codes, compressées par répétitions (16, 17, 18)
+                uint8 combined[LITERAL_CODES + DISTANCE_CODES];
+                std::memcpy(combined, literalLengths, literalCount);
+                std::memcpy(combined + literalCount, distanceLengths, distanceCount);
+                const int combinedCount = literalCount + distanceCount;
+
+                std::vector<uint8> runSymbols;
+                std::vector<uint8> runExtra;
+                uint32 lengthFrequency[LENGTH_CODES] = {};
+                for (int i = 0; i < combinedCount;) {
+                    const uint8 value = combined[i];
+                    int run = 1;
+                    while (i + run < combinedCount && combined[i + run] == value) ++run;
+                    i += run;
+
+                    if (value == 0) {
+                        while (run >= 11) {
+                            const int n = std::min(run, 138);
+                            runSymbols.push_back(18); runExtra.push_back(static_cast<uint8>(n - 11));
+                            run -= n;
+                        }
+                        if (run >= 3) {
+                            runSymbols.push_back(17); runExtra.push_back(static_cast<uint8>(run - 3));
+                            run = 0;
+                        }
+                    } else {
+                        runSymbols.push_back(value); runExtra.push_back(0);
+                        --run;
+                        while (run >= 3) {
+                            const int n = std::min(run, 6);
+                            runSymbols.push_back(16); runExtra.push_back(static_cast<uint8>(n - 3));
+                            run -= n;
+                        }
+                    }
+                    for (; run > 0; --run) {
+                        runSymbols.push_back(value); runExtra.push_back(0);
+                    }
+                }
+                for (uint8 symbol : runSymbols) ++lengthFrequency[symbol];
+                EnsureTwoSymbols(lengthFrequency, LENGTH_CODES);
+
+                uint8 lengthLengths[LENGTH_CODES];
+                uint16 lengthCodes[LENGTH_CODES];
+                BuildLengths(lengthFrequency, LENGTH_CODES, MAX_LENGTH_BITS, lengthLengths);
+                BuildCodes(lengthLengths, LENGTH_CODES, lengthCodes);
+
+                int lengthCount = LENGTH_CODES;
+                while (lengthCount > 4 && lengthLengths[LENGTH_ORDER[lengthCount - 1]] == 0) --lengthCount;
+
+                uint16 literalCodes[LITERAL_CODES];
+                uint16 distanceCodes[DISTANCE_CODES];
+                BuildCodes(literalLengths, LITERAL_CODES, literalCodes);
+                BuildCodes(distanceLengths, DISTANCE_CODES, distanceCodes);
+
+                // En-tête du bloc dynamique
+                WriteBits(last ? 1 : 0, 1);
+                WriteBits(2, 2);
+                WriteBits(uint32(literalCount - 257), 5);
+                WriteBits(uint32(distanceCount - 1), 5);
+                WriteBits(uint32(lengthCount - 4), 4);
+                for (int i = 0; i < lengthCount; ++i) {
+                    WriteBits(lengthLengths[LENGTH_ORDER[i]], 3);
+                }
+                for (size_t i = 0; i < runSymbols.size(); ++i) {
+                    const uint8 symbol = runSymbols[i];
+                    WriteBits(lengthCodes[symbol], lengthLengths[symbol]);
+                    if (symbol == 16) WriteBits(runExtra[i], 2);
+                    else if (symbol == 17) WriteBits(runExtra[i], 3);
+                    else if (symbol == 18) WriteBits(runExtra[i], 7);
+                }
+
+                // Symboles
+                for (size_t i = 0; i < symbolValue.size(); ++i) {
+                    const uint32 distance = symbolDistance[i];
+                    if (distance == 0) {
+                        const uint8 literal = symbolValue[i];
+                        WriteBits(literalCodes[literal], literalLengths[literal]);
+                        continue;
+                    }
+
+                    const uint32 lengthSymbol = symbolValue[i];
+                    const int lengthCode = tables.lengthCode[lengthSymbol];
+                    WriteBits(literalCodes[257 + lengthCode], literalLengths[257 + lengthCode]);
+                    if (LENGTH_EXTRA[lengthCode]) {
+                        WriteBits(lengthSymbol + MIN_MATCH - LENGTH_BASE[lengthCode], LENGTH_EXTRA[lengthCode]);
+                    }
+
+                    const int distanceCode = tables.distanceCode[distance - 1];
+                    WriteBits(distanceCodes[distanceCode], distanceLengths[distanceCode]);
+                    if (DISTANCE_EXTRA[distanceCode]) {
+                        WriteBits(distance - DISTANCE_BASE[distanceCode], DISTANCE_EXTRA[distanceCode]);
+                    }
+                }
+                WriteBits(literalCodes[END_OF_BLOCK], literalLengths[END_OF_BLOCK]);
+
+                ResetBlock();
+            }
+
+        };
+
+        // -------------------------------------------------------------------------
+        // DEFLATEENCODER
+        // -------------------------------------------------------------------------
+
+        /**
+         * @brief Constructeur
+         */
+        DeflateEncoder::DeflateEncoder(int level)
+            : m_State(new State(level)) {
+        }
+
+        DeflateEncoder::~DeflateEncoder() = default;
+
+        /**
+         * @brief Compresse des octets (une partie peut rester en fenêtre)
+         */
+        void DeflateEncoder::Write(const void* data, size_t size, std::string& out) {
+            State& state = *m_State;
+            const uint8* bytes = static_cast<const uint8*>(data);
+            state.out = &out;
+
+            while (size > 0) {
+                if (state.windowEnd == 2 * WINDOW_SIZE) {
+                    state.Slide();
+                }
+                const size_t count = std::min(size, 2 * WINDOW_SIZE - state.windowEnd);
+                std::memcpy(state.window.data() + state.windowEnd, bytes, count);
+                state.windowEnd += count;
+                bytes += count;
+                size -= count;
+                state.Process(false);
+            }
+            state.out = nullptr;
+        }
+
+        /**
+         * @brief Termine le flux (dernier bloc, alignement sur l'octet)
+         */
+        void DeflateEncoder::Finish(std::string& out) {
+            State& state = *m_State;
+            state.out = &out;
+            state.Process(true);
+            state.FlushBlock(true);
+            state.AlignToByte();
+            state.out = nullptr;
+            state.ResetStream();
+        }
+
+        // -------------------------------------------------------------------------
+        // GZIPENCODER
+        // -------------------------------------------------------------------------
+
+        /**
+         * @brief Constructeur
+         */
+        GzipEncoder::GzipEncoder(int level)
+            : m_Deflate(level)
+            , m_Crc(0)
+            , m_Size(0)
+            , m_HeaderWritten(false) {
+        }
+
+        /**
+         * @brief Compresse des octets (l'en-tête précède le premier appel)
+         */
+        void GzipEncoder::Write(const void* data, size_t size, std::string& out) {
+            if (!m_HeaderWritten) {
+                // Magique, méthode 8, aucun drapeau, pas de date, OS inconnu
+                static const char header[10] = {
+                    '\x1f', '\x8b', 8, 0, 0, 0, 0, 0, 0, '\xff'
+                };
+                out.append(header, sizeof(header));
+                m_HeaderWritten = true;
+            }
+            m_Crc = Crc32(m_Crc, data, size);
+            m_Size += static_cast<uint32>(size);
+            m_Deflate.Write(data, size, out);
+        }
+
+        /**
+         * @brief Termine le membre gzip (CRC-32 et taille)
+         */
+        void GzipEncoder::Finish(std::string& out) {
+            Write(nullptr, 0, out);
+            m_Deflate.Finish(out);
+            for (int i = 0; i < 4; ++i) out.push_back(static_cast<char>(m_Crc >> (8 * i)));
+            for (int i = 0; i < 4; ++i) out.push_back(static_cast<char>(m_Size >> (8 * i)));
+            m_Crc = 0;
+            m_Size = 0;
+            m_HeaderWritten = false;
+        }
+
+        // -------------------------------------------------------------------------
+        // DÉCODEUR
+        // -------------------------------------------------------------------------
+
+        namespace {
+
+            // ---------------------------------------------------------------------
+            // CLASSE: Inflater
+            // DESCRIPTION: Décodeur DEFLATE minimal (décodage canonique bit par
+            //              bit), utilisé pour relire les journaux compressés
+            // ---------------------------------------------------------------------
+            class Inflater {
+                public:
+                    Inflater(const uint8* data, size_t size, std::string& out)
+                        : m_Data(data), m_Size(size), m_Position(0)
+                        , m_BitBuffer(0), m_BitCount(0), m_Error(false), m_Out(out) {
+                    }
+
+                    /**
+                     * @brief Décode un flux DEFLATE complet
+                     */
+                    bool Run() {
+                        bool last = false;
+                        while (!last && !m_Error) {
+                            last = Bits(1) != 0;
+                            const uint32 type = Bits(2);
+                            if (type == 0) Stored();
+                            else if (type == 1) Fixed();
+                            else if (type == 2) Dynamic();
+                            else m_Error = true;
+                        }
+                        return !m_Error;
+                    }
+
+                    /// Position après le flux (octet suivant le dernier bit lu)
+                    size_t GetPosition() const { return m_Position; }
+
+                private:
+                    struct Huffman {
+                        uint16 count[MAX_BITS + 1];
+                        uint16 symbol[LITERAL_CODES + 2];
+                    };
+
+                    uint32 Bits(int need) {
+                        uint32 value = m_BitBuffer;
+                        while (m_BitCount < need) {
+                            if (m_Position >= m_Size) {
+                                m_Error = true;
+                                return 0;
+                            }
+                            value |= uint32(m_Data[m_Position++]) << m_BitCount;
+                            m_BitCount += 8;
+                        }
+                        m_BitBuffer = value >> need;
+                        m_BitCount -= need;
+                        return value & ((1u << need) - 1);
+                    }
+
+                    bool Build(Huffman& h, const uint8* lengths, int count) {
+                        std::memset(h.count, 0, sizeof(h.count));
+                        for (int i = 0; i < count; ++i) ++h.count[lengths[i]];
+                        if (h.count[0] == count) return true;
+
+                        int left = 1;
+                        for (int len = 1; len <= MAX_BITS; ++len) {
+                            left <<= 1;
+                            left -= h.count[len];
+                            if (left < 0) return false; // Code sur-souscrit
+                        }
+
+                        uint16 offsets[MAX_BITS + 1];
+                        offsets[1] = 0;
+                        for (int len = 1; len < MAX_BITS; ++len) offsets[len + 1] = offsets[len] + h.count[len];
+                        for (int i = 0; i < count; ++i) {
+                            if (lengths[i]) h.symbol[offsets[lengths[i]]++] = static_cast<uint16>(i);
+                        }
+                        return true;
+                    }
+
+                    int Decode(const Huffman& h) {
+                        int code = 0, first = 0, index = 0;
+                        for (int len = 1; len <= MAX_BITS; ++len) {
+                            code |= static_cast<int>(Bits(1));
+                            if (m_Error) return -1;
+                            const int count = h.count[len];
+                            if (code - count < first) return h.symbol[index + (code - first)];
+                            index += count;
+                            first += count;
+                            first <<= 1;
+                            code <<= 1;
+                        }
+                        m_Error = true;
+                        return -1;
+                    }
+
+                    void Stored() {
+                        m_BitBuffer = 0;
+                        m_BitCount = 0;
+                        if (m_Position + 4 > m_Size) { m_Error = true; return; }
+                        const uint32 length = m_Data[m_Position] | (uint32(m_Data[m_Position + 1]) << 8);
+                        const uint32 complement = m_Data[m_Position + 2] | (uint32(m_Data[m_Position + 3]) << 8);
+                        m_Position += 4;
+                        if (length != (~complement & 0xFFFF) || m_Position + length > m_Size) {
+                            m_Error = true;
+                            return;
+                        }
+                        m_Out.append(reinterpret_cast<const char*>(m_Data + m_Position), length);
+                        m_Position += length;
+                    }
+
+                    void Codes(const Huffman& literals, const Huffman& distances) {
+                        for (;;) {
+                            const int symbol = Decode(literals);
+                            if (symbol < 0) return;
+                            if (symbol < 256) {
+                                m_Out.push_back(static_cast<char>(symbol));
+                                continue;
+                            }
+                            if (symbol == END_OF_BLOCK) return;
+
+                            const int lengthCode = symbol - 257;
+                            if (lengthCode >= 29) { m_Error = true; return; }
+                            const size_t length = LENGTH_BASE[lengthCode] + Bits(LENGTH_EXTRA[lengthCode]);
+                            const int distanceCode = Decode(distances);
+                            if (distanceCode < 0 || distanceCode >= DISTANCE_CODES) { m_Error = true; return; }
+                            const size_t distance = DISTANCE_BASE[distanceCode] + Bits(DISTANCE_EXTRA[distanceCode]);
+                            if (m_Error || distance > m_Out.size()) { m_Error = true; return; }
+
+                            size_t from = m_Out.size() - distance;
+                            for (size_t i = 0; i < length; ++i) {
+                                m_Out.push_back(m_Out[from++]);
+                            }
+                        }
+                    }
+
+                    void Fixed() {
+                        uint8 lengths[LITERAL_CODES + 2 + DISTANCE_CODES];
+                        int i = 0;
+                        for (; i < 144; ++i) lengths[i] = 8;
+                        for (; i < 256; ++i) lengths[i] = 9;
+                        for (; i < 280; ++i) lengths[i] = 7;
+                        for (; i < 288; ++i) lengths[i] = 8;
+                        for (; i < 288 + DISTANCE_CODES; ++i) lengths[i] = 5;
+
+                        Huffman literals, distances;
+                        Build(literals, lengths, 288);
+                        Build(distances, lengths + 288, DISTANCE_CODES);
+                        Codes(literals, distances);
+                    }
+
+                    void Dynamic() {
+                        const int literalCount = static_cast<int>(Bits(5)) + 257;
+                        const int distanceCount = static_cast<int>(Bits(5)) + 1;
+                        const int lengthCount = static_cast<int>(Bits(4)) + 4;
+                        if (m_Error || literalCount > LITERAL_CODES || distanceCount > DISTANCE_CODES) {
+                            m_Error = true;
+                            return;
+                        }
+
+                        uint8 lengths[LITERAL_CODES + DISTANCE_CODES] = {};
+                        for (int i = 0; i < lengthCount; ++i) lengths[LENGTH_ORDER[i]] = static_cast<uint8>(Bits(3));
+                        Huffman lengthCode;
+                        if (!Build(lengthCode, lengths, LENGTH_CODES)) { m_Error = true; return; }
+
+                        const int total = literalCount + distanceCount;
+                        std::memset(lengths, 0, sizeof(lengths));
+                        for (int index = 0; index < total && !m_Error;) {
+                            const int symbol = Decode(lengthCode);
+                            if (symbol < 0) return;
+                            if (symbol < 16) {
+                                lengths[index++] = static_cast<uint8>(symbol);
+                                continue;
+                            }
+
+                            uint8 value = 0;
+                            int repeat;
+                            if (symbol == 16) {
+                                if (index == 0) { m_Error = true; return; }
+                                value = lengths[index - 1];
+                                repeat = 3 + static_cast<int>(Bits(2));
+                            } else if (symbol == 17) {
+                                repeat = 3 + static_cast<int>(Bits(3));
+                            } else {
+                                repeat = 11 + static_cast<int>(Bits(7));
+                            }
+                            if (index + repeat > total) { m_Error = true; return; }
+                            while (repeat-- > 0) lengths[index++] = value;
+                        }
+                        if (m_Error) return;
+
+                        Huffman literals, distances;
+                        if (!Build(literals, lengths, literalCount) ||
+                            !Build(distances, lengths + literalCount, distanceCount)) {
+                            m_Error = true;
+                            return;
+                        }
+                        Codes(literals, distances);
+                    }
+
+                    const uint8* m_Data;
+                    size_t m_Size;
+                    size_t m_Position;
+                    uint32 m_BitBuffer;
+                    int m_BitCount;
+                    bool m_Error;
+                    std::string& m_Out;
+            };
+
+            inline uint32 ReadLittleEndian32(const uint8* bytes) {
+                return uint32(bytes[0]) | (uint32(bytes[1]) << 8) |
+                       (uint32(bytes[2]) << 16) | (uint32(bytes[3]) << 24);
+            }
+
+        } // namespace
+
+        // -------------------------------------------------------------------------
+        // FONCTIONS
+        // -------------------------------------------------------------------------
+
+        /**
+         * @brief CRC-32 (polynôme gzip), cumulable
+         */
+        uint32 Crc32(uint32 crc, const void* data, size_t size) {
+            const uint32* table = Tables().crc;
+            const uint8* bytes = static_cast<const uint8*>(data);
+            crc = ~crc;
+            for (size_t i = 0; i < size; ++i) {
+                crc = table[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+            }
+            return ~crc;
+        }
+
+        /**
+         * @brief Compresse un bloc mémoire au format gzip
+         */
+        std::string GzipCompress(const void* data, size_t size, int level) {
+            std::string out;
+            out.reserve(size / 4 + 64);
+            GzipEncoder encoder(level);
+            encoder.Write(data, size, out);
+            encoder.Finish(out);
+            return out;
+        }
+
+        /**
+         * @brief Décompresse un ou plusieurs membres gzip
+         */
+        bool GzipDecompress(const void* data, size_t size, std::string& out) {
+            const uint8* bytes = static_cast<const uint8*>(data);
+            size_t position = 0;
+
+            do {
+                if (size - position < 18 || bytes[position] != 0x1f ||
+                    bytes[position + 1] != 0x8b || bytes[position + 2] != 8) {
+                    return false;
+                }
+                const uint8 flags = bytes[position + 3];
+                position += 10;
+
+                // Champs optionnels de l'en-tête
+                if (flags & 0x04) {
+                    if (size - position < 2) return false;
+                    position += 2 + (bytes[position] | (size_t(bytes[position + 1]) << 8));
+                }
+                for (uint8 flag : { uint8(0x08), uint8(0x10) }) {
+                    if (flags & flag) {
+                        while (position < size && bytes[position] != 0) ++position;
+                        ++position;
+                    }
+                }
+                if (flags & 0x02) position += 2;
+                if (position >= size) return false;
+
+                const size_t start = out.size();
+                Inflater inflater(bytes + position, size - position, out);
+                if (!inflater.Run()) return false;
+                position += inflater.GetPosition();
+
+                if (size - position < 8) return false;
+                const uint32 crc = ReadLittleEndian32(bytes + position);
+                const uint32 length = ReadLittleEndian32(bytes + position + 4);
+                position += 8;
+                if (crc != Crc32(0, out.data() + start, out.size() - start) ||
+                    length != static_cast<uint32>(out.size() - start)) {
+                    return false;
+                }
+            } while (position < size);
+
+            return true;
+        }
+
+        /**
+         * @brief Compresse un fichier en flux vers un fichier gzip
+         */
+        bool GzipCompressFile(const std::string& source, const std::string& destination, int level) {
+            const std::string temporary = destination + ".tmp";
+
+            std::FILE* input = std::fopen(source.c_str(), "rb");
+            if (!input) return false;
+            std::FILE* output = std::fopen(temporary.c_str(), "wb");
+            if (!output) {
+                std::fclose(input);
+                return false;
+            }
+
+            GzipEncoder encoder(level);
+            std::vector<char> chunk(64 * 1024);
+            std::string compressed;
+            bool ok = true;
+
+            for (;;) {
+                const size_t read = std::fread(chunk.data(), 1, chunk.size(), input);
+                if (read > 0) {
+                    encoder.Write(chunk.data(), read, compressed);
+                }
+                if (read < chunk.size()) {
+                    ok = !std::ferror(input);
+                    break;
+                }
+                if (!compressed.empty()) {
+                    ok = std::fwrite(compressed.data(), 1, compressed.size(), output) == compressed.size();
+                    compressed.clear();
+                    if (!ok) break;
+                }
+            }
+            if (ok) {
+                encoder.Finish(compressed);
+                ok = std::fwrite(compressed.data(), 1, compressed.size(), output) == compressed.size();
+            }
+
+            std::fclose(input);
+            ok = (std::fclose(output) == 0) && ok;
+
+            std::error_code error;
+            if (ok) {
+                std::filesystem::rename(temporary, destination, error);
+                ok = !error;
+            }
+            if (!ok) {
+                std::filesystem::remove(temporary, error);
+            }
+            return ok;
+        }
+
+    } // namespace logger
+} // namespace nkentseu
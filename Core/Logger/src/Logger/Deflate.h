@@ -0,0 +1,141 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/Deflate.h
+// DESCRIPTION: Codec DEFLATE (RFC 1951) et conteneur gzip (RFC 1952) intégrés,
+//              sans dépendance externe, pour compresser les journaux tournés.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Logger/Export.h"
+#include <Nkentseu/Types.h>
+#include <memory>
+#include <string>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        // -------------------------------------------------------------------------
+        // CLASSE: DeflateEncoder
+        // DESCRIPTION: Encodeur DEFLATE en flux. LZ77 sur une fenêtre de 32 Kio
+        //              (chaînes de hachage sur 3 octets, recherche bornée par le
+        //              niveau) puis blocs Huffman dynamiques de 16 Ki symboles.
+        //              Les octets produits sont ajoutés à la chaîne fournie à
+        //              chaque appel: l'appelant les écrit quand il le souhaite.
+        // -------------------------------------------------------------------------
+        class LOGGER_API DeflateEncoder {
+            public:
+                /// Niveau par défaut (compromis vitesse / taux)
+                static constexpr int DEFAULT_LEVEL = 6;
+
+                /**
+                 * @brief Constructeur
+                 * @param level Niveau 1 (rapide) à 9 (meilleur taux)
+                 */
+                explicit DeflateEncoder(int level = DEFAULT_LEVEL);
+
+                ~DeflateEncoder();
+
+                DeflateEncoder(const DeflateEncoder&) = delete;
+                DeflateEncoder& operator=(const DeflateEncoder&) = delete;
+
+                /**
+                 * @brief Compresse des octets (une partie peut rester en fenêtre)
+                 * @param data Données
+                 * @param size Taille des données
+                 * @param out Reçoit les octets compressés disponibles
+                 */
+                void Write(const void* data, size_t size, std::string& out);
+
+                /**
+                 * @brief Termine le flux (dernier bloc, alignement sur l'octet)
+                 * @param out Reçoit les derniers octets compressés
+                 *
+                 * L'encodeur est ensuite prêt pour un nouveau flux.
+                 */
+                void Finish(std::string& out);
+
+            private:
+                struct State;
+
+                /// État de l'encodeur (fenêtre, tables de hachage, symboles)
+                std::unique_ptr<State> m_State;
+        };
+
+        // -------------------------------------------------------------------------
+        // CLASSE: GzipEncoder
+        // DESCRIPTION: DeflateEncoder dans un conteneur gzip (en-tête, CRC-32 et
+        //              taille), lisible par gzip/zcat
+        // -------------------------------------------------------------------------
+        class LOGGER_API GzipEncoder {
+            public:
+                /**
+                 * @brief Constructeur
+                 * @param level Niveau 1 à 9
+                 */
+                explicit GzipEncoder(int level = DeflateEncoder::DEFAULT_LEVEL);
+
+                /**
+                 * @brief Compresse des octets (l'en-tête précède le premier appel)
+                 */
+                void Write(const void* data, size_t size, std::string& out);
+
+                /**
+                 * @brief Termine le membre gzip (CRC-32 et taille)
+                 */
+                void Finish(std::string& out);
+
+            private:
+                DeflateEncoder m_Deflate;
+                uint32 m_Crc;
+                uint32 m_Size;
+                bool m_HeaderWritten;
+        };
+
+        // -------------------------------------------------------------------------
+        // FONCTIONS
+        // -------------------------------------------------------------------------
+
+        /**
+         * @brief CRC-32 (polynôme gzip), cumulable
+         * @param crc CRC précédent (0 au départ)
+         * @param data Données
+         * @param size Taille des données
+         */
+        LOGGER_API uint32 Crc32(uint32 crc, const void* data, size_t size);
+
+        /**
+         * @brief Compresse un bloc mémoire au format gzip
+         * @param data Données
+         * @param size Taille des données
+         * @param level Niveau 1 à 9
+         * @return Membre gzip complet
+         */
+        LOGGER_API std::string GzipCompress(const void* data, size_t size, int level = DeflateEncoder::DEFAULT_LEVEL);
+
+        /**
+         * @brief Décompresse un ou plusieurs membres gzip
+         * @param data Données compressées
+         * @param size Taille des données
+         * @param out Reçoit les données décompressées
+         * @return false si le flux est invalide (CRC ou taille compris)
+         */
+        LOGGER_API bool GzipDecompress(const void* data, size_t size, std::string& out);
+
+        /**
+         * @brief Compresse un fichier en flux vers un fichier gzip
+         * @param source Fichier à compresser
+         * @param destination Fichier gzip produit (écrit via destination.tmp
+         *        puis renommé: jamais de fichier .gz tronqué)
+         * @param level Niveau 1 à 9
+         * @return true si la destination est complète
+         */
+        LOGGER_API bool GzipCompressFile(const std::string& source, const std::string& destination,
+                                         int level = DeflateEncoder::DEFAULT_LEVEL);
+
+    } // namespace logger
+} // namespace nkentseu
@@ -0,0 +1,89 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/FormatUtils.cpp
+// DESCRIPTION: Cache par thread de l'heure locale des messages.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#include "Logger/FormatUtils.h"
+#include <climits>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        namespace {
+
+            /// Heure locale décomposée et pré-rendue pour une seconde donnée
+            struct LocalTimeCache {
+                /// Seconde (depuis l'epoch) décrite par le cache
+                int64 second = LLONG_MIN;
+
+                /// Heure locale décomposée
+                std::tm tm = {};
+
+                /// "YYYY-mm-dd HH:MM:SS"
+                char dateTime[DATE_TIME_LENGTH + 1] = {};
+            };
+
+            /// Un cache par thread: les formatters de plusieurs sinks le partagent
+            thread_local LocalTimeCache t_LocalTimeCache;
+
+            /**
+             * @brief Écrit un nombre sur une largeur fixe (zéros à gauche)
+             */
+            void WriteFixed(char* out, int value, int width) {
+                for (int i = width - 1; i >= 0; --i) {
+                    out[i] = static_cast<char>('0' + value % 10);
+                    value /= 10;
+                }
+            }
+
+            /**
+             * @brief Met à jour le cache si le message change de seconde
+             */
+            const LocalTimeCache& Refresh(const LogMessage& message) {
+                const int64 second = static_cast<int64>(message.timestamp / 1000000000ULL);
+
+                LocalTimeCache& cache = t_LocalTimeCache;
+                if (cache.second != second) {
+                    cache.tm = message.GetLocalTime();
+
+                    char* out = cache.dateTime;
+                    WriteFixed(out, cache.tm.tm_year + 1900, 4);
+                    out[4] = '-';
+                    WriteFixed(out + 5, cache.tm.tm_mon + 1, 2);
+                    out[7] = '-';
+                    WriteFixed(out + 8, cache.tm.tm_mday, 2);
+                    out[10] = ' ';
+                    WriteFixed(out + 11, cache.tm.tm_hour, 2);
+                    out[13] = ':';
+                    WriteFixed(out + 14, cache.tm.tm_min, 2);
+                    out[16] = ':';
+                    WriteFixed(out + 17, cache.tm.tm_sec, 2);
+
+                    cache.second = second;
+                }
+                return cache;
+            }
+
+        } // namespace
+
+        /**
+         * @brief Obtient l'heure locale décomposée d'un message
+         */
+        const std::tm& GetCachedLocalTime(const LogMessage& message) {
+            return Refresh(message).tm;
+        }
+
+        /**
+         * @brief Obtient "YYYY-mm-dd HH:MM:SS" pour un message
+         */
+        const char* GetCachedDateTime(const LogMessage& message) {
+            return Refresh(message).dateTime;
+        }
+
+    } // namespace logger
+} // namespace nkentseu
@@ -0,0 +1,78 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/FormatUtils.h
+// DESCRIPTION: Briques de formatage partagées par le Formatter interprété et
+//              les formatters compilés (nombres, heure locale en cache).
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Logger/Export.h"
+#include "Logger/LogMessage.h"
+#include <Nkentseu/Types.h>
+#include <ctime>
+#include <string>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        /// Longueur de "YYYY-mm-dd HH:MM:SS"
+        constexpr size_t DATE_TIME_LENGTH = 19;
+
+        /**
+         * @brief Ajoute un nombre avec padding, sans passer par un flux
+         * @param result Résultat en construction
+         * @param value Valeur à écrire
+         * @param width Largeur minimum
+         * @param fillChar Caractère de remplissage
+         */
+        inline void AppendNumber(std::string& result, uint64 value, int width = 0, char fillChar = '0') {
+            char buffer[24];
+            char* end = buffer + sizeof(buffer);
+            char* begin = end;
+
+            do {
+                *--begin = static_cast<char>('0' + value % 10);
+                value /= 10;
+            } while (value != 0);
+
+            while (end - begin < width && begin > buffer) {
+                *--begin = fillChar;
+            }
+
+            result.append(begin, static_cast<size_t>(end - begin));
+        }
+
+        /**
+         * @brief Extrait le nom de fichier d'un chemin
+         * @param path Chemin complet (ex. __FILE__)
+         * @return Pointeur sur le nom de fichier dans path
+         */
+        inline const char* ExtractFileName(const char* path) {
+            const char* fileName = path;
+            for (const char* c = path; *c; ++c) {
+                if (*c == '/' || *c == '\\') fileName = c + 1;
+            }
+            return fileName;
+        }
+
+        /**
+         * @brief Obtient l'heure locale décomposée d'un message
+         * @param message Message source
+         * @return Heure locale (cache par thread, recalculée une fois par seconde)
+         */
+        LOGGER_API const std::tm& GetCachedLocalTime(const LogMessage& message);
+
+        /**
+         * @brief Obtient "YYYY-mm-dd HH:MM:SS" pour un message
+         * @param message Message source
+         * @return DATE_TIME_LENGTH caractères (cache par thread)
+         */
+        LOGGER_API const char* GetCachedDateTime(const LogMessage& message);
+
+    } // namespace logger
+} // namespace nkentseu
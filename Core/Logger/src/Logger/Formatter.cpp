@@ -6,10 +6,9 @@
 // -----------------------------------------------------------------------------
 
 #include "Logger/Formatter.h"
+#include "Logger/CompiledFormatter.h"
+#include "Logger/FormatUtils.h"
 #include "Logger/LogLevel.h"
-#include <sstream>
-#include <iomanip>
-#include <iostream>
 #include <ctime>
 
 // -----------------------------------------------------------------------------
@@ -18,11 +17,11 @@
 namespace nkentseu {
     namespace logger {
 
-        const char* Formatter::DEFAULT_PATTERN = "[%Y-%m-%d %H:%M:%S.%e] [%L] [%n] [%t] -> %v";
-        const char* Formatter::SIMPLE_PATTERN = "%v";
-        const char* Formatter::DETAILED_PATTERN = "[%Y-%m-%d %H:%M:%S.%e] [%L] [%n] [thread %t] [%s:%# in %f] -> %v";
-        const char* Formatter::COLOR_PATTERN = "[%Y-%m-%d %H:%M:%S.%e] [%^%L%$] [%n] [%t] -> %v";
-        const char* Formatter::JSON_PATTERN = R"({"time":"%Y-%m-%dT%H:%M:%S.%fZ","level":"%l","thread":%t,"logger":"%n","file":"%s","line":%#,"function":"%f","message":"%v"})";
+        const char* Formatter::DEFAULT_PATTERN = patterns::Default;
+        const char* Formatter::SIMPLE_PATTERN = patterns::Simple;
+        const char* Formatter::DETAILED_PATTERN = patterns::Detailed;
+        const char* Formatter::COLOR_PATTERN = patterns::Color;
+        const char* Formatter::JSON_PATTERN = patterns::Json;
 
     } // namespace logger
 } // namespace nkentseu
@@ -33,6 +32,40 @@ namespace nkentseu {
 namespace nkentseu {
     namespace logger {
 
+        namespace {
+
+            /// Fonction de formatage d'un pattern compilé
+            using CompiledFormatFunction = void (*)(const LogMessage&, bool, std::string&);
+
+            /**
+             * @brief Recherche la version compilée d'un pattern prédéfini
+             * @param pattern Pattern à rechercher
+             * @return Fonction de formatage, nullptr si le pattern n'est pas prédéfini
+             */
+            CompiledFormatFunction FindCompiledFormat(const std::string& pattern) {
+                struct Entry {
+                    const char* pattern;
+                    CompiledFormatFunction format;
+                };
+
+                static const Entry entries[] = {
+                    { patterns::Default, &CompiledFormatter<patterns::Default>::FormatTo },
+                    { patterns::Simple, &CompiledFormatter<patterns::Simple>::FormatTo },
+                    { patterns::Detailed, &CompiledFormatter<patterns::Detailed>::FormatTo },
+                    { patterns::Color, &CompiledFormatter<patterns::Color>::FormatTo },
+                    { patterns::Json, &CompiledFormatter<patterns::Json>::FormatTo },
+                };
+
+                for (const Entry& entry : entries) {
+                    if (pattern == entry.pattern) {
+                        return entry.format;
+                    }
+                }
+                return nullptr;
+            }
+
+        } // namespace
+
         // -------------------------------------------------------------------------
         // IMPLÉMENTATION DE Formatter
         // -------------------------------------------------------------------------
@@ -42,7 +75,8 @@ namespace nkentseu {
          */
         Formatter::Formatter()
             : m_Pattern(DEFAULT_PATTERN)
-            , m_TokensValid(false) {
+            , m_TokensValid(false)
+            , m_CompiledFormat(nullptr) {
         }
         
         /**
@@ -50,7 +84,8 @@ namespace nkentseu {
          */
         Formatter::Formatter(const std::string& pattern)
             : m_Pattern(pattern)
-            , m_TokensValid(false) {
+            , m_TokensValid(false)
+            , m_CompiledFormat(nullptr) {
             ParsePattern(pattern);
         }
         
@@ -88,24 +123,36 @@ namespace nkentseu {
          * @brief Formate un message de log avec des couleurs
          */
         std::string Formatter::Format(const LogMessage& message, bool useColors) {
+            std::string result;
+            result.reserve(256); // Pré-allocation pour performance
+            FormatTo(message, useColors, result);
+            return result;
+        }
+        
+        /**
+         * @brief Formate un message à la fin d'un tampon fourni par l'appelant
+         */
+        void Formatter::FormatTo(const LogMessage& message, bool useColors, std::string& result) {
             if (!m_TokensValid) {
                 ParsePattern(m_Pattern);
             }
             
-            std::string result;
-            result.reserve(256); // Pré-allocation pour performance
+            // Pattern prédéfini: version compilée, sans interprétation des tokens
+            if (m_CompiledFormat) {
+                m_CompiledFormat(message, useColors, result);
+                return;
+            }
             
             for (const auto& token : m_Tokens) {
                 FormatToken(token, message, useColors, result);
             }
-            
-            return result;
         }
         
         /**
          * @brief Parse le pattern en tokens
          */
         void Formatter::ParsePattern(const std::string& pattern) {
+            m_CompiledFormat = FindCompiledFormat(pattern);
             m_Tokens.clear();
             m_Tokens.reserve(pattern.size() / 2); // Estimation
             
@@ -162,9 +209,37 @@ namespace nkentseu {
                 }
             }
             
+            FuseDateTimeTokens();
             m_TokensValid = true;
         }
         
+        /**
+         * @brief Remplace la séquence %Y-%m-%d %H:%M:%S par un token DateTime
+         */
+        void Formatter::FuseDateTimeTokens() {
+            using Type = PatternToken::Type;
+            static const Type sequence[] = {
+                Type::Year, Type::Literal, Type::Month, Type::Literal, Type::Day, Type::Literal,
+                Type::Hour, Type::Literal, Type::Minute, Type::Literal, Type::Second
+            };
+            static const char* separators[] = { "-", "-", " ", ":", ":" };
+            const size_t length = sizeof(sequence) / sizeof(sequence[0]);
+            
+            for (size_t start = 0; start + length <= m_Tokens.size(); ++start) {
+                bool matches = true;
+                for (size_t j = 0; j < length && matches; ++j) {
+                    const PatternToken& token = m_Tokens[start + j];
+                    matches = token.type == sequence[j] &&
+                              (token.type != Type::Literal || token.value == separators[j / 2]);
+                }
+                
+                if (matches) {
+                    m_Tokens[start].type = Type::DateTime;
+                    m_Tokens.erase(m_Tokens.begin() + start + 1, m_Tokens.begin() + start + length);
+                }
+            }
+        }
+        
         /**
          * @brief Formate un token individuel
          */
@@ -176,50 +251,52 @@ namespace nkentseu {
                     break;
                     
                 case PatternToken::Type::Year: {
-                    auto tm = message.GetLocalTime();
-                    result += FormatNumber(tm.tm_year + 1900, 4);
+                    const std::tm& tm = GetCachedLocalTime(message);
+                    AppendNumber(result, tm.tm_year + 1900, 4);
                     break;
                 }
                     
                 case PatternToken::Type::Month: {
-                    auto tm = message.GetLocalTime();
-                    result += FormatNumber(tm.tm_mon + 1, 2);
+                    const std::tm& tm = GetCachedLocalTime(message);
+                    AppendNumber(result, tm.tm_mon + 1, 2);
                     break;
                 }
                     
                 case PatternToken::Type::Day: {
-                    auto tm = message.GetLocalTime();
-                    result += FormatNumber(tm.tm_mday, 2);
+                    const std::tm& tm = GetCachedLocalTime(message);
+                    AppendNumber(result, tm.tm_mday, 2);
                     break;
                 }
                     
                 case PatternToken::Type::Hour: {
-                    auto tm = message.GetLocalTime();
-                    result += FormatNumber(tm.tm_hour, 2);
+                    const std::tm& tm = GetCachedLocalTime(message);
+                    AppendNumber(result, tm.tm_hour, 2);
                     break;
                 }
                     
                 case PatternToken::Type::Minute: {
-                    auto tm = message.GetLocalTime();
-                    result += FormatNumber(tm.tm_min, 2);
+                    const std::tm& tm = GetCachedLocalTime(message);
+                    AppendNumber(result, tm.tm_min, 2);
                     break;
                 }
                     
                 case PatternToken::Type::Second: {
-                    auto tm = message.GetLocalTime();
-                    result += FormatNumber(tm.tm_sec, 2);
+                    const std::tm& tm = GetCachedLocalTime(message);
+                    AppendNumber(result, tm.tm_sec, 2);
                     break;
                 }
                     
+                case PatternToken::Type::DateTime:
+                    result.append(GetCachedDateTime(message), DATE_TIME_LENGTH);
+                    break;
+                    
                 case PatternToken::Type::Millis: {
-                    uint64 millis = message.GetMillis() % 1000;
-                    result += FormatNumber(static_cast<int>(millis), 3);
+                    AppendNumber(result, message.GetMillis() % 1000, 3);
                     break;
                 }
                     
                 case PatternToken::Type::Micros: {
-                    uint64 micros = message.GetMicros() % 1000000;
-                    result += FormatNumber(static_cast<int>(micros), 6);
+                    AppendNumber(result, message.GetMicros() % 1000000, 6);
                     break;
                 }
                     
@@ -231,56 +308,41 @@ namespace nkentseu {
                     result += LogLevelToShortString(message.level);
                     break;
                     
-                case PatternToken::Type::ThreadId: {
-                    std::ostringstream oss;
-                    oss << message.threadId;
-                    result += oss.str();
+                case PatternToken::Type::ThreadId:
+                    AppendNumber(result, message.threadId);
                     break;
-                }
                     
                 case PatternToken::Type::ThreadName:
-                    if (!message.threadName.empty()) {
+                    if (message.threadName[0] != '\0') {
                         result += message.threadName;
                     } else {
-                        std::ostringstream oss;
-                        oss << message.threadId;
-                        result += oss.str();
+                        AppendNumber(result, message.threadId);
                     }
                     break;
                     
                 case PatternToken::Type::SourceFile:
-                    if (!message.sourceFile.empty()) {
+                    if (message.sourceFile[0] != '\0') {
                         // Extraire juste le nom du fichier (sans chemin)
-                        size_t pos = message.sourceFile.find_last_of("/\\");
-                        if (pos != std::string::npos) {
-                            result += message.sourceFile.substr(pos + 1);
-                        } else {
-                            result += message.sourceFile;
-                        }
+                        result += ExtractFileName(message.sourceFile);
                     }
                     break;
                     
-                case PatternToken::Type::SourceLine: {
+                case PatternToken::Type::SourceLine:
                     if (message.sourceLine > 0) {
-                        std::ostringstream oss;
-                        oss << message.sourceLine;
-                        result += oss.str();
+                        AppendNumber(result, message.sourceLine);
                     }
                     break;
-                }
                     
                 case PatternToken::Type::Function:
-                    if (!message.functionName.empty()) {
-                        result += message.functionName;
-                    }
+                    result += message.functionName;
                     break;
                     
                 case PatternToken::Type::Message:
-                    result += message.message;
+                    result.append(message.message.Data(), message.message.Size());
                     break;
                     
                 case PatternToken::Type::LoggerName:
-                    if (!message.loggerName.empty()) {
+                    if (message.loggerName[0] != '\0') {
                         result += message.loggerName;
                     } else {
                         result += "default";
@@ -305,27 +367,18 @@ namespace nkentseu {
             }
         }
         
-        /**
-         * @brief Formate un nombre avec padding
-         */
-        std::string Formatter::FormatNumber(int value, int width, char fillChar) const {
-            std::ostringstream oss;
-            oss << std::setw(width) << std::setfill(fillChar) << value;
-            return oss.str();
-        }
-        
         /**
          * @brief Obtient le code couleur ANSI pour un niveau de log
          */
-        std::string Formatter::GetANSIColor(LogLevel level) const {
-            return LogLevelToANSIColor(level);
+        const std::string& Formatter::GetANSIColor(LogLevel level) const {
+            return LogLevelToANSIColorCode(level);
         }
         
         /**
          * @brief Obtient le code de fin de couleur ANSI
          */
-        std::string Formatter::GetANSIReset() const {
-            return "\033[0m";
+        const std::string& Formatter::GetANSIReset() const {
+            return ANSIResetCode();
         }
 
     } // namespace logger
@@ -9,6 +9,7 @@
 
 #include "Logger/Export.h"
 #include "Logger/LogMessage.h"
+#include "Logger/Pattern.h"
 #include <string>
 #include <memory>
 #include <vector>
@@ -33,6 +34,7 @@ namespace nkentseu {
                 Hour,       // %H - Heure (24h, 2 chiffres)
                 Minute,     // %M - Minute (2 chiffres)
                 Second,     // %S - Seconde (2 chiffres)
+                DateTime,   // %Y-%m-%d %H:%M:%S fusionnés au parsing
                 Millis,     // %e - Millisecondes (3 chiffres)
                 Micros,     // %f - Microsecondes (6 chiffres)
                 Level,      // %l - Niveau de log (texte)
@@ -114,6 +116,17 @@ namespace nkentseu {
              */
             std::string Format(const LogMessage& message, bool useColors);
             
+            /**
+             * @brief Formate un message à la fin d'un tampon fourni par l'appelant
+             * @param message Message à formater
+             * @param useColors true pour inclure les codes couleur
+             * @param result Tampon réutilisable (le contenu existant est conservé)
+             *
+             * Évite l'allocation d'une chaîne par message: un tampon vidé puis
+             * réutilisé garde sa capacité d'un message à l'autre.
+             */
+            void FormatTo(const LogMessage& message, bool useColors, std::string& result);
+            
             // ---------------------------------------------------------------------
             // PATTERNS PRÉDÉFINIS
             // ---------------------------------------------------------------------
@@ -154,6 +167,11 @@ namespace nkentseu {
              */
             void ParsePattern(const std::string& pattern);
             
+            /**
+             * @brief Remplace la séquence %Y-%m-%d %H:%M:%S par un token DateTime
+             */
+            void FuseDateTimeTokens();
+            
             /**
              * @brief Formate un token individuel
              * @param token Token à formater
@@ -164,27 +182,18 @@ namespace nkentseu {
             void FormatToken(const PatternToken& token, const LogMessage& message,
                             bool useColors, std::string& result);
             
-            /**
-             * @brief Formate un nombre avec padding
-             * @param value Valeur à formater
-             * @param width Largeur minimum
-             * @param fillChar Caractère de remplissage
-             * @return Chaîne formatée
-             */
-            std::string FormatNumber(int value, int width = 2, char fillChar = '0') const;
-            
             /**
              * @brief Obtient le code couleur ANSI pour un niveau de log
              * @param level Niveau de log
-             * @return Code couleur ANSI
+             * @return Code couleur ANSI (pré-rendu, voir LogLevelToANSIColorCode)
              */
-            std::string GetANSIColor(LogLevel level) const;
+            const std::string& GetANSIColor(LogLevel level) const;
             
             /**
              * @brief Obtient le code de fin de couleur ANSI
              * @return Code de fin de couleur
              */
-            std::string GetANSIReset() const;
+            const std::string& GetANSIReset() const;
             
             // ---------------------------------------------------------------------
             // VARIABLES MEMBRE PRIVÉES
@@ -198,6 +207,9 @@ namespace nkentseu {
             
             /// Indicateur si les tokens sont valides
             bool m_TokensValid;
+            
+            /// Version compilée du pattern courant (nullptr si pattern dynamique)
+            void (*m_CompiledFormat)(const LogMessage&, bool, std::string&);
         };
 
         // -------------------------------------------------------------------------
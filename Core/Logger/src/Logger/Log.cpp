@@ -44,6 +44,8 @@ namespace nkentseu {
             // Configuration par défaut
             SetLevel(LogLevel::Info);
             SetPattern(Formatter::DEFAULT_PATTERN);
+            
+            s_Initialized = true;
         }
         
         /**
@@ -57,8 +59,8 @@ namespace nkentseu {
          * @brief Obtient l'instance singleton
          */
         NkentseuLogger& NkentseuLogger::Instance() {
+            // Pas d'écriture partagée ici: appelé par chaque 'logs', depuis tout thread
             static NkentseuLogger instance;
-            s_Initialized = true;
             return instance;
         }
         
@@ -85,13 +87,6 @@ namespace nkentseu {
             instance.ClearSinks();
         }
         
-        /**
-         * @brief Configure les informations de source
-         */
-        // SourceContext NkentseuLogger::Source(const char* file, int line, const char* function) const {
-        //     return SourceContext(file, line, function);
-        // }
-        
         /**
          * @brief Configure le nom du logger
          */
@@ -116,11 +111,5 @@ namespace nkentseu {
             return *this;
         }
 
-
-        NkentseuLogger& NkentseuLogger::Source(const char* sourceFile, uint32 sourceLine, const char* functionName) {
-            Logger::Source(sourceFile, sourceLine, functionName);
-            return *this;
-        }
-
     } // namespace logger
 } // namespace nkentseu
\ No newline at end of file
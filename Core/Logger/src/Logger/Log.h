@@ -52,15 +52,6 @@ namespace nkentseu {
                 // API FLUIDE
                 // ---------------------------------------------------------------------
                 
-                /**
-                 * @brief Configure les informations de source pour le prochain log
-                 * @param file Fichier source
-                 * @param line Ligne source
-                 * @param function Fonction source
-                 * @return Objet SourceContext pour chaînage
-                 */
-                // SourceContext Source(const char* file, int line, const char* function) const;
-                
                 /**
                  * @brief Configure le nom du logger (retourne *this pour chaînage)
                  */
@@ -76,9 +67,6 @@ namespace nkentseu {
                  */
                 NkentseuLogger& Pattern(const std::string& pattern);
 
-
-                virtual NkentseuLogger& Source(const char* sourceFile = nullptr, uint32 sourceLine = 0, const char* functionName = nullptr) override;
-
             private:
                 // ---------------------------------------------------------------------
                 // CONSTRUCTEURS PRIVÉS (SINGLETON)
@@ -119,14 +107,53 @@ namespace nkentseu {
 // MACRO PRINCIPALE POUR UN USAGE SIMPLIFIÉ
 // -----------------------------------------------------------------------------
 
-/// Macro pour obtenir le logger par défaut avec informations de source
-#define logs nkentseu::logger::NkentseuLogger::Instance().Source(__FILE__, __LINE__, __FUNCTION__)
+/// Macro pour obtenir le logger par défaut avec informations de source.
+/// Produit un SourceContext temporaire: l'emplacement voyage avec l'appel,
+/// sans écriture partagée dans le singleton (sûr entre threads).
+#define logs nkentseu::logger::SourceContext(nkentseu::logger::NkentseuLogger::Instance(), NK_SOURCE_LOCATION)
+
+/// Appel du logger par défaut, niveau testé avant l'évaluation des arguments.
+/// Contrairement à 'logs', rien n'est écrit dans le logger si le niveau est inactif.
+#define NK_DEFAULT_LOG_IF(level, ...) \
+    if (auto& nkDefaultLogger_ = nkentseu::logger::NkentseuLogger::Instance(); \
+        !nkDefaultLogger_.ShouldLog(level)) {} \
+    else nkDefaultLogger_.Log(level, __FILE__, __LINE__, __FUNCTION__, __VA_ARGS__)
 
-/// Macros raccourcis pour un usage direct (sans informations de source)
-#define NK_LOG_TRACE(...) nkentseu::logger::NkentseuLogger::Instance().Trace(__VA_ARGS__)
-#define NK_LOG_DEBUG(...) nkentseu::logger::NkentseuLogger::Instance().Debug(__VA_ARGS__)
-#define NK_LOG_INFO(...)  nkentseu::logger::NkentseuLogger::Instance().Info(__VA_ARGS__)
-#define NK_LOG_WARN(...)  nkentseu::logger::NkentseuLogger::Instance().Warn(__VA_ARGS__)
-#define NK_LOG_ERROR(...) nkentseu::logger::NkentseuLogger::Instance().Error(__VA_ARGS__)
-#define NK_LOG_CRITICAL(...) nkentseu::logger::NkentseuLogger::Instance().Critical(__VA_ARGS__)
-#define NK_LOG_FATAL(...) nkentseu::logger::NkentseuLogger::Instance().Fatal(__VA_ARGS__)
\ No newline at end of file
+/// Macros raccourcis avec informations de source, retirées à la compilation
+/// en dessous de NK_LOG_ACTIVE_LEVEL (voir LogLevel.h). 'logs' reste évalué
+/// à l'exécution: préférer ces macros sur les chemins chauds.
+#if NK_LOG_ACTIVE_LEVEL <= NK_LOG_LEVEL_TRACE
+    #define NK_LOG_TRACE(...) NK_DEFAULT_LOG_IF(nkentseu::logger::LogLevel::Trace, __VA_ARGS__)
+#else
+    #define NK_LOG_TRACE(...) ((void)0)
+#endif
+#if NK_LOG_ACTIVE_LEVEL <= NK_LOG_LEVEL_DEBUG
+    #define NK_LOG_DEBUG(...) NK_DEFAULT_LOG_IF(nkentseu::logger::LogLevel::Debug, __VA_ARGS__)
+#else
+    #define NK_LOG_DEBUG(...) ((void)0)
+#endif
+#if NK_LOG_ACTIVE_LEVEL <= NK_LOG_LEVEL_INFO
+    #define NK_LOG_INFO(...) NK_DEFAULT_LOG_IF(nkentseu::logger::LogLevel::Info, __VA_ARGS__)
+#else
+    #define NK_LOG_INFO(...) ((void)0)
+#endif
+#if NK_LOG_ACTIVE_LEVEL <= NK_LOG_LEVEL_WARN
+    #define NK_LOG_WARN(...) NK_DEFAULT_LOG_IF(nkentseu::logger::LogLevel::Warn, __VA_ARGS__)
+#else
+    #define NK_LOG_WARN(...) ((void)0)
+#endif
+#if NK_LOG_ACTIVE_LEVEL <= NK_LOG_LEVEL_ERROR
+    #define NK_LOG_ERROR(...) NK_DEFAULT_LOG_IF(nkentseu::logger::LogLevel::Error, __VA_ARGS__)
+#else
+    #define NK_LOG_ERROR(...) ((void)0)
+#endif
+#if NK_LOG_ACTIVE_LEVEL <= NK_LOG_LEVEL_CRITICAL
+    #define NK_LOG_CRITICAL(...) NK_DEFAULT_LOG_IF(nkentseu::logger::LogLevel::Critical, __VA_ARGS__)
+#else
+    #define NK_LOG_CRITICAL(...) ((void)0)
+#endif
+#if NK_LOG_ACTIVE_LEVEL <= NK_LOG_LEVEL_FATAL
+    #define NK_LOG_FATAL(...) NK_DEFAULT_LOG_IF(nkentseu::logger::LogLevel::Fatal, __VA_ARGS__)
+#else
+    #define NK_LOG_FATAL(...) ((void)0)
+#endif
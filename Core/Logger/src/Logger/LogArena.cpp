@@ -0,0 +1,122 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/LogArena.cpp
+// DESCRIPTION: Implémentation de l'arène de blocs pour les messages longs.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#include "Logger/LogArena.h"
+#include <atomic>
+#include <mutex>
+#include <new>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        namespace {
+
+            /// Nombre de blocs découpés dans chaque slab
+            constexpr size_t BLOCKS_PER_SLAB = 16;
+
+            /// Nombre de classes de taille
+            constexpr size_t SIZE_CLASS_COUNT = 3;
+
+            /// Tailles des classes de blocs
+            constexpr size_t SIZE_CLASSES[SIZE_CLASS_COUNT] = { 1024, 4096, LogArena::MAX_BLOCK_SIZE };
+
+            /// Bloc libre chaîné (stocké dans le bloc lui-même)
+            struct FreeBlock {
+                FreeBlock* next;
+            };
+
+            /// Liste libre d'une classe de taille
+            struct SizeClass {
+                std::mutex mutex;
+                FreeBlock* head = nullptr;
+            };
+
+            /// Listes libres globales (construites au premier usage)
+            SizeClass* GetSizeClasses() {
+                static SizeClass classes[SIZE_CLASS_COUNT];
+                return classes;
+            }
+
+            /// Compteur de slabs alloués
+            std::atomic<size_t> s_SlabCount(0);
+
+        } // namespace
+
+        // -------------------------------------------------------------------------
+        // IMPLÉMENTATION DE LogArena
+        // -------------------------------------------------------------------------
+
+        /**
+         * @brief Alloue un bloc d'au moins size octets
+         */
+        char* LogArena::Allocate(size_t size, size_t& capacity) {
+            for (size_t index = 0; index < SIZE_CLASS_COUNT; ++index) {
+                if (size > SIZE_CLASSES[index]) {
+                    continue;
+                }
+
+                SizeClass& sizeClass = GetSizeClasses()[index];
+                capacity = SIZE_CLASSES[index];
+
+                std::lock_guard<std::mutex> lock(sizeClass.mutex);
+
+                if (!sizeClass.head) {
+                    // Découper un nouveau slab (jamais libéré: mémoire recyclée)
+                    char* slab = static_cast<char*>(::operator new(capacity * BLOCKS_PER_SLAB));
+                    for (size_t i = 0; i < BLOCKS_PER_SLAB; ++i) {
+                        FreeBlock* block = reinterpret_cast<FreeBlock*>(slab + i * capacity);
+                        block->next = sizeClass.head;
+                        sizeClass.head = block;
+                    }
+                    s_SlabCount.fetch_add(1, std::memory_order_relaxed);
+                }
+
+                FreeBlock* block = sizeClass.head;
+                sizeClass.head = block->next;
+                return reinterpret_cast<char*>(block);
+            }
+
+            // Message exceptionnellement long: allocation directe
+            capacity = size;
+            return new char[size];
+        }
+
+        /**
+         * @brief Rend un bloc à l'arène
+         */
+        void LogArena::Release(char* block, size_t capacity) {
+            if (!block) return;
+
+            for (size_t index = 0; index < SIZE_CLASS_COUNT; ++index) {
+                if (capacity != SIZE_CLASSES[index]) {
+                    continue;
+                }
+
+                SizeClass& sizeClass = GetSizeClasses()[index];
+                std::lock_guard<std::mutex> lock(sizeClass.mutex);
+
+                FreeBlock* freeBlock = reinterpret_cast<FreeBlock*>(block);
+                freeBlock->next = sizeClass.head;
+                sizeClass.head = freeBlock;
+                return;
+            }
+
+            delete[] block;
+        }
+
+        /**
+         * @brief Obtient le nombre de slabs alloués
+         */
+        size_t LogArena::GetSlabCount() {
+            return s_SlabCount.load(std::memory_order_relaxed);
+        }
+
+    } // namespace logger
+} // namespace nkentseu
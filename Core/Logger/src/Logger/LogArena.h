@@ -0,0 +1,57 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/LogArena.h
+// DESCRIPTION: Arène de blocs recyclés pour les messages de log trop longs
+//              pour le tampon inline de MessageBuffer.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Logger/Export.h"
+#include <Nkentseu/Types.h>
+#include <cstddef>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        // -------------------------------------------------------------------------
+        // CLASSE: LogArena
+        // DESCRIPTION: Allocateur global par classes de taille (1, 4 et 16 Ko).
+        //              Les blocs sont découpés dans des slabs alloués une seule
+        //              fois puis recyclés via une liste libre: après la phase de
+        //              chauffe, un message long ne provoque plus d'allocation.
+        //              Au-delà de la plus grande classe, repli sur le tas.
+        // -------------------------------------------------------------------------
+        class LOGGER_API LogArena {
+            public:
+                /// Taille de la plus grande classe de blocs recyclés
+                static constexpr size_t MAX_BLOCK_SIZE = 16 * 1024;
+
+                /**
+                 * @brief Alloue un bloc d'au moins size octets
+                 * @param size Taille demandée
+                 * @param capacity Capacité réelle du bloc retourné
+                 * @return Bloc alloué
+                 */
+                static char* Allocate(size_t size, size_t& capacity);
+
+                /**
+                 * @brief Rend un bloc à l'arène (thread-safe, depuis n'importe quel thread)
+                 * @param block Bloc retourné par Allocate
+                 * @param capacity Capacité retournée par Allocate
+                 */
+                static void Release(char* block, size_t capacity);
+
+                /**
+                 * @brief Obtient le nombre de slabs alloués depuis le démarrage
+                 * @return Nombre de slabs
+                 */
+                static size_t GetSlabCount();
+        };
+
+    } // namespace logger
+} // namespace nkentseu
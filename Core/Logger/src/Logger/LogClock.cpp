@@ -0,0 +1,278 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/LogClock.cpp
+// DESCRIPTION: Implémentation de l'horloge des messages et de sa calibration.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#include "Logger/LogClock.h"
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #define NK_LOG_HAS_TSC 1
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #else
+        #include <x86intrin.h>
+        #include <cpuid.h>
+    #endif
+#else
+    #define NK_LOG_HAS_TSC 0
+#endif
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        namespace {
+
+            /// Durée de la mesure initiale de la fréquence TSC
+            const uint64 TSC_WARMUP_NS = 2000000ULL;
+
+            // ---------------------------------------------------------------------
+            // STRUCTURE: Calibration
+            // DESCRIPTION: Conversion tick -> heure murale en vigueur
+            // ---------------------------------------------------------------------
+            struct Calibration {
+                ClockSource source;
+                uint64 baseTicks;
+                uint64 baseNs;
+                double nsPerTick;
+                uint64 nextNs;
+            };
+
+            /// Source demandée (System: pas de calibration consultée)
+            std::atomic<ClockSource> s_Source(ClockSource::System);
+
+            /// Période de recalage (ns)
+            std::atomic<uint64> s_CalibrationPeriod(LogClock::DEFAULT_CALIBRATION_PERIOD);
+
+            // Calibration publiée par verrou de séquence: un numéro impair
+            // signale une écriture en cours, le lecteur recommence alors
+            std::atomic<uint32> s_Sequence(0);
+            std::atomic<uint8> s_CalSource(static_cast<uint8>(ClockSource::Monotonic));
+            std::atomic<uint64> s_CalBaseTicks(0);
+            std::atomic<uint64> s_CalBaseNs(0);
+            std::atomic<uint64> s_CalNsPerTickBits(0);
+            std::atomic<uint64> s_CalNextNs(0);
+
+            /// Sérialise les écrivains; protège aussi les ancres ci-dessous
+            std::mutex s_CalibrationMutex;
+
+            /// Point de départ de la mesure de fréquence TSC (tick, steady ns)
+            uint64 s_AnchorTicks = 0;
+            uint64 s_AnchorSteadyNs = 0;
+
+            uint64 WallNow() {
+                return static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::system_clock::now().time_since_epoch()).count());
+            }
+
+            uint64 SteadyNow() {
+                return static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count());
+            }
+
+            uint64 ReadTicks(ClockSource source) {
+                #if NK_LOG_HAS_TSC
+                    if (source == ClockSource::Tsc) {
+                        return __rdtsc();
+                    }
+                #endif
+                return SteadyNow();
+            }
+
+            uint64 DoubleBits(double value) {
+                uint64 bits;
+                std::memcpy(&bits, &value, sizeof(bits));
+                return bits;
+            }
+
+            double BitsDouble(uint64 bits) {
+                double value;
+                std::memcpy(&value, &bits, sizeof(value));
+                return value;
+            }
+
+            Calibration LoadCalibration() {
+                Calibration calibration;
+                uint32 before;
+                uint32 after;
+                do {
+                    before = s_Sequence.load(std::memory_order_acquire);
+                    calibration.source = static_cast<ClockSource>(s_CalSource.load(std::memory_order_relaxed));
+                    calibration.baseTicks = s_CalBaseTicks.load(std::memory_order_relaxed);
+                    calibration.baseNs = s_CalBaseNs.load(std::memory_order_relaxed);
+                    calibration.nsPerTick = BitsDouble(s_CalNsPerTickBits.load(std::memory_order_relaxed));
+                    calibration.nextNs = s_CalNextNs.load(std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    after = s_Sequence.load(std::memory_order_relaxed);
+                } while (before != after || (before & 1) != 0);
+                return calibration;
+            }
+
+            /// Écrit une calibration (appelé sous s_CalibrationMutex)
+            void StoreCalibration(const Calibration& calibration) {
+                s_Sequence.fetch_add(1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+                s_CalSource.store(static_cast<uint8>(calibration.source), std::memory_order_relaxed);
+                s_CalBaseTicks.store(calibration.baseTicks, std::memory_order_relaxed);
+                s_CalBaseNs.store(calibration.baseNs, std::memory_order_relaxed);
+                s_CalNsPerTickBits.store(DoubleBits(calibration.nsPerTick), std::memory_order_relaxed);
+                s_CalNextNs.store(calibration.nextNs, std::memory_order_relaxed);
+                s_Sequence.fetch_add(1, std::memory_order_release);
+            }
+
+            /// Recale la source sur l'heure murale (appelé sous s_CalibrationMutex)
+            void CalibrateLocked(ClockSource source) {
+                // Tick pris de part et d'autre de l'heure murale: milieu retenu
+                const uint64 ticksBefore = ReadTicks(source);
+                const uint64 wall = WallNow();
+                const uint64 ticksAfter = ReadTicks(source);
+
+                Calibration calibration;
+                calibration.source = source;
+                calibration.baseTicks = ticksBefore + (ticksAfter - ticksBefore) / 2;
+                calibration.baseNs = wall;
+                calibration.nsPerTick = 1.0;
+                calibration.nextNs = wall + s_CalibrationPeriod.load(std::memory_order_relaxed);
+
+                // Fréquence mesurée contre steady_clock depuis l'ancre: la base
+                // s'allonge à chaque recalage et l'estimation s'affine
+                if (source == ClockSource::Tsc) {
+                    const uint64 steady = SteadyNow();
+                    if (calibration.baseTicks > s_AnchorTicks && steady > s_AnchorSteadyNs) {
+                        calibration.nsPerTick = static_cast<double>(steady - s_AnchorSteadyNs) /
+                                                static_cast<double>(calibration.baseTicks - s_AnchorTicks);
+                    }
+                }
+
+                StoreCalibration(calibration);
+            }
+
+        } // namespace
+
+        // -------------------------------------------------------------------------
+        // IMPLÉMENTATION DE LogClock
+        // -------------------------------------------------------------------------
+
+        /**
+         * @brief Horodatage courant
+         */
+        uint64 LogClock::Now() {
+            if (s_Source.load(std::memory_order_relaxed) == ClockSource::System) {
+                return WallNow();
+            }
+
+            const Calibration calibration = LoadCalibration();
+            const int64 delta = static_cast<int64>(ReadTicks(calibration.source) - calibration.baseTicks);
+            const uint64 now = calibration.baseNs +
+                               static_cast<int64>(static_cast<double>(delta) * calibration.nsPerTick);
+
+            // Personne n'a recalé à temps (pas de logger asynchrone): le faire ici
+            if (now >= calibration.nextNs) {
+                CalibrateIfDue();
+            }
+            return now;
+        }
+
+        /**
+         * @brief Change la source des horodatages
+         */
+        void LogClock::SetSource(ClockSource source) {
+            if (source == ClockSource::Tsc && !IsTscAvailable()) {
+                source = ClockSource::Monotonic;
+            }
+
+            std::lock_guard<std::mutex> lock(s_CalibrationMutex);
+            if (source == ClockSource::Tsc) {
+                // Première estimation de la fréquence sur une courte attente active
+                s_AnchorTicks = ReadTicks(ClockSource::Tsc);
+                s_AnchorSteadyNs = SteadyNow();
+                while (SteadyNow() - s_AnchorSteadyNs < TSC_WARMUP_NS) {
+                    std::this_thread::yield();
+                }
+            }
+
+            if (source != ClockSource::System) {
+                CalibrateLocked(source);
+            }
+            s_Source.store(source, std::memory_order_release);
+        }
+
+        /**
+         * @brief Source courante
+         */
+        ClockSource LogClock::GetSource() {
+            return s_Source.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Indique si le compteur TSC est utilisable
+         *
+         * Exige un TSC invariant (fréquence constante, continue en veille),
+         * sinon la conversion en nanosecondes dériverait.
+         */
+        bool LogClock::IsTscAvailable() {
+            #if NK_LOG_HAS_TSC
+                #if defined(_MSC_VER)
+                    int registers[4] = {};
+                    __cpuid(registers, 0x80000000);
+                    if (static_cast<unsigned>(registers[0]) < 0x80000007u) return false;
+                    __cpuid(registers, 0x80000007);
+                    return (registers[3] & (1 << 8)) != 0;
+                #else
+                    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+                    if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx)) return false;
+                    return (edx & (1u << 8)) != 0;
+                #endif
+            #else
+                return false;
+            #endif
+        }
+
+        /**
+         * @brief Définit la période de recalage
+         */
+        void LogClock::SetCalibrationPeriod(uint64 periodNs) {
+            s_CalibrationPeriod.store(periodNs, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Recale immédiatement la source sur l'heure murale
+         */
+        void LogClock::Calibrate() {
+            std::lock_guard<std::mutex> lock(s_CalibrationMutex);
+            const ClockSource source = s_Source.load(std::memory_order_relaxed);
+            if (source != ClockSource::System) {
+                CalibrateLocked(source);
+            }
+        }
+
+        /**
+         * @brief Recale si la période est écoulée
+         */
+        void LogClock::CalibrateIfDue() {
+            const ClockSource source = s_Source.load(std::memory_order_relaxed);
+            if (source == ClockSource::System) return;
+
+            if (WallNow() < s_CalNextNs.load(std::memory_order_relaxed)) return;
+
+            // Un seul thread recale; les autres continuent avec l'ancienne base
+            std::unique_lock<std::mutex> lock(s_CalibrationMutex, std::try_to_lock);
+            if (!lock.owns_lock()) return;
+
+            // Relire: un autre thread a pu recaler entre-temps
+            if (WallNow() >= s_CalNextNs.load(std::memory_order_relaxed)) {
+                CalibrateLocked(s_Source.load(std::memory_order_relaxed));
+            }
+        }
+
+    } // namespace logger
+} // namespace nkentseu
@@ -0,0 +1,100 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/LogClock.h
+// DESCRIPTION: Horloge d'horodatage des messages: horloge système, horloge
+//              monotone ou compteur TSC, recalées périodiquement sur l'heure
+//              murale.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Logger/Export.h"
+#include <Nkentseu/Types.h>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        // -------------------------------------------------------------------------
+        // ÉNUMÉRATION: ClockSource
+        // DESCRIPTION: Source des horodatages
+        // -------------------------------------------------------------------------
+        enum class ClockSource : uint8 {
+            /// std::chrono::system_clock à chaque message (par défaut)
+            System,
+
+            /// std::chrono::steady_clock décalée sur l'heure murale
+            Monotonic,
+
+            /// Compteur de cycles (rdtsc) converti en heure murale; se replie
+            /// sur Monotonic hors x86
+            Tsc
+        };
+
+        // -------------------------------------------------------------------------
+        // CLASSE: LogClock
+        // DESCRIPTION: Horloge globale des messages. Now() retourne toujours des
+        //              nanosecondes depuis l'epoch (heure murale), quelle que soit
+        //              la source: les enregistrements ne portent qu'une valeur de
+        //              64 bits.
+        //
+        //              Pour Monotonic et Tsc, Now() lit la source puis applique
+        //              la dernière calibration (base murale, base de la source,
+        //              nanosecondes par tick). Calibrate() relit l'heure murale
+        //              et recale la base; le thread du logger asynchrone l'appelle
+        //              via CalibrateIfDue(), et Now() le fait aussi lorsque la
+        //              période est dépassée. Un recalage peut décaler les
+        //              horodatages de quelques microsecondes.
+        // -------------------------------------------------------------------------
+        class LOGGER_API LogClock {
+            public:
+                /// Période de calibration par défaut (ns)
+                static constexpr uint64 DEFAULT_CALIBRATION_PERIOD = 1000000000ULL;
+
+                /**
+                 * @brief Horodatage courant
+                 * @return Nanosecondes depuis l'epoch (heure murale)
+                 */
+                static uint64 Now();
+
+                /**
+                 * @brief Change la source des horodatages
+                 * @param source Nouvelle source
+                 *
+                 * Tsc mesure la fréquence du compteur sur ~2 ms avant de
+                 * retourner. À appeler à l'initialisation de préférence.
+                 */
+                static void SetSource(ClockSource source);
+
+                /**
+                 * @brief Source courante (Tsc devient Monotonic si indisponible)
+                 */
+                static ClockSource GetSource();
+
+                /**
+                 * @brief Indique si le compteur TSC est utilisable sur cette cible
+                 */
+                static bool IsTscAvailable();
+
+                /**
+                 * @brief Définit la période de recalage sur l'heure murale
+                 * @param periodNs Période en nanosecondes
+                 */
+                static void SetCalibrationPeriod(uint64 periodNs);
+
+                /**
+                 * @brief Recale immédiatement la source sur l'heure murale
+                 */
+                static void Calibrate();
+
+                /**
+                 * @brief Recale si la période est écoulée (sinon: une lecture de l'heure)
+                 */
+                static void CalibrateIfDue();
+        };
+
+    } // namespace logger
+} // namespace nkentseu
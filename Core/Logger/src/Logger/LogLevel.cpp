@@ -108,6 +108,32 @@ namespace nkentseu {
             }
         }
         
+        /**
+         * @brief Obtient le code couleur ANSI pré-rendu d'un niveau de log
+         */
+        const std::string& LogLevelToANSIColorCode(LogLevel level) {
+            static const std::string codes[] = {
+                LogLevelToANSIColor(LogLevel::Trace),
+                LogLevelToANSIColor(LogLevel::Debug),
+                LogLevelToANSIColor(LogLevel::Info),
+                LogLevelToANSIColor(LogLevel::Warn),
+                LogLevelToANSIColor(LogLevel::Error),
+                LogLevelToANSIColor(LogLevel::Critical),
+                LogLevelToANSIColor(LogLevel::Fatal),
+                LogLevelToANSIColor(LogLevel::Off)
+            };
+            const size_t index = static_cast<size_t>(level);
+            return index < sizeof(codes) / sizeof(codes[0]) ? codes[index] : ANSIResetCode();
+        }
+        
+        /**
+         * @brief Obtient le code ANSI de fin de couleur pré-rendu
+         */
+        const std::string& ANSIResetCode() {
+            static const std::string reset("\033[0m");
+            return reset;
+        }
+        
         /**
          * @brief Obtient la couleur Windows associée à un niveau de log
          */
@@ -10,6 +10,27 @@
 #include <string>
 #include <Nkentseu/Types.h>
 
+// -----------------------------------------------------------------------------
+// NIVEAU MINIMUM À LA COMPILATION
+// DESCRIPTION: Les macros de log (LOG_*, NK_LOG_*) d'un niveau inférieur à
+//              NK_LOG_ACTIVE_LEVEL sont remplacées par ((void)0): ni appel,
+//              ni test de niveau, ni évaluation des arguments. À définir pour
+//              tout le projet, par exemple defines(["NK_LOG_ACTIVE_LEVEL=2"])
+//              pour ne garder que Info et au-delà. Valeurs identiques à LogLevel.
+// -----------------------------------------------------------------------------
+#define NK_LOG_LEVEL_TRACE    0
+#define NK_LOG_LEVEL_DEBUG    1
+#define NK_LOG_LEVEL_INFO     2
+#define NK_LOG_LEVEL_WARN     3
+#define NK_LOG_LEVEL_ERROR    4
+#define NK_LOG_LEVEL_CRITICAL 5
+#define NK_LOG_LEVEL_FATAL    6
+#define NK_LOG_LEVEL_OFF      7
+
+#ifndef NK_LOG_ACTIVE_LEVEL
+    #define NK_LOG_ACTIVE_LEVEL NK_LOG_LEVEL_TRACE
+#endif
+
 // -----------------------------------------------------------------------------
 // NAMESPACE: nkentseu::logger
 // -----------------------------------------------------------------------------
@@ -46,6 +67,9 @@ namespace nkentseu {
             Off = 7
         };
 
+        static_assert(static_cast<int>(LogLevel::Off) == NK_LOG_LEVEL_OFF,
+                      "NK_LOG_LEVEL_* doit suivre les valeurs de LogLevel");
+
         // -------------------------------------------------------------------------
         // FONCTIONS UTILITAIRES POUR LogLevel
         // -------------------------------------------------------------------------
@@ -85,6 +109,20 @@ namespace nkentseu {
          */
         const char* LogLevelToANSIColor(LogLevel level);
         
+        /**
+         * @brief Obtient le code couleur ANSI pré-rendu d'un niveau de log
+         * @param level Niveau de log
+         * @return Code couleur ANSI, construit une fois par niveau (ajout sans
+         *         strlen ni chaîne temporaire)
+         */
+        const std::string& LogLevelToANSIColorCode(LogLevel level);
+        
+        /**
+         * @brief Obtient le code ANSI de fin de couleur pré-rendu
+         * @return Code de réinitialisation ANSI
+         */
+        const std::string& ANSIResetCode();
+        
         /**
          * @brief Obtient la couleur Windows associée à un niveau de log
          * @param level Niveau de log
@@ -6,9 +6,12 @@
 // -----------------------------------------------------------------------------
 
 #include "Logger/LogMessage.h"
+#include "Logger/DeferredFormat.h"
+#include "Logger/LogClock.h"
+#include "Logger/ThreadInfo.h"
 #include <chrono>
+#include <cstring>
 #include <ctime>
-#include <thread>
 
 // -----------------------------------------------------------------------------
 // NAMESPACE: nkentseu::logger
@@ -24,27 +27,28 @@ namespace nkentseu {
          * @brief Constructeur par défaut
          */
         LogMessage::LogMessage()
-            : timestamp(0)
-            , timePoint(std::chrono::system_clock::now())
+            : timestamp(LogClock::Now())
             , threadId(0)
+            , level(LogLevel::Info)
+            , loggerName("")
+            , deferredFormat(nullptr)
+            , sourceFile("")
             , sourceLine(0)
-            , level(LogLevel::Info) {
-            // Conversion du time_point en timestamp nanosecondes
-            timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
-                timePoint.time_since_epoch()).count();
+            , functionName("") {
+            threadName[0] = '\0';
             
-            // Obtention de l'ID du thread
-            threadId = static_cast<uint32>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+            // Index du thread (cache thread_local, pas de hachage)
+            threadId = GetCurrentThreadInfo().index;
         }
         
         /**
          * @brief Constructeur avec niveau et message
          */
-        LogMessage::LogMessage(LogLevel lvl, const std::string& msg, const std::string& logger)
+        LogMessage::LogMessage(LogLevel lvl, const std::string& msg, const char* logger)
             : LogMessage() {
             level = lvl;
             message = msg;
-            if (!logger.empty()) {
+            if (logger) {
                 loggerName = logger;
             }
         }
@@ -53,49 +57,80 @@ namespace nkentseu {
          * @brief Constructeur avec informations complètes
          */
         LogMessage::LogMessage(LogLevel lvl, const std::string& msg,
-                            const std::string& file, uint32 line, const std::string& func,
-                            const std::string& logger)
+                            const char* file, uint32 line, const char* func,
+                            const char* logger)
             : LogMessage(lvl, msg, logger) {
-            if (!file.empty()) sourceFile = file;
+            if (file) sourceFile = file;
             if (line > 0) sourceLine = line;
-            if (!func.empty()) functionName = func;
+            if (func) functionName = func;
         }
         
         /**
          * @brief Réinitialise le message
          */
         void LogMessage::Reset() {
-            timestamp = 0;
-            timePoint = std::chrono::system_clock::now();
+            timestamp = LogClock::Now();
             threadId = 0;
-            threadName.clear();
+            threadName[0] = '\0';
             level = LogLevel::Info;
-            message.clear();
-            loggerName.clear();
-            sourceFile.clear();
+            message.Clear();
+            loggerName = "";
+            deferredFormat = nullptr;
+            sourceFile = "";
             sourceLine = 0;
-            functionName.clear();
+            functionName = "";
             
-            // Recalcul du timestamp
-            timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
-                timePoint.time_since_epoch()).count();
+            // Index du thread courant
+            threadId = GetCurrentThreadInfo().index;
+        }
+        
+        /**
+         * @brief Définit le nom du thread
+         */
+        void LogMessage::SetThreadName(const char* name) {
+            if (!name) {
+                threadName[0] = '\0';
+                return;
+            }
+            std::strncpy(threadName, name, THREAD_NAME_CAPACITY - 1);
+            threadName[THREAD_NAME_CAPACITY - 1] = '\0';
+        }
+        
+        /**
+         * @brief Produit le texte d'un message à format différé
+         */
+        void LogMessage::ResolveDeferred() {
+            if (!deferredFormat) {
+                return;
+            }
             
-            // Recalcul de l'ID du thread
-            threadId = static_cast<uint32>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+            MessageBuffer text;
+            FormatDeferred(deferredFormat, message.Data(), message.Size(), text);
+            message = std::move(text);
+            deferredFormat = nullptr;
         }
         
         /**
          * @brief Vérifie si le message est valide
          */
         bool LogMessage::IsValid() const {
-            return !message.empty() && timestamp > 0;
+            return !message.IsEmpty() && timestamp > 0;
+        }
+        
+        /**
+         * @brief Obtient l'horodatage sous forme de time_point
+         */
+        std::chrono::system_clock::time_point LogMessage::GetTimePoint() const {
+            return std::chrono::system_clock::time_point(
+                std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                    std::chrono::nanoseconds(timestamp)));
         }
         
         /**
          * @brief Obtient l'heure sous forme de structure tm
          */
         std::tm LogMessage::GetLocalTime() const {
-            auto time = std::chrono::system_clock::to_time_t(timePoint);
+            auto time = std::chrono::system_clock::to_time_t(GetTimePoint());
             std::tm localTime;
             
             #ifdef _WIN32
@@ -111,7 +146,7 @@ namespace nkentseu {
          * @brief Obtient l'heure sous forme de structure tm (UTC)
          */
         std::tm LogMessage::GetUTCTime() const {
-            auto time = std::chrono::system_clock::to_time_t(timePoint);
+            auto time = std::chrono::system_clock::to_time_t(GetTimePoint());
             std::tm utcTime;
             
             #ifdef _WIN32
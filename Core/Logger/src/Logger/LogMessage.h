@@ -11,6 +11,8 @@
 #include <chrono>
 #include <Nkentseu/Types.h>
 #include "Logger/LogLevel.h"
+#include "Logger/MessageBuffer.h"
+#include "Logger/ThreadInfo.h"
 
 // -----------------------------------------------------------------------------
 // NAMESPACE: nkentseu::logger
@@ -20,28 +22,33 @@ namespace nkentseu {
 
         // -------------------------------------------------------------------------
         // STRUCTURE: LogMessage
-        // DESCRIPTION: Contient toutes les informations d'un message de log
+        // DESCRIPTION: Contient toutes les informations d'un message de log.
+        //              Construire un message n'alloue pas: les chaînes de source
+        //              et le nom du logger sont des pointeurs vers des données
+        //              statiques (__FILE__, littéraux, chaînes internées) et le
+        //              texte tient dans un tampon inline.
         // -------------------------------------------------------------------------
         struct LogMessage {
             // ---------------------------------------------------------------------
             // DONNÉES TEMPORELLES
             // ---------------------------------------------------------------------
             
-            /// Timestamp en nanosecondes depuis l'epoch
+            /// Timestamp en nanosecondes depuis l'epoch (voir LogClock), seule
+            /// donnée temporelle du message
             uint64 timestamp;
             
-            /// Heure de réception du message
-            std::chrono::system_clock::time_point timePoint;
-            
             // ---------------------------------------------------------------------
             // INFORMATIONS DE THREAD
             // ---------------------------------------------------------------------
             
-            /// ID du thread émetteur
+            /// Index du thread émetteur (voir ThreadInfo, 0 si inconnu)
             uint32 threadId;
             
-            /// Nom du thread (optionnel)
-            std::string threadName;
+            /// Capacité du nom de thread ('\0' compris, limite de pthread)
+            static constexpr size_t THREAD_NAME_CAPACITY = ThreadInfo::NAME_CAPACITY;
+
+            /// Nom du thread (optionnel, vide si inconnu)
+            char threadName[THREAD_NAME_CAPACITY];
             
             // ---------------------------------------------------------------------
             // INFORMATIONS DE LOG
@@ -51,23 +58,27 @@ namespace nkentseu {
             LogLevel level;
             
             /// Message de log
-            std::string message;
+            MessageBuffer message;
             
-            /// Nom du logger
-            std::string loggerName;
+            /// Nom du logger (chaîne internée, jamais nullptr)
+            const char* loggerName;
+            
+            /// Format en attente (voir DeferredFormat.h): message contient alors
+            /// les arguments capturés et non le texte; nullptr si déjà formaté
+            const char* deferredFormat;
             
             // ---------------------------------------------------------------------
             // INFORMATIONS DE SOURCE (optionnelles)
             // ---------------------------------------------------------------------
             
-            /// Fichier source
-            std::string sourceFile;
+            /// Fichier source (chaîne statique, jamais nullptr)
+            const char* sourceFile;
             
             /// Ligne source
             uint32 sourceLine;
             
-            /// Nom de la fonction
-            std::string functionName;
+            /// Nom de la fonction (chaîne statique, jamais nullptr)
+            const char* functionName;
             
             // ---------------------------------------------------------------------
             // CONSTRUCTEURS
@@ -82,22 +93,22 @@ namespace nkentseu {
              * @brief Constructeur avec niveau et message
              * @param lvl Niveau de log
              * @param msg Message de log
-             * @param logger Nom du logger (optionnel)
+             * @param logger Nom du logger (chaîne à durée de vie statique, optionnel)
              */
-            LogMessage(LogLevel lvl, const std::string& msg, const std::string& logger = "");
+            LogMessage(LogLevel lvl, const std::string& msg, const char* logger = "");
             
             /**
              * @brief Constructeur avec informations complètes
              * @param lvl Niveau de log
              * @param msg Message de log
-             * @param file Fichier source (optionnel)
+             * @param file Fichier source (chaîne statique, optionnel)
              * @param line Ligne source (optionnel)
-             * @param func Fonction source (optionnel)
-             * @param logger Nom du logger (optionnel)
+             * @param func Fonction source (chaîne statique, optionnel)
+             * @param logger Nom du logger (chaîne à durée de vie statique, optionnel)
              */
             LogMessage(LogLevel lvl, const std::string& msg,
-                    const std::string& file, uint32 line, const std::string& func,
-                    const std::string& logger = "");
+                    const char* file, uint32 line, const char* func,
+                    const char* logger = "");
             
             /**
              * @brief Destructeur
@@ -113,12 +124,37 @@ namespace nkentseu {
              */
             void Reset();
             
+            /**
+             * @brief Définit le nom du thread (tronqué à THREAD_NAME_CAPACITY - 1)
+             * @param name Nom du thread (nullptr accepté)
+             */
+            void SetThreadName(const char* name);
+            
+            /**
+             * @brief Produit le texte d'un message à format différé
+             *
+             * Sans effet si le message est déjà formaté. Appelé juste avant
+             * l'écriture dans les sinks (thread de traitement en asynchrone).
+             */
+            void ResolveDeferred();
+            
+            /**
+             * @brief Indique si le texte reste à produire
+             */
+            bool IsDeferred() const { return deferredFormat != nullptr; }
+            
             /**
              * @brief Vérifie si le message est valide
              * @return true si valide, false sinon
              */
             bool IsValid() const;
             
+            /**
+             * @brief Obtient l'horodatage sous forme de time_point
+             * @return Instant de l'horloge système correspondant à timestamp
+             */
+            std::chrono::system_clock::time_point GetTimePoint() const;
+            
             /**
              * @brief Obtient l'heure sous forme de structure tm
              * @return Structure tm avec l'heure locale
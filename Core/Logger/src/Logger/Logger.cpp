@@ -7,7 +7,11 @@
 
 #include "Logger/Logger.h"
 #include "Logger/LogMessage.h"
+#include "Logger/StringIntern.h"
 #include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <deque>
 #include <chrono>
 #include <iostream>
 #include <thread>
@@ -18,6 +22,43 @@
 namespace nkentseu {
     namespace logger {
 
+        namespace {
+
+            /// Tampons de formatage d'un thread (sans couleurs, avec couleurs)
+            /// et copie résolue d'un message différé
+            struct DispatchLines {
+                std::string lines[2];
+                LogMessage resolved;
+            };
+
+            /// Un jeu de tampons par profondeur d'appel (deque: adresses stables)
+            thread_local std::deque<DispatchLines> t_DispatchLines;
+            thread_local size_t t_DispatchDepth = 0;
+
+            // ---------------------------------------------------------------------
+            // STRUCTURE: DispatchScope
+            // DESCRIPTION: Réserve les tampons du thread pour un envoi aux sinks
+            // ---------------------------------------------------------------------
+            struct DispatchScope {
+                std::string* lines;
+                LogMessage* resolved;
+
+                DispatchScope() {
+                    if (t_DispatchDepth == t_DispatchLines.size()) {
+                        t_DispatchLines.emplace_back();
+                    }
+                    DispatchLines& buffers = t_DispatchLines[t_DispatchDepth++];
+                    lines = buffers.lines;
+                    resolved = &buffers.resolved;
+                }
+
+                ~DispatchScope() {
+                    --t_DispatchDepth;
+                }
+            };
+
+        } // namespace
+
         // -------------------------------------------------------------------------
         // IMPLÉMENTATION DE Logger
         // -------------------------------------------------------------------------
@@ -28,9 +69,14 @@ namespace nkentseu {
          */
         Logger::Logger(const std::string& name)
             : m_Name(name)
-            , m_Level(LogLevel::Info)
-            , m_Enabled(true)
+            , m_InternedName(InternString(name))
+            , m_LevelState(static_cast<uint8>(LogLevel::Info))
+            , m_RateLimited(false)
             , m_Formatter(std::make_unique<Formatter>()) {
+            const std::string pattern = m_Formatter->GetPattern();
+            m_Snapshot.Update([&pattern](SinkSnapshot& snapshot) {
+                snapshot.formatter = std::make_shared<Formatter>(pattern);
+            });
         }
         
         /**
@@ -46,7 +92,12 @@ namespace nkentseu {
          */
         void Logger::AddSink(std::shared_ptr<ISink> sink) {
             std::lock_guard<std::mutex> lock(m_Mutex);
-            m_Sinks.push_back(sink);
+            if (sink && sink->GetFormatter()) {
+                sink->SetPattern(m_Formatter->GetPattern());
+            }
+            m_Snapshot.Update([&sink](SinkSnapshot& snapshot) {
+                snapshot.sinks.push_back(sink);
+            });
         }
         
         /**
@@ -54,7 +105,9 @@ namespace nkentseu {
          */
         void Logger::ClearSinks() {
             std::lock_guard<std::mutex> lock(m_Mutex);
-            m_Sinks.clear();
+            m_Snapshot.Update([](SinkSnapshot& snapshot) {
+                snapshot.sinks.clear();
+            });
         }
         
         /**
@@ -62,8 +115,8 @@ namespace nkentseu {
          * @return Nombre de sinks
          */
         size_t Logger::GetSinkCount() const {
-            std::lock_guard<std::mutex> lock(m_Mutex);
-            return m_Sinks.size();
+            SnapshotCell<SinkSnapshot>::Reader snapshot(m_Snapshot);
+            return snapshot->sinks.size();
         }
         
         /**
@@ -71,8 +124,11 @@ namespace nkentseu {
          * @param formatter Formatter à utiliser
          */
         void Logger::SetFormatter(std::unique_ptr<Formatter> formatter) {
+            if (!formatter) return;
+            
             std::lock_guard<std::mutex> lock(m_Mutex);
             m_Formatter = std::move(formatter);
+            PublishPattern();
         }
         
         /**
@@ -81,8 +137,29 @@ namespace nkentseu {
          */
         void Logger::SetPattern(const std::string& pattern) {
             std::lock_guard<std::mutex> lock(m_Mutex);
-            if (m_Formatter) {
-                m_Formatter->SetPattern(pattern);
+            m_Formatter->SetPattern(pattern);
+            PublishPattern();
+        }
+        
+        /**
+         * @brief Propage le pattern courant aux sinks et à l'instantané
+         *
+         * Appelé sous m_Mutex, à la configuration: le chemin de log n'a plus
+         * à recopier le pattern dans chaque sink à chaque message.
+         */
+        void Logger::PublishPattern() {
+            const std::string& pattern = m_Formatter->GetPattern();
+            auto formatter = std::make_shared<Formatter>(pattern);
+            
+            m_Snapshot.Update([&formatter](SinkSnapshot& snapshot) {
+                snapshot.formatter = formatter;
+            });
+            
+            SnapshotCell<SinkSnapshot>::Reader snapshot(m_Snapshot);
+            for (const auto& sink : snapshot->sinks) {
+                if (sink && sink->GetFormatter()) {
+                    sink->SetPattern(pattern);
+                }
             }
         }
         
@@ -91,8 +168,12 @@ namespace nkentseu {
          * @param level Niveau minimum à logger
          */
         void Logger::SetLevel(LogLevel level) {
-            std::lock_guard<std::mutex> lock(m_Mutex);
-            m_Level = level;
+            // Conserver l'état d'activation, sans verrou
+            uint8 state = m_LevelState.load(std::memory_order_relaxed);
+            while (!m_LevelState.compare_exchange_weak(state,
+                        static_cast<uint8>((state & DISABLED_BIT) | static_cast<uint8>(level)),
+                        std::memory_order_relaxed)) {
+            }
         }
         
         /**
@@ -100,68 +181,259 @@ namespace nkentseu {
          * @return Niveau de log
          */
         LogLevel Logger::GetLevel() const {
-            std::lock_guard<std::mutex> lock(m_Mutex);
-            return m_Level;
+            return static_cast<LogLevel>(m_LevelState.load(std::memory_order_relaxed) & ~DISABLED_BIT);
         }
         
         /**
-         * @brief Vérifie si un niveau devrait être loggé
-         * @param level Niveau à vérifier
-         * @return true si le niveau est >= niveau minimum, false sinon
+         * @brief Log interne avec informations de source
          */
-        bool Logger::ShouldLog(LogLevel level) const {
-            if (!m_Enabled) return false;
-            return level >= m_Level;
+        void Logger::LogInternal(LogLevel level, const std::string& message, const char* sourceFile, uint32 sourceLine, const char* functionName) {
+            if (!ShouldLog(level)) return;
+            
+            LogMessage msg;
+            PrepareMessage(msg, level, sourceFile, sourceLine, functionName);
+            
+            // Site d'appel: l'emplacement s'il est connu, sinon le texte lui-même
+            if (m_RateLimited.load(std::memory_order_relaxed) &&
+                !AdmitMessage(sourceFile && sourceLine > 0 ? 0 : RateLimiter::HashText(message.data(), message.size()), msg)) {
+                return;
+            }
+            msg.message.Assign(message.data(), message.size());
+            
+            SubmitMessage(msg);
         }
         
         /**
-         * @brief Log interne avec informations de source
+         * @brief Log interne formaté directement dans le message
          */
-        void Logger::LogInternal(LogLevel level, const std::string& message, const char* sourceFile, uint32 sourceLine, const char* functionName) {
-            if (!m_Enabled || level < m_Level) return;
+        void Logger::LogInternal(LogLevel level, const char* format, va_list args, const char* sourceFile, uint32 sourceLine, const char* functionName) {
+            if (!ShouldLog(level)) return;
             
-            // Création du message de log avec nom du logger
+            // Formatage dans le tampon du message (pas de std::string intermédiaire)
             LogMessage msg;
-            msg.timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
-                std::chrono::system_clock::now().time_since_epoch()).count();
-            msg.threadId = static_cast<uint32>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+            PrepareMessage(msg, level, sourceFile, sourceLine, functionName);
+            if (m_RateLimited.load(std::memory_order_relaxed) &&
+                !AdmitMessage(reinterpret_cast<uintptr_t>(format), msg)) {
+                return; // Supprimé avant tout formatage
+            }
+            msg.message.AssignFormat(format, args);
+            
+            SubmitMessage(msg);
+        }
+        
+        /**
+         * @brief Remplit les champs communs d'un message
+         */
+        void Logger::PrepareMessage(LogMessage& msg, LogLevel level, const char* sourceFile, uint32 sourceLine, const char* functionName) const {
+            // Horodatage et identifiant de thread déjà renseignés par le constructeur
             msg.level = level;
-            msg.message = message;
-            msg.loggerName = m_Name;  // Nom du logger ajouté ici
+            msg.loggerName = m_InternedName.load(std::memory_order_acquire);
             
             if (sourceFile) msg.sourceFile = sourceFile;
             if (sourceLine > 0) msg.sourceLine = sourceLine;
             if (functionName) msg.functionName = functionName;
             
-            // Obtention du nom du thread si disponible
-            #if defined(__APPLE__) || defined(__linux__)
-                char threadName[256] = {0};
-                if (pthread_getname_np(pthread_self(), threadName, sizeof(threadName)) == 0) {
-                    msg.threadName = threadName;
-                }
-            #endif
+            // Nom du thread mis en cache au premier log (pas d'appel système)
+            const ThreadInfo& thread = GetCurrentThreadInfo();
+            std::memcpy(msg.threadName, thread.name, sizeof(msg.threadName));
+        }
+        
+        /**
+         * @brief Passe un message préparé par l'étape de limitation
+         */
+        bool Logger::AdmitMessage(uint64 site, const LogMessage& msg) {
+            RateLimiter::Verdict verdict;
+            {
+                SnapshotCell<SinkSnapshot>::Reader snapshot(m_Snapshot);
+                if (!snapshot->limiter) return true;
+                verdict = snapshot->limiter->Admit(site, msg);
+            }
+            
+            // Résumés soumis hors de l'instantané (une file pleine peut bloquer)
+            if (verdict.rateLimited > 0) {
+                SubmitNotice(msg.level, SourceLocation(msg.sourceFile, msg.sourceLine, msg.functionName),
+                             "%llu messages dropped by rate limit", verdict.rateLimited);
+            }
+            if (verdict.repeats.count > 0) {
+                SubmitNotice(verdict.repeats.level, verdict.repeats.location,
+                             "last message repeated %llu times", verdict.repeats.count);
+            }
+            return verdict.admitted;
+        }
+        
+        /**
+         * @brief Soumet un message de l'étape de limitation
+         */
+        void Logger::SubmitNotice(LogLevel level, const SourceLocation& location, const char* format, uint64 count) {
+            char text[64];
+            const int length = std::snprintf(text, sizeof(text), format, static_cast<unsigned long long>(count));
+            
+            LogMessage notice;
+            PrepareMessage(notice, level, location.file, location.line, location.function);
+            notice.message.Assign(text, length > 0 ? static_cast<size_t>(length) : 0);
+            SubmitMessage(notice);
+        }
+        
+        /**
+         * @brief Soumet les résumés de répétitions en attente
+         */
+        void Logger::EmitPendingRepeats() {
+            if (!m_RateLimited.load(std::memory_order_relaxed)) return;
             
-            // Formatage du message
-            std::string formatted;
+            std::vector<RepeatSummary> summaries;
             {
-                std::lock_guard<std::mutex> lock(m_Mutex);
-                if (m_Formatter) {
-                    formatted = m_Formatter->Format(msg);
-                } else {
-                    formatted = message; // Fallback
+                SnapshotCell<SinkSnapshot>::Reader snapshot(m_Snapshot);
+                if (snapshot->limiter) {
+                    snapshot->limiter->TakePendingRepeats(summaries);
                 }
             }
+            for (const RepeatSummary& summary : summaries) {
+                SubmitNotice(summary.level, summary.location, "last message repeated %llu times", summary.count);
+            }
+        }
+        
+        /**
+         * @brief Configure la suppression des répétitions et la limite de débit
+         */
+        void Logger::SetRateLimit(const RateLimitConfig& config) {
+            // Les suppressions de l'étape remplacée sont résumées d'abord
+            EmitPendingRepeats();
             
-            // Envoi à tous les sinks
             std::lock_guard<std::mutex> lock(m_Mutex);
-            for (auto& sink : m_Sinks) {
-                if (sink) {
-                    sink->GetFormatter()->SetPattern(m_Formatter->GetPattern());
-                    sink->Log(msg);
+            std::shared_ptr<RateLimiter> limiter;
+            if (config.IsEnabled()) {
+                limiter = std::make_shared<RateLimiter>(config);
+            }
+            m_Snapshot.Update([&limiter](SinkSnapshot& snapshot) {
+                snapshot.limiter = limiter;
+            });
+            m_RateLimited.store(limiter != nullptr, std::memory_order_relaxed);
+        }
+        
+        /**
+         * @brief Obtient les réglages de limitation
+         */
+        RateLimitConfig Logger::GetRateLimit() const {
+            SnapshotCell<SinkSnapshot>::Reader snapshot(m_Snapshot);
+            return snapshot->limiter ? snapshot->limiter->GetConfig() : RateLimitConfig();
+        }
+        
+        /**
+         * @brief Obtient les compteurs de l'étape de limitation
+         */
+        RateLimitStats Logger::GetRateLimitStats() const {
+            SnapshotCell<SinkSnapshot>::Reader snapshot(m_Snapshot);
+            return snapshot->limiter ? snapshot->limiter->GetStats() : RateLimitStats();
+        }
+        
+        /**
+         * @brief Transmet un message construit aux sinks
+         */
+        void Logger::SubmitMessage(LogMessage& message) {
+            SnapshotCell<SinkSnapshot>::Reader snapshot(m_Snapshot);
+            if (message.IsDeferred() && !KeepsDeferred(snapshot->sinks)) {
+                message.ResolveDeferred();
+            }
+            DispatchToSinks(snapshot->sinks, *snapshot->formatter, message);
+        }
+        
+        /**
+         * @brief Indique si un des sinks garde les messages différés
+         */
+        bool Logger::KeepsDeferred(const std::vector<std::shared_ptr<ISink>>& sinks) {
+            for (const auto& sink : sinks) {
+                if (sink && sink->KeepsDeferred()) {
+                    return true;
+                }
+            }
+            return false;
+        }
+        
+        /**
+         * @brief Écrit un message dans tous les sinks attachés
+         */
+        void Logger::DispatchToSinks(const LogMessage& message) {
+            SnapshotCell<SinkSnapshot>::Reader snapshot(m_Snapshot);
+            DispatchToSinks(snapshot->sinks, *snapshot->formatter, message);
+        }
+        
+        /**
+         * @brief Écrit un message dans une liste de sinks donnée
+         */
+        void Logger::DispatchToSinks(const std::vector<std::shared_ptr<ISink>>& sinks,
+                                     Formatter& formatter, const LogMessage& message) {
+            if (sinks.empty()) return;
+            
+            // Lignes du thread courant; un sink qui logge lui-même reçoit un
+            // autre jeu de tampons (profondeur d'appel suivante)
+            DispatchScope scope;
+            std::string* lines = scope.lines;
+            bool formatted[2] = { false, false };
+            
+            // Message différé (gardé par un des sinks): les autres reçoivent
+            // une copie résolue, produite au premier besoin
+            const LogMessage* text = message.IsDeferred() ? nullptr : &message;
+            
+            for (const auto& sink : sinks) {
+                if (!sink) continue;
+                
+                if (message.IsDeferred() && sink->KeepsDeferred()) {
+                    sink->Log(message);
+                    continue;
+                }
+                if (!text) {
+                    *scope.resolved = message;
+                    scope.resolved->ResolveDeferred();
+                    text = scope.resolved;
+                }
+                
+                if (!sink->SupportsPreformatted() || !sink->GetFormatter() ||
+                    !sink->IsEnabled() || !sink->ShouldLog(text->level)) {
+                    sink->Log(*text);
+                    continue;
+                }
+                
+                // Même pattern pour tous les sinks: une ligne par choix de couleurs
+                const int useColors = sink->WantsColors() ? 1 : 0;
+                if (!formatted[useColors]) {
+                    lines[useColors].clear();
+                    formatter.FormatTo(*text, useColors != 0, lines[useColors]);
+                    formatted[useColors] = true;
                 }
+                
+                sink->LogFormatted(*text, lines[useColors]);
             }
         }
         
+        /**
+         * @brief Annonce le début d'un lot de messages à tous les sinks
+         */
+        void Logger::BeginSinkBatch() {
+            SnapshotCell<SinkSnapshot>::Reader snapshot(m_Snapshot);
+            for (const auto& sink : snapshot->sinks) {
+                if (sink) sink->BeginBatch();
+            }
+        }
+        
+        /**
+         * @brief Annonce la fin d'un lot de messages à tous les sinks
+         */
+        void Logger::EndSinkBatch() {
+            SnapshotCell<SinkSnapshot>::Reader snapshot(m_Snapshot);
+            for (const auto& sink : snapshot->sinks) {
+                if (sink) sink->EndBatch();
+            }
+        }
+        
+        /**
+         * @brief Renomme le logger
+         */
+        void Logger::SetName(const std::string& name) {
+            m_Name = name;
+            // La chaîne internée est complète avant d'être visible des autres threads
+            m_InternedName.store(InternString(name), std::memory_order_release);
+        }
+        
         /**
          * @brief Formatage variadique
          */
@@ -190,10 +462,8 @@ namespace nkentseu {
             
             va_list args;
             va_start(args, format);
-            std::string message = FormatString(format, args);
+            LogInternal(level, format, args, nullptr, 0, nullptr);
             va_end(args);
-            
-            LogInternal(level, message, m_SourceFile.c_str(), m_SourceLine, m_FunctionName.c_str());
         }
         
         /**
@@ -204,10 +474,8 @@ namespace nkentseu {
             
             va_list args;
             va_start(args, format);
-            std::string message = FormatString(format, args);
+            LogInternal(level, format, args, file, line, func);
             va_end(args);
-            
-            LogInternal(level, message, file, line, func);
         }
 
         /**
@@ -224,8 +492,7 @@ namespace nkentseu {
         void Logger::Log(LogLevel level, const char* file, int line, const char* func, const char* format, va_list args) {
             if (!ShouldLog(level)) return;
             
-            std::string message = FormatString(format, args);
-            LogInternal(level, message, file, line, func);
+            LogInternal(level, format, args, file, line, func);
         }
 
         /**
@@ -236,10 +503,8 @@ namespace nkentseu {
             
             va_list args;
             va_start(args, format);
-            std::string message = FormatString(format, args);
+            LogInternal(LogLevel::Trace, format, args, nullptr, 0, nullptr);
             va_end(args);
-            
-            LogInternal(LogLevel::Trace, message, m_SourceFile.c_str(), m_SourceLine, m_FunctionName.c_str());
         }
         
         /**
@@ -250,10 +515,8 @@ namespace nkentseu {
             
             va_list args;
             va_start(args, format);
-            std::string message = FormatString(format, args);
+            LogInternal(LogLevel::Debug, format, args, nullptr, 0, nullptr);
             va_end(args);
-            
-            LogInternal(LogLevel::Debug, message, m_SourceFile.c_str(), m_SourceLine, m_FunctionName.c_str());
         }
         
         /**
@@ -264,10 +527,8 @@ namespace nkentseu {
             
             va_list args;
             va_start(args, format);
-            std::string message = FormatString(format, args);
+            LogInternal(LogLevel::Info, format, args, nullptr, 0, nullptr);
             va_end(args);
-            
-            LogInternal(LogLevel::Info, message, m_SourceFile.c_str(), m_SourceLine, m_FunctionName.c_str());
         }
         
         /**
@@ -278,10 +539,8 @@ namespace nkentseu {
             
             va_list args;
             va_start(args, format);
-            std::string message = FormatString(format, args);
+            LogInternal(LogLevel::Warn, format, args, nullptr, 0, nullptr);
             va_end(args);
-            
-            LogInternal(LogLevel::Warn, message, m_SourceFile.c_str(), m_SourceLine, m_FunctionName.c_str());
         }
         
         /**
@@ -292,10 +551,8 @@ namespace nkentseu {
             
             va_list args;
             va_start(args, format);
-            std::string message = FormatString(format, args);
+            LogInternal(LogLevel::Error, format, args, nullptr, 0, nullptr);
             va_end(args);
-            
-            LogInternal(LogLevel::Error, message, m_SourceFile.c_str(), m_SourceLine, m_FunctionName.c_str());
         }
         
         /**
@@ -306,10 +563,8 @@ namespace nkentseu {
             
             va_list args;
             va_start(args, format);
-            std::string message = FormatString(format, args);
+            LogInternal(LogLevel::Critical, format, args, nullptr, 0, nullptr);
             va_end(args);
-            
-            LogInternal(LogLevel::Critical, message, m_SourceFile.c_str(), m_SourceLine, m_FunctionName.c_str());
         }
         
         /**
@@ -320,10 +575,8 @@ namespace nkentseu {
             
             va_list args;
             va_start(args, format);
-            std::string message = FormatString(format, args);
+            LogInternal(LogLevel::Fatal, format, args, nullptr, 0, nullptr);
             va_end(args);
-            
-            LogInternal(LogLevel::Fatal, message, m_SourceFile.c_str(), m_SourceLine, m_FunctionName.c_str());
         }
         
         /**
@@ -331,7 +584,7 @@ namespace nkentseu {
          */
         void Logger::Log(LogLevel level, const std::string& message) {
             if (!ShouldLog(level)) return;
-            LogInternal(level, message, m_SourceFile.c_str(), m_SourceLine, m_FunctionName.c_str());
+            LogInternal(level, message, nullptr, 0, nullptr);
         }
         
         /**
@@ -339,7 +592,7 @@ namespace nkentseu {
          */
         void Logger::Trace(const std::string& message) {
             if (!ShouldLog(LogLevel::Trace)) return;
-            LogInternal(LogLevel::Trace, message, m_SourceFile.c_str(), m_SourceLine, m_FunctionName.c_str());
+            LogInternal(LogLevel::Trace, message, nullptr, 0, nullptr);
         }
         
         /**
@@ -347,7 +600,7 @@ namespace nkentseu {
          */
         void Logger::Debug(const std::string& message) {
             if (!ShouldLog(LogLevel::Debug)) return;
-            LogInternal(LogLevel::Debug, message, m_SourceFile.c_str(), m_SourceLine, m_FunctionName.c_str());
+            LogInternal(LogLevel::Debug, message, nullptr, 0, nullptr);
         }
         
         /**
@@ -355,7 +608,7 @@ namespace nkentseu {
          */
         void Logger::Info(const std::string& message) {
             if (!ShouldLog(LogLevel::Info)) return;
-            LogInternal(LogLevel::Info, message, m_SourceFile.c_str(), m_SourceLine, m_FunctionName.c_str());
+            LogInternal(LogLevel::Info, message, nullptr, 0, nullptr);
         }
         
         /**
@@ -363,7 +616,7 @@ namespace nkentseu {
          */
         void Logger::Warn(const std::string& message) {
             if (!ShouldLog(LogLevel::Warn)) return;
-            LogInternal(LogLevel::Warn, message, m_SourceFile.c_str(), m_SourceLine, m_FunctionName.c_str());
+            LogInternal(LogLevel::Warn, message, nullptr, 0, nullptr);
         }
         
         /**
@@ -371,7 +624,7 @@ namespace nkentseu {
          */
         void Logger::Error(const std::string& message) {
             if (!ShouldLog(LogLevel::Error)) return;
-            LogInternal(LogLevel::Error, message, m_SourceFile.c_str(), m_SourceLine, m_FunctionName.c_str());
+            LogInternal(LogLevel::Error, message, nullptr, 0, nullptr);
         }
         
         /**
@@ -379,7 +632,7 @@ namespace nkentseu {
          */
         void Logger::Critical(const std::string& message) {
             if (!ShouldLog(LogLevel::Critical)) return;
-            LogInternal(LogLevel::Critical, message, m_SourceFile.c_str(), m_SourceLine, m_FunctionName.c_str());
+            LogInternal(LogLevel::Critical, message, nullptr, 0, nullptr);
         }
         
         /**
@@ -387,15 +640,23 @@ namespace nkentseu {
          */
         void Logger::Fatal(const std::string& message) {
             if (!ShouldLog(LogLevel::Fatal)) return;
-            LogInternal(LogLevel::Fatal, message, m_SourceFile.c_str(), m_SourceLine, m_FunctionName.c_str());
+            LogInternal(LogLevel::Fatal, message, nullptr, 0, nullptr);
         }
         
         /**
          * @brief Force le flush de tous les sinks
          */
         void Logger::Flush() {
-            std::lock_guard<std::mutex> lock(m_Mutex);
-            for (auto& sink : m_Sinks) {
+            EmitPendingRepeats();
+            FlushSinks();
+        }
+        
+        /**
+         * @brief Vide les tampons des sinks attachés
+         */
+        void Logger::FlushSinks() {
+            SnapshotCell<SinkSnapshot>::Reader snapshot(m_Snapshot);
+            for (const auto& sink : snapshot->sinks) {
                 if (sink) {
                     sink->Flush();
                 }
@@ -415,7 +676,7 @@ namespace nkentseu {
          * @return true si actif, false sinon
          */
         bool Logger::IsEnabled() const {
-            return m_Enabled;
+            return (m_LevelState.load(std::memory_order_relaxed) & DISABLED_BIT) == 0;
         }
         
         /**
@@ -423,8 +684,213 @@ namespace nkentseu {
          * @param enabled État d'activation
          */
         void Logger::SetEnabled(bool enabled) {
-            std::lock_guard<std::mutex> lock(m_Mutex);
-            m_Enabled = enabled;
+            if (enabled) {
+                m_LevelState.fetch_and(static_cast<uint8>(~DISABLED_BIT), std::memory_order_relaxed);
+            } else {
+                m_LevelState.fetch_or(DISABLED_BIT, std::memory_order_relaxed);
+            }
+        }
+        
+        /**
+         * @brief Associe un emplacement source aux appels qui suivent
+         */
+        SourceContext Logger::Source(const char* sourceFile, uint32 sourceLine, const char* functionName) {
+            return SourceContext(*this, SourceLocation(sourceFile, sourceLine, functionName));
+        }
+
+        // -------------------------------------------------------------------------
+        // IMPLÉMENTATION DE SourceContext
+        // -------------------------------------------------------------------------
+        
+        /**
+         * @brief Transmet un appel printf au logger
+         */
+        void SourceContext::LogV(LogLevel level, const char* format, va_list args) {
+            m_Logger->Log(level, m_Location.file, static_cast<int>(m_Location.line),
+                          m_Location.function, format, args);
+        }
+        
+        /**
+         * @brief Log avec format string
+         */
+        void SourceContext::Log(LogLevel level, const char* format, ...) {
+            if (!m_Logger->ShouldLog(level)) return;
+            
+            va_list args;
+            va_start(args, format);
+            LogV(level, format, args);
+            va_end(args);
+        }
+        
+        /**
+         * @brief Log avec message string
+         */
+        void SourceContext::Log(LogLevel level, const std::string& message) {
+            if (!m_Logger->ShouldLog(level)) return;
+            m_Logger->Log(level, m_Location.file, static_cast<int>(m_Location.line),
+                          m_Location.function, message);
+        }
+        
+        /**
+         * @brief Log trace avec format string
+         */
+        void SourceContext::Trace(const char* format, ...) {
+            if (!m_Logger->ShouldLog(LogLevel::Trace)) return;
+            
+            va_list args;
+            va_start(args, format);
+            LogV(LogLevel::Trace, format, args);
+            va_end(args);
+        }
+        
+        /**
+         * @brief Log debug avec format string
+         */
+        void SourceContext::Debug(const char* format, ...) {
+            if (!m_Logger->ShouldLog(LogLevel::Debug)) return;
+            
+            va_list args;
+            va_start(args, format);
+            LogV(LogLevel::Debug, format, args);
+            va_end(args);
+        }
+        
+        /**
+         * @brief Log info avec format string
+         */
+        void SourceContext::Info(const char* format, ...) {
+            if (!m_Logger->ShouldLog(LogLevel::Info)) return;
+            
+            va_list args;
+            va_start(args, format);
+            LogV(LogLevel::Info, format, args);
+            va_end(args);
+        }
+        
+        /**
+         * @brief Log warn avec format string
+         */
+        void SourceContext::Warn(const char* format, ...) {
+            if (!m_Logger->ShouldLog(LogLevel::Warn)) return;
+            
+            va_list args;
+            va_start(args, format);
+            LogV(LogLevel::Warn, format, args);
+            va_end(args);
+        }
+        
+        /**
+         * @brief Log error avec format string
+         */
+        void SourceContext::Error(const char* format, ...) {
+            if (!m_Logger->ShouldLog(LogLevel::Error)) return;
+            
+            va_list args;
+            va_start(args, format);
+            LogV(LogLevel::Error, format, args);
+            va_end(args);
+        }
+        
+        /**
+         * @brief Log critical avec format string
+         */
+        void SourceContext::Critical(const char* format, ...) {
+            if (!m_Logger->ShouldLog(LogLevel::Critical)) return;
+            
+            va_list args;
+            va_start(args, format);
+            LogV(LogLevel::Critical, format, args);
+            va_end(args);
+        }
+        
+        /**
+         * @brief Log fatal avec format string
+         */
+        void SourceContext::Fatal(const char* format, ...) {
+            if (!m_Logger->ShouldLog(LogLevel::Fatal)) return;
+            
+            va_list args;
+            va_start(args, format);
+            LogV(LogLevel::Fatal, format, args);
+            va_end(args);
+        }
+        
+        /**
+         * @brief Log trace avec message string
+         */
+        void SourceContext::Trace(const std::string& message) {
+            Log(LogLevel::Trace, message);
+        }
+        
+        /**
+         * @brief Log debug avec message string
+         */
+        void SourceContext::Debug(const std::string& message) {
+            Log(LogLevel::Debug, message);
+        }
+        
+        /**
+         * @brief Log info avec message string
+         */
+        void SourceContext::Info(const std::string& message) {
+            Log(LogLevel::Info, message);
+        }
+        
+        /**
+         * @brief Log warn avec message string
+         */
+        void SourceContext::Warn(const std::string& message) {
+            Log(LogLevel::Warn, message);
+        }
+        
+        /**
+         * @brief Log error avec message string
+         */
+        void SourceContext::Error(const std::string& message) {
+            Log(LogLevel::Error, message);
+        }
+        
+        /**
+         * @brief Log critical avec message string
+         */
+        void SourceContext::Critical(const std::string& message) {
+            Log(LogLevel::Critical, message);
+        }
+        
+        /**
+         * @brief Log fatal avec message string
+         */
+        void SourceContext::Fatal(const std::string& message) {
+            Log(LogLevel::Fatal, message);
+        }
+        
+        /**
+         * @brief Définit le niveau du logger
+         */
+        SourceContext& SourceContext::Level(LogLevel level) {
+            m_Logger->SetLevel(level);
+            return *this;
+        }
+        
+        /**
+         * @brief Obtient le niveau du logger
+         */
+        LogLevel SourceContext::GetLevel() const {
+            return m_Logger->GetLevel();
+        }
+        
+        /**
+         * @brief Vérifie si un niveau serait loggé
+         */
+        bool SourceContext::ShouldLog(LogLevel level) const {
+            return m_Logger->ShouldLog(level);
+        }
+        
+        /**
+         * @brief Force l'écriture des messages en attente
+         */
+        void SourceContext::Flush() {
+            m_Logger->Flush();
         }
 
     } // namespace logger
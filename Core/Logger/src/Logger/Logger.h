@@ -12,10 +12,17 @@
 #include "Logger/LogLevel.h"
 #include "Logger/Sink.h"
 #include "Logger/Formatter.h"
+#include "Logger/DeferredFormat.h"
+#include "Logger/SourceLocation.h"
+#include "Logger/Snapshot.h"
+#include "Logger/RateLimiter.h"
 #include <memory>
 #include <vector>
 #include <string>
 #include <mutex>
+#include <atomic>
+#include <cstdarg>
+#include <cstdint>
 
 // -----------------------------------------------------------------------------
 // NAMESPACE: nkentseu::logger
@@ -23,6 +30,8 @@
 namespace nkentseu {
     namespace logger {
 
+        class SourceContext;
+
         // -------------------------------------------------------------------------
         // CLASSE: Logger
         // DESCRIPTION: Classe principale de logging avec support multi-sink
@@ -51,6 +60,10 @@ namespace nkentseu {
                 /**
                  * @brief Ajoute un sink au logger
                  * @param sink Sink à ajouter (partagé)
+                 *
+                 * Le sink reçoit le pattern du logger ici, une fois, et non à
+                 * chaque message. Les appels de log concurrents voient l'ancienne
+                 * ou la nouvelle liste, jamais un état intermédiaire.
                  */
                 void AddSink(std::shared_ptr<ISink> sink);
                 
@@ -86,7 +99,7 @@ namespace nkentseu {
                 // ---------------------------------------------------------------------
                 
                 /**
-                 * @brief Définit le niveau de log minimum
+                 * @brief Définit le niveau de log minimum (sans verrou)
                  * @param level Niveau minimum à logger
                  */
                 void SetLevel(LogLevel level);
@@ -101,8 +114,38 @@ namespace nkentseu {
                  * @brief Vérifie si un niveau devrait être loggé
                  * @param level Niveau à vérifier
                  * @return true si le niveau est >= niveau minimum, false sinon
+                 *
+                 * En ligne et sans verrou: une lecture atomique relâchée et une
+                 * comparaison, seul coût d'un appel désactivé via les macros.
                  */
-                bool ShouldLog(LogLevel level) const;
+                bool ShouldLog(LogLevel level) const {
+                    return static_cast<uint8>(level) >= m_LevelState.load(std::memory_order_relaxed);
+                }
+                
+                // ---------------------------------------------------------------------
+                // LIMITATION DU DÉBIT
+                // ---------------------------------------------------------------------
+                
+                /**
+                 * @brief Configure la suppression des répétitions et la limite de débit
+                 * @param config Réglages (config par défaut: étape retirée)
+                 *
+                 * Les messages sont filtrés sur l'appelant, avant formatage: une
+                 * répétition supprimée ne coûte ni vsnprintf ni place en file.
+                 * Les sinks reçoivent "last message repeated N times" au premier
+                 * message admis du site après sa fenêtre, ou au Flush.
+                 */
+                void SetRateLimit(const RateLimitConfig& config);
+                
+                /**
+                 * @brief Obtient les réglages de limitation
+                 */
+                RateLimitConfig GetRateLimit() const;
+                
+                /**
+                 * @brief Obtient les compteurs de l'étape de limitation
+                 */
+                RateLimitStats GetRateLimitStats() const;
                 
                 // ---------------------------------------------------------------------
                 // MÉTHODES DE LOGGING (FORMAT STRING)
@@ -148,6 +191,41 @@ namespace nkentseu {
                  */
                 virtual void Log(LogLevel level, const char* file, int line, const char* func, const char* format, va_list args);
                 
+                // ---------------------------------------------------------------------
+                // MÉTHODES DE LOGGING (FORMAT DIFFÉRÉ)
+                // ---------------------------------------------------------------------
+                
+                /**
+                 * @brief Log printf dont le formatage est différé
+                 * @param level Niveau de log
+                 * @param file Fichier source
+                 * @param line Ligne source
+                 * @param func Fonction source
+                 * @param format Format string (littéral: seule l'adresse est conservée)
+                 * @param args Arguments (entiers, réels, enums, pointeurs, chaînes)
+                 *
+                 * L'appelant ne fait que copier les arguments dans le message;
+                 * le texte est produit juste avant les sinks, donc sur le thread
+                 * de traitement pour AsyncLogger. Les chaînes sont copiées, les
+                 * types non capturables sont refusés à la compilation.
+                 */
+                template <typename... Args>
+                void LogDeferred(LogLevel level, const char* file, int line, const char* func,
+                                 const char* format, const Args&... args) {
+                    if (!ShouldLog(level)) return;
+                    
+                    LogMessage msg;
+                    PrepareMessage(msg, level, file, static_cast<uint32>(line), func);
+                    if (m_RateLimited.load(std::memory_order_relaxed) &&
+                        !AdmitMessage(reinterpret_cast<uintptr_t>(format), msg)) {
+                        return;
+                    }
+                    deferred::Capture(msg.message, args...);
+                    msg.deferredFormat = format;
+                    
+                    SubmitMessage(msg);
+                }
+                
                 /**
                  * @brief Log trace avec format string
                  * @param format Format string
@@ -256,6 +334,8 @@ namespace nkentseu {
                 
                 /**
                  * @brief Force le flush de tous les sinks
+                 *
+                 * Les répétitions supprimées en attente sont résumées avant.
                  */
                 virtual void Flush();
                 
@@ -272,18 +352,23 @@ namespace nkentseu {
                 bool IsEnabled() const;
                 
                 /**
-                 * @brief Active ou désactive le logger
+                 * @brief Active ou désactive le logger (sans verrou, niveau conservé)
                  * @param enabled État d'activation
                  */
                 void SetEnabled(bool enabled);
 
 
-                virtual Logger& Source(const char* sourceFile = nullptr, uint32 sourceLine = 0, const char* functionName = nullptr) {
-                    m_SourceFile = sourceFile ? sourceFile : "";
-                    m_SourceLine = sourceLine;
-                    m_FunctionName = functionName ? functionName : "";
-                    return *this;
-                }
+                /**
+                 * @brief Associe un emplacement source aux appels qui suivent
+                 * @param sourceFile Fichier source (chaîne statique, ex. __FILE__)
+                 * @param sourceLine Ligne source
+                 * @param functionName Fonction source (chaîne statique, ex. __FUNCTION__)
+                 * @return Contexte à utiliser pour l'appel (ex. Source(...).Info(...))
+                 *
+                 * L'emplacement est porté par le contexte retourné et non par le
+                 * logger: des threads concurrents ne se le disputent pas.
+                 */
+                SourceContext Source(const char* sourceFile = nullptr, uint32 sourceLine = 0, const char* functionName = nullptr);
             private:
                 // ---------------------------------------------------------------------
                 // MÉTHODES PRIVÉES
@@ -302,6 +387,52 @@ namespace nkentseu {
                                 uint32 sourceLine = 0,
                                 const char* functionName = nullptr);
                 
+                /**
+                 * @brief Log interne formaté directement dans le message
+                 * @param level Niveau de log
+                 * @param format Format string
+                 * @param args Arguments variables (va_list)
+                 * @param sourceFile Fichier source (optionnel)
+                 * @param sourceLine Ligne source (optionnel)
+                 * @param functionName Fonction source (optionnel)
+                 */
+                void LogInternal(LogLevel level, const char* format, va_list args,
+                                const char* sourceFile,
+                                uint32 sourceLine,
+                                const char* functionName);
+                
+                /**
+                 * @brief Remplit les champs communs d'un message
+                 * @param msg Message à compléter
+                 * @param level Niveau de log
+                 * @param sourceFile Fichier source (optionnel)
+                 * @param sourceLine Ligne source (optionnel)
+                 * @param functionName Fonction source (optionnel)
+                 */
+                void PrepareMessage(LogMessage& msg, LogLevel level,
+                                const char* sourceFile,
+                                uint32 sourceLine,
+                                const char* functionName) const;
+                
+                /**
+                 * @brief Passe un message préparé par l'étape de limitation
+                 * @param site Identité du site (adresse du format ou empreinte du texte)
+                 * @param msg Message préparé, texte non encore produit pour un format
+                 * @return false si le message ne doit pas atteindre les sinks
+                 *
+                 * Les résumés dus (répétitions, refus de débit) sont soumis avant.
+                 */
+                bool AdmitMessage(uint64 site, const LogMessage& msg);
+                
+                /**
+                 * @brief Soumet un message de l'étape de limitation
+                 * @param level Niveau du message
+                 * @param location Emplacement du site concerné
+                 * @param format Format du texte
+                 * @param count Nombre rapporté
+                 */
+                void SubmitNotice(LogLevel level, const SourceLocation& location, const char* format, uint64 count);
+                
                 // ---------------------------------------------------------------------
                 // VARIABLES MEMBRE PRIVÉES
                 // ---------------------------------------------------------------------
@@ -309,24 +440,113 @@ namespace nkentseu {
                 /// Nom du logger
                 std::string m_Name;
                 
-                /// Niveau de log minimum
-                LogLevel m_Level;
+                /// Nom du logger interné (référencé par chaque LogMessage); publié
+                /// en release par SetName, lu en acquire par les threads qui loggent
+                std::atomic<const char*> m_InternedName;
+                
+                /// Bit de m_LevelState: logger désactivé (aucun niveau ne l'atteint)
+                static constexpr uint8 DISABLED_BIT = 0x80;
+                
+                /// Niveau minimum (bits bas) et DISABLED_BIT, lus sans verrou
+                std::atomic<uint8> m_LevelState;
                 
-                /// Indicateur d'activation
-                bool m_Enabled;
+                /// Étape de limitation active (seule lecture du chemin de log sans elle)
+                std::atomic<bool> m_RateLimited;
             protected:
-                void SetName(const std::string& name) {
-                    m_Name = name;
-                }
-                /// Mutex pour la synchronisation thread-safe
-                mutable std::mutex m_Mutex;
+                /**
+                 * @brief Renomme le logger
+                 * @param name Nouveau nom
+                 */
+                void SetName(const std::string& name);
                 
-                /// Liste des sinks attachés
-                std::vector<std::shared_ptr<ISink>> m_Sinks;
+                /**
+                 * @brief Transmet un message construit à sa destination
+                 * @param message Message complet (peut être déplacé)
+                 *
+                 * Le logger synchrone l'écrit immédiatement dans les sinks; les
+                 * loggers dérivés (asynchrones) peuvent le déplacer dans une file.
+                 */
+                virtual void SubmitMessage(LogMessage& message);
                 
-                /// Formatter pour le formatting
+                /**
+                 * @brief Écrit un message dans tous les sinks attachés
+                 * @param message Message à écrire
+                 *
+                 * Le message est formaté une seule fois par choix de couleurs et
+                 * la même ligne est transmise à tous les sinks qui acceptent un
+                 * texte pré-formaté. Aucun verrou du logger n'est pris: la liste
+                 * des sinks est lue dans l'instantané courant.
+                 */
+                void DispatchToSinks(const LogMessage& message);
+                
+                /**
+                 * @brief Écrit un message dans une liste de sinks donnée
+                 * @param sinks Sinks destinataires
+                 * @param formatter Formatter au pattern déjà analysé (lecture seule)
+                 * @param message Message à écrire
+                 */
+                static void DispatchToSinks(const std::vector<std::shared_ptr<ISink>>& sinks,
+                                            Formatter& formatter, const LogMessage& message);
+                
+                /**
+                 * @brief Indique si un des sinks garde les messages différés
+                 * @param sinks Sinks destinataires
+                 * @return true si un sink répond ISink::KeepsDeferred()
+                 *
+                 * Sinon, le message est résolu sur place avant l'envoi; dans le
+                 * cas contraire, DispatchToSinks résout une copie pour les
+                 * autres sinks.
+                 */
+                static bool KeepsDeferred(const std::vector<std::shared_ptr<ISink>>& sinks);
+                
+                /**
+                 * @brief Vide les tampons des sinks attachés (sans résumé)
+                 */
+                void FlushSinks();
+                
+                /**
+                 * @brief Soumet les résumés de répétitions en attente
+                 */
+                void EmitPendingRepeats();
+                
+                /**
+                 * @brief Annonce le début d'un lot de messages à tous les sinks
+                 */
+                void BeginSinkBatch();
+                
+                /**
+                 * @brief Annonce la fin d'un lot de messages à tous les sinks
+                 */
+                void EndSinkBatch();
+                
+                /**
+                 * @brief Propage le pattern courant aux sinks et à l'instantané
+                 *        (appelé sous m_Mutex)
+                 */
+                virtual void PublishPattern();
+                
+                /// Mutex de configuration (formatter, écrivains de la liste de sinks)
+                mutable std::mutex m_Mutex;
+                
+                /// Formatter configuré pour le logger
                 std::unique_ptr<Formatter> m_Formatter;
                 
+                /// État lu par chaque message, remplacé en bloc à la configuration
+                struct SinkSnapshot {
+                    /// Sinks attachés
+                    std::vector<std::shared_ptr<ISink>> sinks;
+                    
+                    /// Copie du formatter, pattern déjà analysé: FormatTo n'y
+                    /// écrit plus rien et peut être appelé par plusieurs threads
+                    std::shared_ptr<Formatter> formatter;
+                    
+                    /// Étape de limitation (nullptr: aucune)
+                    std::shared_ptr<RateLimiter> limiter;
+                };
+                
+                /// Sinks et formatter publiés sans verrou pour le chemin de log
+                SnapshotCell<SinkSnapshot> m_Snapshot;
+                
                 /**
                  * @brief Formatage variadique
                  * @param format Format string
@@ -334,78 +554,263 @@ namespace nkentseu {
                  * @return Chaîne formatée
                  */
                 std::string FormatString(const char* format, va_list args);
+        };
 
-                std::string m_SourceFile;
-                uint32 m_SourceLine;
-                std::string m_FunctionName;
+        // -------------------------------------------------------------------------
+        // CLASSE: SourceContext
+        // DESCRIPTION: Logger et emplacement source d'un appel, retourné par
+        //              Logger::Source() (macro 'logs'). Valeur légère: un
+        //              pointeur et un SourceLocation, aucune copie de chaîne,
+        //              aucune écriture dans le logger.
+        // -------------------------------------------------------------------------
+        class LOGGER_API SourceContext {
+            public:
+                /**
+                 * @brief Constructeur
+                 * @param logger Logger destinataire
+                 * @param location Emplacement de l'appel
+                 */
+                SourceContext(Logger& logger, const SourceLocation& location)
+                    : m_Logger(&logger), m_Location(location) {
+                }
+                
+                // ---------------------------------------------------------------------
+                // MÉTHODES DE LOGGING
+                // ---------------------------------------------------------------------
+                
+                /**
+                 * @brief Log avec format string (style printf)
+                 * @param level Niveau de log
+                 * @param format Format string
+                 * @param ... Arguments variables
+                 */
+                void Log(LogLevel level, const char* format, ...);
+                
+                /**
+                 * @brief Log avec message string
+                 * @param level Niveau de log
+                 * @param message Message à logger
+                 */
+                void Log(LogLevel level, const std::string& message);
+                
+                /// Log trace avec format string
+                void Trace(const char* format, ...);
+                /// Log debug avec format string
+                void Debug(const char* format, ...);
+                /// Log info avec format string
+                void Info(const char* format, ...);
+                /// Log warn avec format string
+                void Warn(const char* format, ...);
+                /// Log error avec format string
+                void Error(const char* format, ...);
+                /// Log critical avec format string
+                void Critical(const char* format, ...);
+                /// Log fatal avec format string
+                void Fatal(const char* format, ...);
+                
+                /// Log trace avec message string
+                void Trace(const std::string& message);
+                /// Log debug avec message string
+                void Debug(const std::string& message);
+                /// Log info avec message string
+                void Info(const std::string& message);
+                /// Log warn avec message string
+                void Warn(const std::string& message);
+                /// Log error avec message string
+                void Error(const std::string& message);
+                /// Log critical avec message string
+                void Critical(const std::string& message);
+                /// Log fatal avec message string
+                void Fatal(const std::string& message);
+                
+                /**
+                 * @brief Log à format différé (voir Logger::LogDeferred)
+                 */
+                template <typename... Args>
+                void Deferred(LogLevel level, const char* format, const Args&... args) {
+                    m_Logger->LogDeferred(level, m_Location.file, static_cast<int>(m_Location.line),
+                                          m_Location.function, format, args...);
+                }
+                
+                // ---------------------------------------------------------------------
+                // ACCÈS AU LOGGER
+                // ---------------------------------------------------------------------
+                
+                /**
+                 * @brief Définit le niveau du logger (retourne *this pour chaînage)
+                 */
+                SourceContext& Level(LogLevel level);
+                
+                /**
+                 * @brief Obtient le niveau du logger
+                 */
+                LogLevel GetLevel() const;
+                
+                /**
+                 * @brief Vérifie si un niveau serait loggé
+                 */
+                bool ShouldLog(LogLevel level) const;
+                
+                /**
+                 * @brief Force l'écriture des messages en attente
+                 */
+                void Flush();
+                
+                /**
+                 * @brief Logger destinataire
+                 */
+                Logger& GetLogger() const { return *m_Logger; }
+                
+                /**
+                 * @brief Emplacement de l'appel
+                 */
+                const SourceLocation& GetLocation() const { return m_Location; }
+                
+            private:
+                /**
+                 * @brief Transmet un appel printf au logger
+                 */
+                void LogV(LogLevel level, const char* format, va_list args);
+                
+                /// Logger destinataire
+                Logger* m_Logger;
+                
+                /// Emplacement de l'appel
+                SourceLocation m_Location;
         };
 
         // -------------------------------------------------------------------------
         // MACROS DE LOGGING PRATIQUES
+        // DESCRIPTION: Le niveau est testé avant l'évaluation des arguments. Les
+        //              niveaux inférieurs à NK_LOG_ACTIVE_LEVEL (LogLevel.h) sont
+        //              retirés à la compilation.
         // -------------------------------------------------------------------------
         
-        #define LOG_TRACE(logger, ...) \
-            if ((logger)->ShouldLog(LogLevel::Trace)) \
-                (logger)->Log(LogLevel::Trace, __FILE__, __LINE__, __FUNCTION__, __VA_ARGS__)
+        /// Appel exécuté seulement si le niveau est actif (sûr dans un if/else)
+        #define NK_LOGGER_CALL_IF(logger, level, call) \
+            if (!(logger)->ShouldLog(level)) {} else (logger)->call
         
-        #define LOG_DEBUG(logger, ...) \
-            if ((logger)->ShouldLog(LogLevel::Debug)) \
-                (logger)->Log(LogLevel::Debug, __FILE__, __LINE__, __FUNCTION__, __VA_ARGS__)
+        #if NK_LOG_ACTIVE_LEVEL <= NK_LOG_LEVEL_TRACE
+            #define LOG_TRACE(logger, ...) \
+                NK_LOGGER_CALL_IF(logger, LogLevel::Trace, \
+                    Log(LogLevel::Trace, __FILE__, __LINE__, __FUNCTION__, __VA_ARGS__))
+            #define LOG_TRACE_DEFERRED(logger, ...) \
+                NK_LOGGER_CALL_IF(logger, LogLevel::Trace, \
+                    LogDeferred(LogLevel::Trace, __FILE__, __LINE__, __FUNCTION__, __VA_ARGS__))
+            #define LOG_TRACE_SRC(logger, ...) \
+                NK_LOGGER_CALL_IF(logger, LogLevel::Trace, \
+                    LogInternal(LogLevel::Trace, (logger)->FormatString(__VA_ARGS__), \
+                                __FILE__, __LINE__, __FUNCTION__))
+        #else
+            #define LOG_TRACE(logger, ...) ((void)0)
+            #define LOG_TRACE_DEFERRED(logger, ...) ((void)0)
+            #define LOG_TRACE_SRC(logger, ...) ((void)0)
+        #endif
         
-        #define LOG_INFO(logger, ...) \
-            if ((logger)->ShouldLog(LogLevel::Info)) \
-                (logger)->Log(LogLevel::Info, __FILE__, __LINE__, __FUNCTION__, __VA_ARGS__)
+        #if NK_LOG_ACTIVE_LEVEL <= NK_LOG_LEVEL_DEBUG
+            #define LOG_DEBUG(logger, ...) \
+                NK_LOGGER_CALL_IF(logger, LogLevel::Debug, \
+                    Log(LogLevel::Debug, __FILE__, __LINE__, __FUNCTION__, __VA_ARGS__))
+            #define LOG_DEBUG_DEFERRED(logger, ...) \
+                NK_LOGGER_CALL_IF(logger, LogLevel::Debug, \
+                    LogDeferred(LogLevel::Debug, __FILE__, __LINE__, __FUNCTION__, __VA_ARGS__))
+            #define LOG_DEBUG_SRC(logger, ...) \
+                NK_LOGGER_CALL_IF(logger, LogLevel::Debug, \
+                    LogInternal(LogLevel::Debug, (logger)->FormatString(__VA_ARGS__), \
+                                __FILE__, __LINE__, __FUNCTION__))
+        #else
+            #define LOG_DEBUG(logger, ...) ((void)0)
+            #define LOG_DEBUG_DEFERRED(logger, ...) ((void)0)
+            #define LOG_DEBUG_SRC(logger, ...) ((void)0)
+        #endif
         
-        #define LOG_WARN(logger, ...) \
-            if ((logger)->ShouldLog(LogLevel::Warn)) \
-                (logger)->Log(LogLevel::Warn, __FILE__, __LINE__, __FUNCTION__, __VA_ARGS__)
+        #if NK_LOG_ACTIVE_LEVEL <= NK_LOG_LEVEL_INFO
+            #define LOG_INFO(logger, ...) \
+                NK_LOGGER_CALL_IF(logger, LogLevel::Info, \
+                    Log(LogLevel::Info, __FILE__, __LINE__, __FUNCTION__, __VA_ARGS__))
+            #define LOG_INFO_DEFERRED(logger, ...) \
+                NK_LOGGER_CALL_IF(logger, LogLevel::Info, \
+                    LogDeferred(LogLevel::Info, __FILE__, __LINE__, __FUNCTION__, __VA_ARGS__))
+            #define LOG_INFO_SRC(logger, ...) \
+                NK_LOGGER_CALL_IF(logger, LogLevel::Info, \
+                    LogInternal(LogLevel::Info, (logger)->FormatString(__VA_ARGS__), \
+                                __FILE__, __LINE__, __FUNCTION__))
+        #else
+            #define LOG_INFO(logger, ...) ((void)0)
+            #define LOG_INFO_DEFERRED(logger, ...) ((void)0)
+            #define LOG_INFO_SRC(logger, ...) ((void)0)
+        #endif
         
-        #define LOG_ERROR(logger, ...) \
-            if ((logger)->ShouldLog(LogLevel::Error)) \
-                (logger)->Log(LogLevel::Error, __FILE__, __LINE__, __FUNCTION__, __VA_ARGS__)
+        #if NK_LOG_ACTIVE_LEVEL <= NK_LOG_LEVEL_WARN
+            #define LOG_WARN(logger, ...) \
+                NK_LOGGER_CALL_IF(logger, LogLevel::Warn, \
+                    Log(LogLevel::Warn, __FILE__, __LINE__, __FUNCTION__, __VA_ARGS__))
+            #define LOG_WARN_DEFERRED(logger, ...) \
+                NK_LOGGER_CALL_IF(logger, LogLevel::Warn, \
+                    LogDeferred(LogLevel::Warn, __FILE__, __LINE__, __FUNCTION__, __VA_ARGS__))
+            #define LOG_WARN_SRC(logger, ...) \
+                NK_LOGGER_CALL_IF(logger, LogLevel::Warn, \
+                    LogInternal(LogLevel::Warn, (logger)->FormatString(__VA_ARGS__), \
+                                __FILE__, __LINE__, __FUNCTION__))
+        #else
+            #define LOG_WARN(logger, ...) ((void)0)
+            #define LOG_WARN_DEFERRED(logger, ...) ((void)0)
+            #define LOG_WARN_SRC(logger, ...) ((void)0)
+        #endif
         
-        #define LOG_CRITICAL(logger, ...) \
-            if ((logger)->ShouldLog(LogLevel::Critical)) \
-                (logger)->Log(LogLevel::Critical, __FILE__, __LINE__, __FUNCTION__, __VA_ARGS__)
+        #if NK_LOG_ACTIVE_LEVEL <= NK_LOG_LEVEL_ERROR
+            #define LOG_ERROR(logger, ...) \
+                NK_LOGGER_CALL_IF(logger, LogLevel::Error, \
+                    Log(LogLevel::Error, __FILE__, __LINE__, __FUNCTION__, __VA_ARGS__))
+            #define LOG_ERROR_DEFERRED(logger, ...) \
+                NK_LOGGER_CALL_IF(logger, LogLevel::Error, \
+                    LogDeferred(LogLevel::Error, __FILE__, __LINE__, __FUNCTION__, __VA_ARGS__))
+            #define LOG_ERROR_SRC(logger, ...) \
+                NK_LOGGER_CALL_IF(logger, LogLevel::Error, \
+                    LogInternal(LogLevel::Error, (logger)->FormatString(__VA_ARGS__), \
+                                __FILE__, __LINE__, __FUNCTION__))
+        #else
+            #define LOG_ERROR(logger, ...) ((void)0)
+            #define LOG_ERROR_DEFERRED(logger, ...) ((void)0)
+            #define LOG_ERROR_SRC(logger, ...) ((void)0)
+        #endif
         
-        #define LOG_FATAL(logger, ...) \
-            if ((logger)->ShouldLog(LogLevel::Fatal)) \
-                (logger)->Log(LogLevel::Fatal, __FILE__, __LINE__, __FUNCTION__, __VA_ARGS__)
-
-        #define LOG_FLUSH(logger) \
-            (logger)->Flush()
+        #if NK_LOG_ACTIVE_LEVEL <= NK_LOG_LEVEL_CRITICAL
+            #define LOG_CRITICAL(logger, ...) \
+                NK_LOGGER_CALL_IF(logger, LogLevel::Critical, \
+                    Log(LogLevel::Critical, __FILE__, __LINE__, __FUNCTION__, __VA_ARGS__))
+            #define LOG_CRITICAL_DEFERRED(logger, ...) \
+                NK_LOGGER_CALL_IF(logger, LogLevel::Critical, \
+                    LogDeferred(LogLevel::Critical, __FILE__, __LINE__, __FUNCTION__, __VA_ARGS__))
+            #define LOG_CRITICAL_SRC(logger, ...) \
+                NK_LOGGER_CALL_IF(logger, LogLevel::Critical, \
+                    LogInternal(LogLevel::Critical, (logger)->FormatString(__VA_ARGS__), \
+                                __FILE__, __LINE__, __FUNCTION__))
+        #else
+            #define LOG_CRITICAL(logger, ...) ((void)0)
+            #define LOG_CRITICAL_DEFERRED(logger, ...) ((void)0)
+            #define LOG_CRITICAL_SRC(logger, ...) ((void)0)
+        #endif
         
-        // -------------------------------------------------------------------------
-        // MACROS AVEC INFORMATIONS DE SOURCE
-        // -------------------------------------------------------------------------
-        
-        #define LOG_TRACE_SRC(logger, ...) \
-            (logger)->LogInternal(LogLevel::Trace, (logger)->FormatString(__VA_ARGS__), \
-                                __FILE__, __LINE__, __FUNCTION__)
-        
-        #define LOG_DEBUG_SRC(logger, ...) \
-            (logger)->LogInternal(LogLevel::Debug, (logger)->FormatString(__VA_ARGS__), \
-                                __FILE__, __LINE__, __FUNCTION__)
-        
-        #define LOG_INFO_SRC(logger, ...) \
-            (logger)->LogInternal(LogLevel::Info, (logger)->FormatString(__VA_ARGS__), \
-                                __FILE__, __LINE__, __FUNCTION__)
+        #if NK_LOG_ACTIVE_LEVEL <= NK_LOG_LEVEL_FATAL
+            #define LOG_FATAL(logger, ...) \
+                NK_LOGGER_CALL_IF(logger, LogLevel::Fatal, \
+                    Log(LogLevel::Fatal, __FILE__, __LINE__, __FUNCTION__, __VA_ARGS__))
+            #define LOG_FATAL_DEFERRED(logger, ...) \
+                NK_LOGGER_CALL_IF(logger, LogLevel::Fatal, \
+                    LogDeferred(LogLevel::Fatal, __FILE__, __LINE__, __FUNCTION__, __VA_ARGS__))
+            #define LOG_FATAL_SRC(logger, ...) \
+                NK_LOGGER_CALL_IF(logger, LogLevel::Fatal, \
+                    LogInternal(LogLevel::Fatal, (logger)->FormatString(__VA_ARGS__), \
+                                __FILE__, __LINE__, __FUNCTION__))
+        #else
+            #define LOG_FATAL(logger, ...) ((void)0)
+            #define LOG_FATAL_DEFERRED(logger, ...) ((void)0)
+            #define LOG_FATAL_SRC(logger, ...) ((void)0)
+        #endif
         
-        #define LOG_WARN_SRC(logger, ...) \
-            (logger)->LogInternal(LogLevel::Warn, (logger)->FormatString(__VA_ARGS__), \
-                                __FILE__, __LINE__, __FUNCTION__)
-        
-        #define LOG_ERROR_SRC(logger, ...) \
-            (logger)->LogInternal(LogLevel::Error, (logger)->FormatString(__VA_ARGS__), \
-                                __FILE__, __LINE__, __FUNCTION__)
-        
-        #define LOG_CRITICAL_SRC(logger, ...) \
-            (logger)->LogInternal(LogLevel::Critical, (logger)->FormatString(__VA_ARGS__), \
-                                __FILE__, __LINE__, __FUNCTION__)
-        
-        #define LOG_FATAL_SRC(logger, ...) \
-            (logger)->LogInternal(LogLevel::Fatal, (logger)->FormatString(__VA_ARGS__), \
-                                __FILE__, __LINE__, __FUNCTION__)
+        #define LOG_FLUSH(logger) \
+            (logger)->Flush()
 
     } // namespace logger
 } // namespace nkentseu
\ No newline at end of file
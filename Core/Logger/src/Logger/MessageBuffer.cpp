@@ -0,0 +1,230 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/MessageBuffer.cpp
+// DESCRIPTION: Implémentation du tampon de texte des messages de log.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#include "Logger/MessageBuffer.h"
+#include "Logger/LogArena.h"
+#include <cstdio>
+#include <cstring>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        // -------------------------------------------------------------------------
+        // IMPLÉMENTATION DE MessageBuffer
+        // -------------------------------------------------------------------------
+
+        /**
+         * @brief Constructeur par défaut
+         */
+        MessageBuffer::MessageBuffer() noexcept
+            : m_Data(m_Inline)
+            , m_Size(0)
+            , m_Capacity(INLINE_CAPACITY) {
+            m_Inline[0] = '\0';
+        }
+
+        /**
+         * @brief Constructeur depuis une chaîne
+         */
+        MessageBuffer::MessageBuffer(const std::string& text)
+            : MessageBuffer() {
+            Assign(text.data(), text.size());
+        }
+
+        /**
+         * @brief Constructeur depuis une chaîne C
+         */
+        MessageBuffer::MessageBuffer(const char* text)
+            : MessageBuffer() {
+            if (text) Assign(text, std::strlen(text));
+        }
+
+        /**
+         * @brief Constructeur de copie
+         */
+        MessageBuffer::MessageBuffer(const MessageBuffer& other)
+            : MessageBuffer() {
+            Assign(other.m_Data, other.m_Size);
+        }
+
+        /**
+         * @brief Constructeur de déplacement
+         */
+        MessageBuffer::MessageBuffer(MessageBuffer&& other) noexcept
+            : MessageBuffer() {
+            *this = std::move(other);
+        }
+
+        /**
+         * @brief Affectation par copie
+         */
+        MessageBuffer& MessageBuffer::operator=(const MessageBuffer& other) {
+            if (this != &other) {
+                Assign(other.m_Data, other.m_Size);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Affectation par déplacement
+         */
+        MessageBuffer& MessageBuffer::operator=(MessageBuffer&& other) noexcept {
+            if (this == &other) return *this;
+
+            if (other.IsInline()) {
+                // Petit message: copie du stockage inline
+                std::memcpy(m_Data, other.m_Data, other.m_Size + 1);
+                m_Size = other.m_Size;
+            } else {
+                // Bloc externe: transfert du pointeur
+                ReleaseStorage();
+                m_Data = other.m_Data;
+                m_Size = other.m_Size;
+                m_Capacity = other.m_Capacity;
+
+                other.m_Data = other.m_Inline;
+                other.m_Capacity = INLINE_CAPACITY;
+            }
+
+            other.m_Size = 0;
+            other.m_Data[0] = '\0';
+            return *this;
+        }
+
+        /**
+         * @brief Affectation depuis une chaîne
+         */
+        MessageBuffer& MessageBuffer::operator=(const std::string& text) {
+            Assign(text.data(), text.size());
+            return *this;
+        }
+
+        /**
+         * @brief Affectation depuis une chaîne C
+         */
+        MessageBuffer& MessageBuffer::operator=(const char* text) {
+            if (text) {
+                Assign(text, std::strlen(text));
+            } else {
+                Clear();
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Destructeur
+         */
+        MessageBuffer::~MessageBuffer() {
+            ReleaseStorage();
+        }
+
+        /**
+         * @brief Remplace le contenu
+         */
+        void MessageBuffer::Assign(const char* data, size_t size) {
+            Reserve(size + 1, false);
+            if (size > 0) std::memcpy(m_Data, data, size);
+            m_Size = size;
+            m_Data[m_Size] = '\0';
+        }
+
+        /**
+         * @brief Remplace le contenu par un texte formaté
+         */
+        void MessageBuffer::AssignFormat(const char* format, va_list args) {
+            va_list argsCopy;
+            va_copy(argsCopy, args);
+            int size = std::vsnprintf(m_Data, m_Capacity, format, argsCopy);
+            va_end(argsCopy);
+
+            if (size < 0) {
+                Clear();
+                return;
+            }
+
+            if (static_cast<size_t>(size) >= m_Capacity) {
+                // Texte tronqué: agrandir puis reformater
+                Reserve(static_cast<size_t>(size) + 1, false);
+                std::vsnprintf(m_Data, m_Capacity, format, args);
+            }
+
+            m_Size = static_cast<size_t>(size);
+        }
+
+        /**
+         * @brief Ajoute du texte à la fin
+         */
+        void MessageBuffer::Append(const char* data, size_t size) {
+            Reserve(m_Size + size + 1, true);
+            if (size > 0) std::memcpy(m_Data + m_Size, data, size);
+            m_Size += size;
+            m_Data[m_Size] = '\0';
+        }
+
+        /**
+         * @brief Agrandit le contenu d'octets non initialisés
+         */
+        char* MessageBuffer::Extend(size_t size) {
+            Reserve(m_Size + size + 1, true);
+            char* added = m_Data + m_Size;
+            m_Size += size;
+            m_Data[m_Size] = '\0';
+            return added;
+        }
+
+        /**
+         * @brief Vide le contenu
+         */
+        void MessageBuffer::Clear() {
+            m_Size = 0;
+            m_Data[0] = '\0';
+        }
+
+        /**
+         * @brief Copie le contenu dans une std::string
+         */
+        std::string MessageBuffer::ToString() const {
+            return std::string(m_Data, m_Size);
+        }
+
+        /**
+         * @brief Garantit une capacité minimum
+         */
+        void MessageBuffer::Reserve(size_t capacity, bool keepContent) {
+            if (capacity <= m_Capacity) return;
+
+            size_t blockCapacity = 0;
+            char* block = LogArena::Allocate(capacity, blockCapacity);
+
+            if (keepContent) {
+                std::memcpy(block, m_Data, m_Size + 1);
+            } else {
+                m_Size = 0;
+                block[0] = '\0';
+            }
+
+            ReleaseStorage();
+            m_Data = block;
+            m_Capacity = blockCapacity;
+        }
+
+        /**
+         * @brief Rend le bloc externe éventuel
+         */
+        void MessageBuffer::ReleaseStorage() {
+            if (!IsInline()) {
+                LogArena::Release(m_Data, m_Capacity);
+                m_Data = m_Inline;
+                m_Capacity = INLINE_CAPACITY;
+            }
+        }
+
+    } // namespace logger
+} // namespace nkentseu
@@ -0,0 +1,160 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/MessageBuffer.h
+// DESCRIPTION: Tampon de texte du message de log: stockage inline pour les
+//              messages courts, débordement dans LogArena pour les autres.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Logger/Export.h"
+#include <Nkentseu/Types.h>
+#include <cstdarg>
+#include <cstddef>
+#include <string>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        // -------------------------------------------------------------------------
+        // CLASSE: MessageBuffer
+        // DESCRIPTION: Chaîne terminée par '\0' sans allocation pour les messages
+        //              de moins de INLINE_CAPACITY octets. Au-delà, le texte est
+        //              placé dans un bloc de LogArena, recyclé à la destruction.
+        //              Le déplacement transfère le bloc sans copie.
+        // -------------------------------------------------------------------------
+        class LOGGER_API MessageBuffer {
+            public:
+                /// Capacité du stockage inline ('\0' final compris)
+                static constexpr size_t INLINE_CAPACITY = 192;
+
+                // ---------------------------------------------------------------------
+                // CONSTRUCTEURS ET DESTRUCTEUR
+                // ---------------------------------------------------------------------
+
+                /**
+                 * @brief Constructeur par défaut (chaîne vide)
+                 */
+                MessageBuffer() noexcept;
+
+                /**
+                 * @brief Constructeur depuis une chaîne
+                 * @param text Texte initial
+                 */
+                MessageBuffer(const std::string& text);
+
+                /**
+                 * @brief Constructeur depuis une chaîne C
+                 * @param text Texte initial (nullptr accepté)
+                 */
+                MessageBuffer(const char* text);
+
+                MessageBuffer(const MessageBuffer& other);
+                MessageBuffer(MessageBuffer&& other) noexcept;
+                MessageBuffer& operator=(const MessageBuffer& other);
+                MessageBuffer& operator=(MessageBuffer&& other) noexcept;
+                MessageBuffer& operator=(const std::string& text);
+                MessageBuffer& operator=(const char* text);
+
+                /**
+                 * @brief Destructeur (rend le bloc éventuel à l'arène)
+                 */
+                ~MessageBuffer();
+
+                // ---------------------------------------------------------------------
+                // MODIFICATION
+                // ---------------------------------------------------------------------
+
+                /**
+                 * @brief Remplace le contenu
+                 * @param data Données à copier
+                 * @param size Nombre d'octets
+                 */
+                void Assign(const char* data, size_t size);
+
+                /**
+                 * @brief Remplace le contenu par un texte formaté (style printf)
+                 * @param format Format string
+                 * @param args Arguments (consommés)
+                 *
+                 * Formate directement dans le stockage courant; un second passage
+                 * n'a lieu que si le texte dépasse la capacité disponible.
+                 */
+                void AssignFormat(const char* format, va_list args);
+
+                /**
+                 * @brief Ajoute du texte à la fin
+                 * @param data Données à copier
+                 * @param size Nombre d'octets
+                 */
+                void Append(const char* data, size_t size);
+
+                /**
+                 * @brief Agrandit le contenu d'octets non initialisés
+                 * @param size Nombre d'octets ajoutés
+                 * @return Adresse du premier octet ajouté (à remplir par l'appelant)
+                 */
+                char* Extend(size_t size);
+
+                /**
+                 * @brief Vide le contenu (le stockage est conservé)
+                 */
+                void Clear();
+
+                // ---------------------------------------------------------------------
+                // ACCÈS
+                // ---------------------------------------------------------------------
+
+                /// Données (toujours terminées par '\0')
+                const char* Data() const { return m_Data; }
+
+                /// Chaîne C (identique à Data())
+                const char* CStr() const { return m_Data; }
+
+                /// Taille en octets (hors '\0')
+                size_t Size() const { return m_Size; }
+
+                /// Vérifie si le tampon est vide
+                bool IsEmpty() const { return m_Size == 0; }
+
+                /// Vérifie si le texte tient dans le stockage inline
+                bool IsInline() const { return m_Data == m_Inline; }
+
+                /**
+                 * @brief Copie le contenu dans une std::string
+                 * @return Copie du texte
+                 */
+                std::string ToString() const;
+
+            private:
+                /**
+                 * @brief Garantit une capacité d'au moins capacity octets ('\0' compris)
+                 * @param capacity Capacité requise
+                 * @param keepContent Conserver le texte existant
+                 */
+                void Reserve(size_t capacity, bool keepContent);
+
+                /**
+                 * @brief Rend le bloc externe éventuel et revient au stockage inline
+                 */
+                void ReleaseStorage();
+
+                /// Texte courant (m_Inline ou bloc de l'arène)
+                char* m_Data;
+
+                /// Taille du texte
+                size_t m_Size;
+
+                /// Capacité du stockage courant
+                size_t m_Capacity;
+
+                /// Stockage inline
+                char m_Inline[INLINE_CAPACITY];
+        };
+
+    } // namespace logger
+} // namespace nkentseu
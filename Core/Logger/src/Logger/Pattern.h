@@ -67,6 +67,22 @@ namespace nkentseu {
          */
         extern const char* SYSLOG_PATTERN;
 
+        // -------------------------------------------------------------------------
+        // PATTERNS CONSTANTS (utilisables comme paramètres de template)
+        // -------------------------------------------------------------------------
+        
+        /**
+         * Tableaux constexpr à lien externe: ils peuvent être passés à
+         * CompiledFormatter<patterns::Default> pour un formatage compilé.
+         */
+        namespace patterns {
+            inline constexpr char Default[] = "[%Y-%m-%d %H:%M:%S.%e] [%L] [%n] [%t] -> %v";
+            inline constexpr char Simple[] = "%v";
+            inline constexpr char Detailed[] = "[%Y-%m-%d %H:%M:%S.%e] [%L] [%n] [thread %t] [%s:%# in %f] -> %v";
+            inline constexpr char Color[] = "[%Y-%m-%d %H:%M:%S.%e] [%^%L%$] [%n] [%t] -> %v";
+            inline constexpr char Json[] = R"({"time":"%Y-%m-%dT%H:%M:%S.%fZ","level":"%l","thread":%t,"logger":"%n","file":"%s","line":%#,"function":"%f","message":"%v"})";
+        } // namespace patterns
+
         // -------------------------------------------------------------------------
         // DOCUMENTATION DES TOKENS DE PATTERN
         // -------------------------------------------------------------------------
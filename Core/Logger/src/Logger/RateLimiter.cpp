@@ -0,0 +1,226 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/RateLimiter.cpp
+// DESCRIPTION: Implémentation de la suppression des répétitions et de la
+//              limitation du débit.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#include "Logger/RateLimiter.h"
+#include <cstdint>
+#include <thread>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        namespace {
+
+            /// Nanosecondes par milliseconde et par seconde
+            const uint64 NS_PER_MS = 1000000ULL;
+            const uint64 NS_PER_SECOND = 1000000000ULL;
+
+            /**
+             * @brief Mélange final de 64 bits (splitmix64)
+             */
+            inline uint64 Mix(uint64 value) {
+                value ^= value >> 30;
+                value *= 0xBF58476D1CE4E5B9ULL;
+                value ^= value >> 27;
+                value *= 0x94D049BB133111EBULL;
+                value ^= value >> 31;
+                return value;
+            }
+
+            /**
+             * @brief Avance tolérée du GCRA: rafale - 1 intervalles
+             */
+            inline uint64 BurstTolerance(const RateLimitConfig& config, uint64 intervalNs) {
+                const uint64 burst = config.burst > 0 ? config.burst : config.messagesPerSecond;
+                return burst > 1 ? intervalNs * (burst - 1) : 0;
+            }
+
+            // ---------------------------------------------------------------------
+            // CLASSE: SiteLock
+            // DESCRIPTION: Verrou actif d'un site pour la portée courante
+            // ---------------------------------------------------------------------
+            class SiteLock {
+                public:
+                    explicit SiteLock(std::atomic<bool>& busy) : m_Busy(busy) {
+                        while (m_Busy.exchange(true, std::memory_order_acquire)) {
+                            while (m_Busy.load(std::memory_order_relaxed)) {
+                                std::this_thread::yield();
+                            }
+                        }
+                    }
+
+                    ~SiteLock() {
+                        m_Busy.store(false, std::memory_order_release);
+                    }
+
+                    SiteLock(const SiteLock&) = delete;
+                    SiteLock& operator=(const SiteLock&) = delete;
+
+                private:
+                    std::atomic<bool>& m_Busy;
+            };
+
+        } // namespace
+
+        // -------------------------------------------------------------------------
+        // CONSTRUCTEUR
+        // -------------------------------------------------------------------------
+
+        /**
+         * @brief Constructeur
+         */
+        RateLimiter::RateLimiter(const RateLimitConfig& config)
+            : m_Config(config)
+            , m_WindowNs(static_cast<uint64>(config.repeatWindowMs) * NS_PER_MS)
+            , m_IntervalNs(config.messagesPerSecond > 0 ? NS_PER_SECOND / config.messagesPerSecond : 0)
+            , m_ToleranceNs(BurstTolerance(config, m_IntervalNs))
+            , m_Sites(new Site[SITE_COUNT])
+            , m_TheoreticalArrival(0)
+            , m_PendingLimited(0)
+            , m_SuppressedRepeats(0)
+            , m_RateLimited(0) {
+        }
+
+        // -------------------------------------------------------------------------
+        // DÉCISION
+        // -------------------------------------------------------------------------
+
+        /**
+         * @brief Décide si un message atteint les sinks
+         */
+        RateLimiter::Verdict RateLimiter::Admit(uint64 site, const LogMessage& message) {
+            Verdict verdict;
+
+            if (m_WindowNs > 0 && !AdmitRepeat(site, message, verdict.repeats)) {
+                verdict.admitted = false;
+                return verdict;
+            }
+
+            if (m_IntervalNs > 0) {
+                if (!AdmitRate(message.timestamp)) {
+                    m_PendingLimited.fetch_add(1, std::memory_order_relaxed);
+                    m_RateLimited.fetch_add(1, std::memory_order_relaxed);
+                    verdict.admitted = false;
+                    return verdict;
+                }
+                if (m_PendingLimited.load(std::memory_order_relaxed) > 0) {
+                    verdict.rateLimited = m_PendingLimited.exchange(0, std::memory_order_relaxed);
+                }
+            }
+
+            return verdict;
+        }
+
+        /**
+         * @brief Suppression des répétitions d'un site
+         */
+        bool RateLimiter::AdmitRepeat(uint64 site, const LogMessage& message, RepeatSummary& summary) {
+            const uint64 key = Mix(site ^
+                                   Mix(reinterpret_cast<uintptr_t>(message.sourceFile)) ^
+                                   (static_cast<uint64>(message.sourceLine) << 32)) | 1;
+            Site& slot = m_Sites[key & (SITE_COUNT - 1)];
+            const uint64 now = message.timestamp;
+
+            SiteLock lock(slot.busy);
+
+            // Même site, fenêtre ouverte: répétition (une horloge qui recule
+            // donne une différence énorme et rouvre la fenêtre)
+            if (slot.key == key && now - slot.windowStart < m_WindowNs) {
+                ++slot.suppressed;
+                m_SuppressedRepeats.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+
+            // Fenêtre écoulée ou site évincé: résumer ses suppressions
+            if (slot.suppressed > 0) {
+                summary.level = slot.level;
+                summary.location = slot.location;
+                summary.count = slot.suppressed;
+            }
+
+            slot.key = key;
+            slot.windowStart = now;
+            slot.suppressed = 0;
+            slot.level = message.level;
+            slot.location = SourceLocation(message.sourceFile, message.sourceLine, message.functionName);
+            return true;
+        }
+
+        /**
+         * @brief Seau à jetons (GCRA)
+         *
+         * Un message est admis si l'instant théorique d'arrivée ne dépasse pas
+         * maintenant de plus que la rafale tolérée; l'instant avance alors
+         * d'un intervalle.
+         */
+        bool RateLimiter::AdmitRate(uint64 now) {
+            uint64 arrival = m_TheoreticalArrival.load(std::memory_order_relaxed);
+            for (;;) {
+                const uint64 start = arrival > now ? arrival : now;
+                if (start - now > m_ToleranceNs) {
+                    return false;
+                }
+                if (m_TheoreticalArrival.compare_exchange_weak(arrival, start + m_IntervalNs,
+                                                               std::memory_order_relaxed)) {
+                    return true;
+                }
+            }
+        }
+
+        /**
+         * @brief Retire les répétitions en attente de tous les sites
+         */
+        void RateLimiter::TakePendingRepeats(std::vector<RepeatSummary>& summaries) {
+            if (m_WindowNs == 0) return;
+
+            for (size_t i = 0; i < SITE_COUNT; ++i) {
+                Site& slot = m_Sites[i];
+                SiteLock lock(slot.busy);
+                if (slot.suppressed == 0) continue;
+
+                RepeatSummary summary;
+                summary.level = slot.level;
+                summary.location = slot.location;
+                summary.count = slot.suppressed;
+                summaries.push_back(summary);
+
+                // Le site reste suivi: sa fenêtre continue sans suppression due
+                slot.suppressed = 0;
+            }
+        }
+
+        /**
+         * @brief Empreinte d'un texte (FNV-1a)
+         */
+        uint64 RateLimiter::HashText(const char* text, size_t length) {
+            uint64 hash = 0xCBF29CE484222325ULL;
+            for (size_t i = 0; i < length; ++i) {
+                hash ^= static_cast<uint8>(text[i]);
+                hash *= 0x100000001B3ULL;
+            }
+            return hash;
+        }
+
+        // -------------------------------------------------------------------------
+        // INFORMATIONS
+        // -------------------------------------------------------------------------
+
+        /**
+         * @brief Obtient les compteurs
+         */
+        RateLimitStats RateLimiter::GetStats() const {
+            RateLimitStats stats;
+            stats.suppressedRepeats = m_SuppressedRepeats.load(std::memory_order_relaxed);
+            stats.rateLimited = m_RateLimited.load(std::memory_order_relaxed);
+            return stats;
+        }
+
+    } // namespace logger
+} // namespace nkentseu
@@ -0,0 +1,239 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/RateLimiter.h
+// DESCRIPTION: Étape du pipeline entre le logger et ses sinks: suppression des
+//              répétitions par site d'appel et limitation du débit.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Logger/Export.h"
+#include "Logger/LogLevel.h"
+#include "Logger/LogMessage.h"
+#include "Logger/RingBuffer.h"
+#include "Logger/SourceLocation.h"
+#include <Nkentseu/Types.h>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        // -------------------------------------------------------------------------
+        // STRUCTURE: RateLimitConfig
+        // DESCRIPTION: Réglages de l'étape de limitation d'un logger
+        // -------------------------------------------------------------------------
+        struct RateLimitConfig {
+            /// Fenêtre de suppression des répétitions d'un site d'appel en ms
+            /// (0 = désactivée)
+            uint32 repeatWindowMs = 0;
+
+            /// Messages par seconde transmis aux sinks (0 = illimité)
+            uint32 messagesPerSecond = 0;
+
+            /// Rafale tolérée au-delà du débit (0 = une seconde de débit)
+            uint32 burst = 0;
+
+            /**
+             * @brief Indique si l'étape a un effet
+             */
+            bool IsEnabled() const { return repeatWindowMs > 0 || messagesPerSecond > 0; }
+        };
+
+        // -------------------------------------------------------------------------
+        // STRUCTURE: RateLimitStats
+        // DESCRIPTION: Compteurs de l'étape de limitation
+        // -------------------------------------------------------------------------
+        struct RateLimitStats {
+            /// Répétitions supprimées dans la fenêtre de leur site d'appel
+            uint64 suppressedRepeats = 0;
+
+            /// Messages refusés par la limite de débit
+            uint64 rateLimited = 0;
+        };
+
+        // -------------------------------------------------------------------------
+        // STRUCTURE: RepeatSummary
+        // DESCRIPTION: Répétitions supprimées d'un site, à résumer dans les sinks
+        // -------------------------------------------------------------------------
+        struct RepeatSummary {
+            /// Niveau du site d'appel
+            LogLevel level = LogLevel::Info;
+
+            /// Emplacement du site d'appel
+            SourceLocation location;
+
+            /// Nombre de messages supprimés (0: rien à résumer)
+            uint32 count = 0;
+        };
+
+        // -------------------------------------------------------------------------
+        // CLASSE: RateLimiter
+        // DESCRIPTION: Décide, avant formatage, si un message atteint les sinks.
+        //
+        //              Répétitions: un site d'appel (adresse du format, ou
+        //              empreinte du texte, plus fichier et ligne) laisse passer
+        //              un message puis supprime les suivants pendant la fenêtre.
+        //              Le premier message admis après la fenêtre rapporte le
+        //              nombre de suppressions. La table des sites est de taille
+        //              fixe; deux sites en collision se remplacent, le site
+        //              évincé rapporte alors ses suppressions.
+        //
+        //              Débit: seau à jetons par logger, tenu sous forme de GCRA
+        //              (un instant théorique d'arrivée et un compare-exchange).
+        //
+        //              Admit est appelé par tous les threads producteurs: un
+        //              mélange de bits, un verrou actif par site et au plus un
+        //              compare-exchange pour le débit.
+        // -------------------------------------------------------------------------
+        class LOGGER_API RateLimiter {
+            public:
+                // ---------------------------------------------------------------------
+                // STRUCTURE: Verdict
+                // DESCRIPTION: Décision pour un message et résumés à émettre avant
+                // ---------------------------------------------------------------------
+                struct Verdict {
+                    /// Le message atteint les sinks
+                    bool admitted = true;
+
+                    /// Répétitions à résumer (site du message ou site évincé)
+                    RepeatSummary repeats;
+
+                    /// Messages refusés par le débit depuis le dernier message admis
+                    uint64 rateLimited = 0;
+                };
+
+                /// Nombre de sites suivis (puissance de 2)
+                static constexpr size_t SITE_COUNT = 512;
+
+                // ---------------------------------------------------------------------
+                // CONSTRUCTEURS
+                // ---------------------------------------------------------------------
+
+                /**
+                 * @brief Constructeur
+                 * @param config Réglages (fixes pour la durée de vie de l'objet)
+                 */
+                explicit RateLimiter(const RateLimitConfig& config);
+
+                RateLimiter(const RateLimiter&) = delete;
+                RateLimiter& operator=(const RateLimiter&) = delete;
+
+                // ---------------------------------------------------------------------
+                // DÉCISION
+                // ---------------------------------------------------------------------
+
+                /**
+                 * @brief Décide si un message atteint les sinks
+                 * @param site Identité du site (adresse du format ou empreinte du texte)
+                 * @param message Message préparé (horodatage, niveau, emplacement)
+                 * @return Décision et résumés à émettre avant le message
+                 */
+                Verdict Admit(uint64 site, const LogMessage& message);
+
+                /**
+                 * @brief Retire les répétitions en attente de tous les sites
+                 * @param summaries Reçoit un résumé par site ayant des suppressions
+                 *
+                 * Appelé au flush: une rafale suivie de silence est aussi résumée.
+                 */
+                void TakePendingRepeats(std::vector<RepeatSummary>& summaries);
+
+                /**
+                 * @brief Empreinte d'un texte, identité d'un site sans format
+                 * @param text Texte du message
+                 * @param length Longueur du texte
+                 */
+                static uint64 HashText(const char* text, size_t length);
+
+                // ---------------------------------------------------------------------
+                // INFORMATIONS
+                // ---------------------------------------------------------------------
+
+                /**
+                 * @brief Obtient les réglages
+                 */
+                const RateLimitConfig& GetConfig() const { return m_Config; }
+
+                /**
+                 * @brief Obtient les compteurs
+                 */
+                RateLimitStats GetStats() const;
+
+            private:
+                // ---------------------------------------------------------------------
+                // TYPES PRIVÉS
+                // ---------------------------------------------------------------------
+
+                /// Site d'appel suivi, seul sur sa ligne de cache
+                struct alignas(LOGGER_CACHE_LINE_SIZE) Site {
+                    /// Verrou actif du site (sections de quelques instructions)
+                    std::atomic<bool> busy{false};
+
+                    /// Clé du site (0: libre)
+                    uint64 key = 0;
+
+                    /// Début de la fenêtre en cours (ns)
+                    uint64 windowStart = 0;
+
+                    /// Messages supprimés dans la fenêtre
+                    uint32 suppressed = 0;
+
+                    /// Niveau et emplacement, pour le résumé
+                    LogLevel level = LogLevel::Info;
+                    SourceLocation location;
+                };
+
+                // ---------------------------------------------------------------------
+                // MÉTHODES PRIVÉES
+                // ---------------------------------------------------------------------
+
+                /**
+                 * @brief Suppression des répétitions d'un site
+                 * @return false si le message est une répétition à supprimer
+                 */
+                bool AdmitRepeat(uint64 site, const LogMessage& message, RepeatSummary& summary);
+
+                /**
+                 * @brief Seau à jetons (GCRA)
+                 * @return false si le débit est dépassé
+                 */
+                bool AdmitRate(uint64 now);
+
+                // ---------------------------------------------------------------------
+                // VARIABLES MEMBRE PRIVÉES
+                // ---------------------------------------------------------------------
+
+                /// Réglages
+                const RateLimitConfig m_Config;
+
+                /// Fenêtre de répétition (ns)
+                const uint64 m_WindowNs;
+
+                /// Intervalle entre deux jetons (ns)
+                const uint64 m_IntervalNs;
+
+                /// Avance tolérée sur l'instant théorique (rafale, ns)
+                const uint64 m_ToleranceNs;
+
+                /// Sites suivis
+                std::unique_ptr<Site[]> m_Sites;
+
+                /// Instant théorique d'arrivée du prochain message (GCRA, ns)
+                alignas(LOGGER_CACHE_LINE_SIZE) std::atomic<uint64> m_TheoreticalArrival;
+
+                /// Refus du débit depuis le dernier message admis
+                std::atomic<uint64> m_PendingLimited;
+
+                /// Compteurs cumulés
+                std::atomic<uint64> m_SuppressedRepeats;
+                std::atomic<uint64> m_RateLimited;
+        };
+
+    } // namespace logger
+} // namespace nkentseu
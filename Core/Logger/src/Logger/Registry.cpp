@@ -123,7 +123,7 @@ namespace nkentseu {
             
             // Création d'un nouveau logger
             auto logger = std::make_shared<Logger>(name);
-            logger->SetLevel(m_GlobalLevel);
+            logger->SetLevel(m_GlobalLevel.load(std::memory_order_relaxed));
             logger->SetPattern(m_GlobalPattern);
             
             m_Loggers[name] = logger;
@@ -175,9 +175,9 @@ namespace nkentseu {
          */
         void Registry::SetGlobalLevel(LogLevel level) {
             std::lock_guard<std::mutex> lock(m_Mutex);
-            m_GlobalLevel = level;
+            m_GlobalLevel.store(level, std::memory_order_relaxed);
             
-            // Appliquer à tous les loggers existants
+            // Appliquer à tous les loggers existants (SetLevel est sans verrou)
             for (auto& pair : m_Loggers) {
                 if (pair.second) {
                     pair.second->SetLevel(level);
@@ -189,8 +189,7 @@ namespace nkentseu {
          * @brief Obtient le niveau de log global
          */
         LogLevel Registry::GetGlobalLevel() const {
-            std::lock_guard<std::mutex> lock(m_Mutex);
-            return m_GlobalLevel;
+            return m_GlobalLevel.load(std::memory_order_relaxed);
         }
         
         /**
@@ -261,7 +260,7 @@ namespace nkentseu {
         std::shared_ptr<Logger> Registry::CreateDefaultLogger() {
             auto logger = std::make_shared<Logger>("default");
             
-            logger->SetLevel(m_GlobalLevel);
+            logger->SetLevel(m_GlobalLevel.load(std::memory_order_relaxed));
             logger->SetPattern(m_GlobalPattern);
             
             // Ajouter un sink console par défaut
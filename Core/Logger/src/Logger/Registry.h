@@ -13,6 +13,7 @@
 #include <string>
 #include <unordered_map>
 #include <mutex>
+#include <atomic>
 #include <vector>
 
 // -----------------------------------------------------------------------------
@@ -110,6 +111,9 @@ namespace nkentseu {
                 /**
                  * @brief Définit le niveau de log global
                  * @param level Niveau de log global
+                 *
+                 * Chaque logger reçoit le niveau par une écriture atomique: ni
+                 * leur mutex ni leurs appels de log en cours ne sont bloqués.
                  */
                 void SetGlobalLevel(LogLevel level);
                 
@@ -189,8 +193,8 @@ namespace nkentseu {
                 /// Logger par défaut
                 std::shared_ptr<Logger> m_DefaultLogger;
                 
-                /// Niveau de log global
-                LogLevel m_GlobalLevel;
+                /// Niveau de log global (lu sans verrou)
+                std::atomic<LogLevel> m_GlobalLevel;
                 
                 /// Pattern global
                 std::string m_GlobalPattern;
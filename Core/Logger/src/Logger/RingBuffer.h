@@ -0,0 +1,288 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/RingBuffer.h
+// DESCRIPTION: File circulaire bornée multi-producteurs / consommateur unique,
+//              sans verrou, avec numéros de séquence par slot. Les producteurs
+//              peuvent aussi évincer l'élément le plus ancien (file pleine).
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Logger/Export.h"
+#include <Nkentseu/Types.h>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <cstddef>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        /// Taille d'une ligne de cache (évite le faux partage entre compteurs)
+        constexpr size_t LOGGER_CACHE_LINE_SIZE = 64;
+
+        // -------------------------------------------------------------------------
+        // CLASSE: MPSCRingBuffer
+        // DESCRIPTION: File bornée et préallouée (algorithme de D. Vyukov).
+        //              Chaque slot porte un numéro de séquence qui indique s'il
+        //              est libre pour un producteur ou publié pour le consommateur.
+        //              Les producteurs réservent un slot par CAS sur la position
+        //              d'écriture, sans jamais prendre de verrou. La position de
+        //              lecture avance elle aussi par CAS afin qu'un producteur
+        //              puisse évincer l'élément le plus ancien pendant que le
+        //              consommateur travaille.
+        // -------------------------------------------------------------------------
+        template <typename T>
+        class MPSCRingBuffer {
+            public:
+                // ---------------------------------------------------------------------
+                // CONSTRUCTEURS
+                // ---------------------------------------------------------------------
+
+                /**
+                 * @brief Constructeur avec capacité
+                 * @param capacity Capacité demandée (arrondie à la puissance de 2 supérieure)
+                 */
+                explicit MPSCRingBuffer(size_t capacity)
+                    : m_Capacity(RoundUpToPowerOfTwo(capacity < 2 ? 2 : capacity))
+                    , m_Mask(m_Capacity - 1)
+                    , m_Slots(new Slot[m_Capacity])
+                    , m_EnqueuePos(0)
+                    , m_DequeuePos(0) {
+                    for (size_t i = 0; i < m_Capacity; ++i) {
+                        m_Slots[i].sequence.store(i, std::memory_order_relaxed);
+                    }
+                }
+
+                MPSCRingBuffer(const MPSCRingBuffer&) = delete;
+                MPSCRingBuffer& operator=(const MPSCRingBuffer&) = delete;
+
+                // ---------------------------------------------------------------------
+                // CÔTÉ PRODUCTEUR (thread-safe, sans verrou)
+                // ---------------------------------------------------------------------
+
+                /**
+                 * @brief Tente d'ajouter un élément (déplacé dans le slot)
+                 * @param value Élément à ajouter
+                 * @return true si ajouté, false si la file est pleine
+                 */
+                bool TryPush(T&& value) {
+                    Slot* slot = Reserve();
+                    if (!slot) return false;
+
+                    slot->value = std::move(value);
+                    Publish(slot);
+                    return true;
+                }
+
+                /**
+                 * @brief Tente d'ajouter un élément (copié dans le slot)
+                 * @param value Élément à ajouter
+                 * @return true si ajouté, false si la file est pleine
+                 */
+                bool TryPush(const T& value) {
+                    Slot* slot = Reserve();
+                    if (!slot) return false;
+
+                    slot->value = value;
+                    Publish(slot);
+                    return true;
+                }
+
+                /**
+                 * @brief Évince l'élément publié le plus ancien sans le lire
+                 * @return true si un élément a été évincé, false si la file est vide
+                 *
+                 * Utilisable depuis n'importe quel thread, y compris pendant que le
+                 * consommateur vide la file: le slot est rendu aux producteurs et
+                 * sa valeur sera écrasée par la prochaine écriture.
+                 */
+                bool TryDiscardOldest() {
+                    size_t pos = m_DequeuePos.load(std::memory_order_relaxed);
+
+                    for (;;) {
+                        Slot& slot = m_Slots[pos & m_Mask];
+                        size_t sequence = slot.sequence.load(std::memory_order_acquire);
+                        intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+
+                        if (diff == 0) {
+                            if (m_DequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                                slot.sequence.store(pos + m_Capacity, std::memory_order_release);
+                                return true;
+                            }
+                        } else if (diff < 0) {
+                            return false; // Rien de publié
+                        } else {
+                            pos = m_DequeuePos.load(std::memory_order_relaxed);
+                        }
+                    }
+                }
+
+                // ---------------------------------------------------------------------
+                // CÔTÉ CONSOMMATEUR (un seul thread à la fois)
+                // ---------------------------------------------------------------------
+
+                /**
+                 * @brief Tente de retirer un élément
+                 * @param out Élément retiré (déplacé)
+                 * @return true si un élément a été retiré, false si la file est vide
+                 */
+                bool TryPop(T& out) {
+                    return PopBatch([&out](T& value) { out = std::move(value); }, 1) == 1;
+                }
+
+                /**
+                 * @brief Traite jusqu'à maxCount éléments publiés, dans l'ordre
+                 * @param handler Fonction appelée avec une référence sur chaque élément
+                 * @param maxCount Nombre maximum d'éléments à traiter
+                 * @return Nombre d'éléments traités
+                 *
+                 * Chaque slot est rendu aux producteurs dès que le handler retourne,
+                 * sans attendre la fin du lot.
+                 */
+                template <typename Handler>
+                size_t PopBatch(Handler&& handler, size_t maxCount) {
+                    size_t pos = m_DequeuePos.load(std::memory_order_relaxed);
+                    size_t count = 0;
+
+                    while (count < maxCount) {
+                        Slot& slot = m_Slots[pos & m_Mask];
+                        size_t sequence = slot.sequence.load(std::memory_order_acquire);
+
+                        if (sequence != pos + 1) {
+                            if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1) < 0) {
+                                break; // Slot pas encore publié
+                            }
+                            // Un producteur a évincé ce slot: reprendre à la position courante
+                            pos = m_DequeuePos.load(std::memory_order_relaxed);
+                            continue;
+                        }
+
+                        if (!m_DequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                            continue; // pos rechargée par le CAS
+                        }
+
+                        handler(slot.value);
+
+                        slot.sequence.store(pos + m_Capacity, std::memory_order_release);
+                        ++pos;
+                        ++count;
+                    }
+
+                    return count;
+                }
+
+                // ---------------------------------------------------------------------
+                // INFORMATIONS
+                // ---------------------------------------------------------------------
+
+                /**
+                 * @brief Obtient la capacité réelle de la file
+                 * @return Nombre de slots
+                 */
+                size_t Capacity() const {
+                    return m_Capacity;
+                }
+
+                /**
+                 * @brief Obtient le nombre approximatif d'éléments en attente
+                 * @return Taille approximative (exacte si aucun producteur n'est actif)
+                 */
+                size_t SizeApprox() const {
+                    size_t dequeuePos = m_DequeuePos.load(std::memory_order_relaxed);
+                    size_t enqueuePos = m_EnqueuePos.load(std::memory_order_relaxed);
+                    return enqueuePos > dequeuePos ? enqueuePos - dequeuePos : 0;
+                }
+
+                /**
+                 * @brief Vérifie si le prochain slot à consommer est publié
+                 * @return true si aucun élément n'est prêt
+                 */
+                bool IsEmpty() const {
+                    size_t pos = m_DequeuePos.load(std::memory_order_relaxed);
+                    return m_Slots[pos & m_Mask].sequence.load(std::memory_order_acquire) != pos + 1;
+                }
+
+            private:
+                // ---------------------------------------------------------------------
+                // TYPES PRIVÉS
+                // ---------------------------------------------------------------------
+
+                /// Slot de la file: séquence + valeur préallouée
+                struct Slot {
+                    std::atomic<size_t> sequence;
+                    T value;
+                };
+
+                // ---------------------------------------------------------------------
+                // MÉTHODES PRIVÉES
+                // ---------------------------------------------------------------------
+
+                /**
+                 * @brief Réserve un slot libre pour un producteur
+                 * @return Slot réservé, nullptr si la file est pleine
+                 */
+                Slot* Reserve() {
+                    size_t pos = m_EnqueuePos.load(std::memory_order_relaxed);
+
+                    for (;;) {
+                        Slot& slot = m_Slots[pos & m_Mask];
+                        size_t sequence = slot.sequence.load(std::memory_order_acquire);
+                        intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+                        if (diff == 0) {
+                            if (m_EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                                return &slot;
+                            }
+                        } else if (diff < 0) {
+                            return nullptr; // File pleine
+                        } else {
+                            pos = m_EnqueuePos.load(std::memory_order_relaxed);
+                        }
+                    }
+                }
+
+                /**
+                 * @brief Publie un slot rempli vers le consommateur
+                 * @param slot Slot réservé par Reserve()
+                 */
+                void Publish(Slot* slot) {
+                    size_t sequence = slot->sequence.load(std::memory_order_relaxed);
+                    slot->sequence.store(sequence + 1, std::memory_order_release);
+                }
+
+                /**
+                 * @brief Arrondit à la puissance de 2 supérieure
+                 */
+                static size_t RoundUpToPowerOfTwo(size_t value) {
+                    size_t result = 1;
+                    while (result < value) result <<= 1;
+                    return result;
+                }
+
+                // ---------------------------------------------------------------------
+                // VARIABLES MEMBRE PRIVÉES
+                // ---------------------------------------------------------------------
+
+                /// Nombre de slots (puissance de 2)
+                const size_t m_Capacity;
+
+                /// Masque d'indexation (capacité - 1)
+                const size_t m_Mask;
+
+                /// Slots préalloués
+                std::unique_ptr<Slot[]> m_Slots;
+
+                /// Position d'écriture partagée par les producteurs
+                alignas(LOGGER_CACHE_LINE_SIZE) std::atomic<size_t> m_EnqueuePos;
+
+                /// Position de lecture (consommateur et évictions)
+                alignas(LOGGER_CACHE_LINE_SIZE) std::atomic<size_t> m_DequeuePos;
+        };
+
+    } // namespace logger
+} // namespace nkentseu
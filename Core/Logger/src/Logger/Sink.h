@@ -73,6 +73,55 @@ namespace nkentseu {
             // MÉTHODES VIRTUELLES (OPTIONNELLES)
             // ---------------------------------------------------------------------
             
+            /**
+             * @brief Logge un message déjà formaté par le logger
+             * @param message Message source
+             * @param formatted Ligne produite par un formatter de même pattern que
+             *                  celui du sink, avec couleurs si WantsColors()
+             *
+             * Appelé seulement si SupportsPreformatted() retourne true. Par
+             * défaut, le texte est ignoré et le message passe par Log().
+             */
+            virtual void LogFormatted(const LogMessage& message, const std::string& formatted) {
+                (void)formatted;
+                Log(message);
+            }
+            
+            /**
+             * @brief Indique si le sink sait écrire une ligne formatée par le logger
+             * @return true si LogFormatted() utilise le texte fourni
+             */
+            virtual bool SupportsPreformatted() const { return false; }
+            
+            /**
+             * @brief Indique si la ligne formatée doit contenir les codes couleur
+             * @return true pour un formatage avec couleurs
+             */
+            virtual bool WantsColors() const { return false; }
+            
+            /**
+             * @brief Indique si le sink reçoit les messages à format différé tels quels
+             * @return true si Log() enregistre lui-même deferredFormat et les
+             *         arguments capturés (voir DeferredFormat.h)
+             *
+             * Par défaut, le logger produit le texte avant l'appel: message.message
+             * contient alors toujours du texte.
+             */
+            virtual bool KeepsDeferred() const { return false; }
+            
+            /**
+             * @brief Début d'un lot de messages (logger asynchrone)
+             *
+             * Entre BeginBatch() et EndBatch(), le sink peut retenir ses
+             * écritures pour les regrouper en un seul appel système.
+             */
+            virtual void BeginBatch() {}
+            
+            /**
+             * @brief Fin d'un lot de messages: les écritures retenues doivent partir
+             */
+            virtual void EndBatch() {}
+            
             /**
              * @brief Définit le niveau minimum de log pour ce sink
              * @param level Niveau minimum
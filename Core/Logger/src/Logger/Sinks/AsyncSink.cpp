@@ -6,8 +6,9 @@
 // -----------------------------------------------------------------------------
 
 #include "Logger/Sinks/AsyncSink.h"
+#include "Logger/LogClock.h"
 #include <Nkentseu/Sleep.h>
-#include <cstdarg>
+#include <chrono>
 
 namespace nkentseu {
 namespace logger {
@@ -17,10 +18,22 @@ namespace logger {
      */
     AsyncLogger::AsyncLogger(const std::string& name, size_t queueSize, uint32 flushInterval)
         : Logger(name)
-        , m_MaxQueueSize(queueSize)
         , m_FlushInterval(flushInterval)
+        , m_OverflowPolicy(OverflowPolicy::DropNewest)
+        , m_BlockTimeout(10)
+        , m_SampleRate(10)
+        , m_SampleCounter(0)
+        , m_DroppedCount(0)
+        , m_OverwrittenCount(0)
+        , m_SampledOutCount(0)
+        , m_BlockTimeoutCount(0)
+        , m_SleepingWorkers(0)
+        , m_FlushTarget(0)
         , m_Running(false)
         , m_StopRequested(false) {
+        m_Groups.push_back(std::make_unique<SinkGroup>());
+        m_Groups[0]->copies.resize(DRAIN_BATCH_SIZE);
+        m_Queue = std::make_unique<BroadcastRingBuffer<LogMessage>>(queueSize, 1);
     }
 
     /**
@@ -31,42 +44,24 @@ namespace logger {
     }
 
     /**
-     * @brief Log asynchrone
+     * @brief Met en file un message construit par Logger
      */
-    void AsyncLogger::Log(LogLevel level, const char* format, ...) {
-        if (!ShouldLog(level)) return;
-
-        va_list args;
-        va_start(args, format);
-        std::string message = FormatString(format, args);
-        va_end(args);
-
-        Log(level, message);
+    void AsyncLogger::SubmitMessage(LogMessage& message) {
+        Enqueue(std::move(message));
     }
 
     /**
-     * @brief Log asynchrone avec message pré-formaté
+     * @brief Attend que les messages mis en file avant l'appel soient écrits
      */
-    void AsyncLogger::Log(LogLevel level, const std::string& message) {
-        if (!ShouldLog(level)) return;
-
-        LogMessage msg;
-        msg.timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
-            std::chrono::system_clock::now().time_since_epoch()).count();
-        msg.threadId = static_cast<uint32>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
-        msg.level = level;
-        msg.message = message;
-        msg.loggerName = GetName();
-
-        Enqueue(msg);
+    void AsyncLogger::Flush() {
+        FlushBarrier(false, 0);
     }
 
     /**
-     * @brief Force le flush des messages en attente
+     * @brief Flush borné dans le temps
      */
-    void AsyncLogger::Flush() {
-        FlushQueue();
-        Logger::Flush();
+    bool AsyncLogger::Flush(uint32 timeoutMs) {
+        return FlushBarrier(true, timeoutMs);
     }
 
     /**
@@ -77,24 +72,45 @@ namespace logger {
 
         m_Running = true;
         m_StopRequested = false;
-        m_WorkerThread = std::thread(&AsyncLogger::WorkerThread, this);
+        for (size_t group = 0; group < m_Groups.size(); ++group) {
+            m_Groups[group]->thread = std::thread(&AsyncLogger::WorkerThread, this, group);
+        }
     }
 
     /**
      * @brief Arrête le thread de traitement
      */
     void AsyncLogger::Stop() {
-        if (!m_Running) return;
+        EmitPendingRepeats();
 
-        m_StopRequested = true;
-        m_Condition.notify_one();
+        if (m_Running) {
+            m_StopRequested = true;
+            {
+                std::lock_guard<std::mutex> lock(m_WakeMutex);
+            }
+            m_Condition.notify_all();
 
-        if (m_WorkerThread.joinable()) {
-            m_WorkerThread.join();
+            for (auto& group : m_Groups) {
+                if (group->thread.joinable()) {
+                    group->thread.join();
+                }
+            }
         }
 
-        m_Running = false;
+        // Messages publiés pendant l'arrêt, ou logger jamais démarré
         FlushQueue();
+        FlushAllSinks();
+
+        for (size_t group = 0; group < m_Groups.size(); ++group) {
+            m_Groups[group]->flushedPosition.store(m_Queue->GetReadPosition(group), std::memory_order_release);
+        }
+
+        // Libérer les appelants de Flush en attente
+        {
+            std::lock_guard<std::mutex> lock(m_FlushMutex);
+            m_Running = false;
+        }
+        m_FlushCondition.notify_all();
     }
 
     /**
@@ -108,31 +124,32 @@ namespace logger {
      * @brief Obtient la taille actuelle de la file
      */
     size_t AsyncLogger::GetQueueSize() const {
-        std::lock_guard<std::mutex> lock(m_QueueMutex);
-        return m_MessageQueue.size();
+        // Retard du groupe le plus lent
+        return m_Queue->SizeApprox();
     }
 
     /**
      * @brief Définit la taille maximum de la file
      */
     void AsyncLogger::SetMaxQueueSize(size_t size) {
-        std::lock_guard<std::mutex> lock(m_QueueMutex);
-        m_MaxQueueSize = size;
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_Running || !m_Queue->IsEmpty()) {
+            return; // File en cours d'utilisation
+        }
+        RebuildQueue(size);
     }
 
     /**
      * @brief Obtient la taille maximum de la file
      */
     size_t AsyncLogger::GetMaxQueueSize() const {
-        std::lock_guard<std::mutex> lock(m_QueueMutex);
-        return m_MaxQueueSize;
+        return m_Queue->Capacity();
     }
 
     /**
      * @brief Définit l'intervalle de flush
      */
     void AsyncLogger::SetFlushInterval(uint32 ms) {
-        std::lock_guard<std::mutex> lock(m_QueueMutex);
         m_FlushInterval = ms;
     }
 
@@ -140,29 +157,209 @@ namespace logger {
      * @brief Obtient l'intervalle de flush
      */
     uint32 AsyncLogger::GetFlushInterval() const {
-        std::lock_guard<std::mutex> lock(m_QueueMutex);
         return m_FlushInterval;
     }
 
     /**
-     * @brief Fonction du thread de traitement
+     * @brief Définit le comportement lorsque la file est pleine
+     */
+    void AsyncLogger::SetOverflowPolicy(OverflowPolicy policy) {
+        m_OverflowPolicy = policy;
+    }
+
+    /**
+     * @brief Obtient la politique de débordement
+     */
+    OverflowPolicy AsyncLogger::GetOverflowPolicy() const {
+        return m_OverflowPolicy;
+    }
+
+    /**
+     * @brief Définit le délai d'attente maximum de la politique Block
+     */
+    void AsyncLogger::SetBlockTimeout(uint32 ms) {
+        m_BlockTimeout = ms;
+    }
+
+    /**
+     * @brief Obtient le délai d'attente de la politique Block
+     */
+    uint32 AsyncLogger::GetBlockTimeout() const {
+        return m_BlockTimeout;
+    }
+
+    /**
+     * @brief Définit le taux d'échantillonnage de la politique Sample
+     */
+    void AsyncLogger::SetSampleRate(uint32 keepOneInN) {
+        m_SampleRate = keepOneInN > 0 ? keepOneInN : 1;
+    }
+
+    /**
+     * @brief Obtient le taux d'échantillonnage
+     */
+    uint32 AsyncLogger::GetSampleRate() const {
+        return m_SampleRate;
+    }
+
+    /**
+     * @brief Ajoute un groupe de sinks avec son propre thread de traitement
+     */
+    bool AsyncLogger::AddSinkGroup(const std::vector<std::shared_ptr<ISink>>& sinks, SinkGroupPolicy policy) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_Running || !m_Queue->IsEmpty()) {
+            return false; // Le nombre de consommateurs de la file est fixé
+        }
+
+        auto group = std::make_unique<SinkGroup>();
+        group->sinks = sinks;
+        group->policy = policy;
+        group->copies.resize(DRAIN_BATCH_SIZE);
+
+        for (const auto& sink : group->sinks) {
+            if (sink && sink->GetFormatter()) {
+                sink->SetPattern(m_Formatter->GetPattern());
+            }
+        }
+
+        m_Groups.push_back(std::move(group));
+        RebuildQueue(m_Queue->Capacity());
+        return true;
+    }
+
+    /**
+     * @brief Obtient le nombre de groupes
+     */
+    size_t AsyncLogger::GetSinkGroupCount() const {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_Groups.size();
+    }
+
+    /**
+     * @brief Change la contre-pression d'un groupe
+     */
+    void AsyncLogger::SetSinkGroupPolicy(size_t group, SinkGroupPolicy policy) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (group >= m_Groups.size()) return;
+
+        m_Groups[group]->policy = policy;
+        m_Queue->SetLossy(group, policy == SinkGroupPolicy::DropWhenBehind);
+    }
+
+    /**
+     * @brief Obtient l'état d'un groupe
+     */
+    SinkGroupStats AsyncLogger::GetSinkGroupStats(size_t group) const {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        SinkGroupStats stats;
+        if (group < m_Groups.size()) {
+            stats.skipped = m_Queue->GetSkipped(group);
+            stats.pending = m_Queue->SizeApprox(group);
+        }
+        return stats;
+    }
+
+    /**
+     * @brief Recrée la file avec un consommateur par groupe
+     */
+    void AsyncLogger::RebuildQueue(size_t capacity) {
+        m_Queue = std::make_unique<BroadcastRingBuffer<LogMessage>>(capacity, m_Groups.size());
+        for (size_t group = 0; group < m_Groups.size(); ++group) {
+            m_Queue->SetLossy(group, m_Groups[group]->policy.load() == SinkGroupPolicy::DropWhenBehind);
+            m_Groups[group]->flushedPosition = 0;
+        }
+        m_FlushTarget = 0;
+    }
+
+    /**
+     * @brief Propage aussi le pattern aux sinks des groupes
+     */
+    void AsyncLogger::PublishPattern() {
+        Logger::PublishPattern();
+
+        const std::string& pattern = m_Formatter->GetPattern();
+        for (size_t group = 1; group < m_Groups.size(); ++group) {
+            for (const auto& sink : m_Groups[group]->sinks) {
+                if (sink && sink->GetFormatter()) {
+                    sink->SetPattern(pattern);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Obtient les compteurs de pertes
+     */
+    OverflowStats AsyncLogger::GetOverflowStats() const {
+        OverflowStats stats;
+        stats.dropped = m_DroppedCount.load(std::memory_order_relaxed);
+        stats.overwritten = m_OverwrittenCount.load(std::memory_order_relaxed);
+        stats.sampledOut = m_SampledOutCount.load(std::memory_order_relaxed);
+        stats.blockTimeouts = m_BlockTimeoutCount.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    /**
+     * @brief Remet les compteurs de pertes à zéro
+     */
+    void AsyncLogger::ResetOverflowStats() {
+        m_DroppedCount = 0;
+        m_OverwrittenCount = 0;
+        m_SampledOutCount = 0;
+        m_BlockTimeoutCount = 0;
+        m_Queue->ResetSkipped();
+    }
+
+    /**
+     * @brief Fonction du thread de traitement d'un groupe
      */
-    void AsyncLogger::WorkerThread() {
-        while (!m_StopRequested) {
-            std::unique_lock<std::mutex> lock(m_QueueMutex);
+    void AsyncLogger::WorkerThread(size_t group) {
+        // Des lignes ont été écrites depuis le dernier flush des sinks
+        bool pendingFlush = false;
+
+        for (;;) {
+            // Recalage de l'horloge des messages hors du chemin des appelants
+            LogClock::CalibrateIfDue();
 
-            m_Condition.wait_for(lock, std::chrono::milliseconds(m_FlushInterval), [this] {
-                return !m_MessageQueue.empty() || m_StopRequested;
-            });
+            const size_t drained = DrainBatch(group);
+            const bool barrierAhead = ServiceFlushRequest(group);
 
-            while (!m_MessageQueue.empty()) {
-                LogMessage msg = m_MessageQueue.front();
-                m_MessageQueue.pop();
-                lock.unlock();
+            if (drained > 0) {
+                pendingFlush = true;
+                continue;
+            }
 
-                ProcessMessage(msg);
+            // Barrière derrière un slot réservé mais pas encore publié
+            if (barrierAhead) {
+                std::this_thread::yield();
+                continue;
+            }
 
-                lock.lock();
+            // File vide: sortir seulement une fois tout consommé
+            if (m_StopRequested) {
+                break;
+            }
+
+            bool idle = false;
+            {
+                std::unique_lock<std::mutex> lock(m_WakeMutex);
+                m_SleepingWorkers.fetch_add(1);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                // Re-vérifier après avoir annoncé le sommeil (voir WakeWorker)
+                if (m_Queue->IsEmpty(group) && !m_StopRequested &&
+                    m_Groups[group]->flushedPosition.load() >= m_FlushTarget.load()) {
+                    idle = m_Condition.wait_for(lock, std::chrono::milliseconds(m_FlushInterval.load())) ==
+                           std::cv_status::timeout;
+                }
+
+                m_SleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+            }
+
+            // Aucun message pendant un intervalle complet: vider les tampons des sinks
+            if (idle && pendingFlush) {
+                FlushGroupSinks(group);
+                pendingFlush = false;
             }
         }
     }
@@ -170,57 +367,283 @@ namespace logger {
     /**
      * @brief Ajoute un message à la file
      */
-    bool AsyncLogger::Enqueue(const LogMessage& message) {
-        std::unique_lock<std::mutex> lock(m_QueueMutex);
+    bool AsyncLogger::Enqueue(LogMessage&& message) {
+        const OverflowPolicy policy = m_OverflowPolicy.load(std::memory_order_relaxed);
+
+        // Sous pression (file remplie aux trois quarts), ne garder qu'un message sur N
+        if (policy == OverflowPolicy::Sample &&
+            m_Queue->SizeApprox() >= m_Queue->Capacity() - m_Queue->Capacity() / 4) {
+            uint64 index = m_SampleCounter.fetch_add(1, std::memory_order_relaxed);
+            if (index % m_SampleRate.load(std::memory_order_relaxed) != 0) {
+                m_SampledOutCount.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+        }
 
-        if (m_MessageQueue.size() >= m_MaxQueueSize) {
-            return false; // File pleine
+        // Chemin rapide: une place est libre
+        if (m_Queue->TryPush(std::move(message))) {
+            WakeWorker();
+            return true;
         }
 
-        m_MessageQueue.push(message);
-        lock.unlock();
+        // File pleine: le thread de traitement doit rattraper son retard
+        WakeWorker();
+
+        switch (policy) {
+            case OverflowPolicy::Block:
+                if (EnqueueBlocking(std::move(message))) {
+                    return true;
+                }
+                m_BlockTimeoutCount.fetch_add(1, std::memory_order_relaxed);
+                break;
+
+            case OverflowPolicy::DropOldest:
+                // Évincer le plus ancien jusqu'à obtenir une place
+                while (!m_Queue->TryPush(std::move(message))) {
+                    if (m_Queue->TryDiscardOldest()) {
+                        m_OverwrittenCount.fetch_add(1, std::memory_order_relaxed);
+                    } else {
+                        std::this_thread::yield(); // Slot réservé mais pas encore publié
+                    }
+                }
+                return true;
+
+            case OverflowPolicy::DropNewest:
+            case OverflowPolicy::Sample:
+                break;
+        }
 
-        m_Condition.notify_one();
-        return true;
+        m_DroppedCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
     }
 
     /**
-     * @brief Traite un message de la file
+     * @brief Attend une place libre dans la file (politique Block)
      */
-    void AsyncLogger::ProcessMessage(const LogMessage& message) {
-        // Utiliser le logger parent pour traiter
-        std::lock_guard<std::mutex> lock(m_Mutex);
-        
-        std::string formatted;
-        if (m_Formatter) {
-            formatted = m_Formatter->Format(message);
+    bool AsyncLogger::EnqueueBlocking(LogMessage&& message) {
+        using Clock = std::chrono::steady_clock;
+        const auto deadline = Clock::now() + std::chrono::milliseconds(m_BlockTimeout.load());
+
+        for (uint32 attempt = 0; ; ++attempt) {
+            if (m_Queue->TryPush(std::move(message))) {
+                WakeWorker();
+                return true;
+            }
+
+            if (Clock::now() >= deadline) {
+                return false;
+            }
+
+            // Quelques tentatives actives, puis laisser le CPU au thread de traitement
+            if (attempt < 16) {
+                std::this_thread::yield();
+            } else {
+                SleepMicro(50);
+            }
+        }
+    }
+
+    /**
+     * @brief Réveille le thread de traitement s'il est endormi
+     */
+    void AsyncLogger::WakeWorker() {
+        // La publication du slot précède cette lecture: soit le worker voit le
+        // message lors de sa re-vérification, soit nous le voyons endormi.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_SleepingWorkers.load() > 0) {
+            {
+                std::lock_guard<std::mutex> lock(m_WakeMutex);
+            }
+            m_Condition.notify_all();
+        }
+    }
+
+    /**
+     * @brief Traite un lot de messages de la file pour un groupe
+     */
+    size_t AsyncLogger::DrainBatch(size_t group) {
+        SinkGroup& state = *m_Groups[group];
+        std::lock_guard<std::mutex> lock(state.consumerMutex);
+        if (m_Queue->IsEmpty(group)) {
+            return 0;
+        }
+
+        const bool shared = m_Queue->ConsumerCount() > 1;
+        size_t count = 0;
+
+        // Les sinks regroupent les écritures du lot (un writev par lot pour FileSink)
+        if (group == 0) {
+            BeginSinkBatch();
         } else {
-            formatted = message.message;
+            for (const auto& sink : state.sinks) {
+                if (sink) sink->BeginBatch();
+            }
         }
 
-        for (auto& sink : m_Sinks) {
-            if (sink) {
-                sink->Log(message);
+        if (state.policy.load(std::memory_order_relaxed) == SinkGroupPolicy::DropWhenBehind) {
+            // Copier le lot puis rendre les slots avant d'écrire: un sink
+            // bloqué ne retient pas la file, le groupe sera seulement dépassé
+            count = m_Queue->PopBatch(group, [&state, &count](LogMessage& message) {
+                state.copies[count++] = message;
+            }, state.copies.size());
+            for (size_t i = 0; i < count; ++i) {
+                ProcessMessage(group, state.copies[i], false);
             }
+        } else {
+            count = m_Queue->PopBatch(group, [this, group, shared](LogMessage& message) {
+                ProcessMessage(group, message, shared);
+            }, DRAIN_BATCH_SIZE);
         }
+
+        if (group == 0) {
+            EndSinkBatch();
+        } else {
+            for (const auto& sink : state.sinks) {
+                if (sink) sink->EndBatch();
+            }
+        }
+
+        return count;
     }
 
     /**
-     * @brief Vide toute la file d'attente
+     * @brief Traite un message de la file pour un groupe
      */
-    void AsyncLogger::FlushQueue() {
-        std::unique_lock<std::mutex> lock(m_QueueMutex);
+    void AsyncLogger::ProcessMessage(size_t group, LogMessage& message, bool shared) {
+        // Format différé: le coût du formatage est payé ici, hors de l'appelant.
+        // Un message lu par plusieurs groupes reste intact: copie résolue.
+        // Un sink qui garde les messages différés reçoit l'original.
+        SnapshotCell<SinkSnapshot>::Reader snapshot(m_Snapshot);
+        const std::vector<std::shared_ptr<ISink>>& sinks =
+            group == 0 ? snapshot->sinks : m_Groups[group]->sinks;
+
+        if (message.IsDeferred() && !KeepsDeferred(sinks)) {
+            if (shared) {
+                thread_local LogMessage t_Resolved;
+                t_Resolved = message;
+                t_Resolved.ResolveDeferred();
+                DispatchToSinks(sinks, *snapshot->formatter, t_Resolved);
+                return;
+            }
+            message.ResolveDeferred();
+        }
 
-        while (!m_MessageQueue.empty()) {
-            LogMessage msg = m_MessageQueue.front();
-            m_MessageQueue.pop();
-            lock.unlock();
+        DispatchToSinks(sinks, *snapshot->formatter, message);
+    }
+
+    /**
+     * @brief Vide les tampons des sinks d'un groupe
+     */
+    void AsyncLogger::FlushGroupSinks(size_t group) {
+        if (group == 0) {
+            FlushSinks();
+            return;
+        }
+        for (const auto& sink : m_Groups[group]->sinks) {
+            if (sink) sink->Flush();
+        }
+    }
+
+    /**
+     * @brief Vide les tampons des sinks de tous les groupes
+     */
+    void AsyncLogger::FlushAllSinks() {
+        for (size_t group = 0; group < m_Groups.size(); ++group) {
+            FlushGroupSinks(group);
+        }
+    }
 
-            ProcessMessage(msg);
+    /**
+     * @brief Pose une barrière de flush et attend qu'elle soit franchie
+     */
+    bool AsyncLogger::FlushBarrier(bool bounded, uint32 timeoutMs) {
+        // Résumés des répétitions supprimées, en file avant la barrière
+        EmitPendingRepeats();
+
+        if (!m_Running) {
+            // Aucun thread de traitement: l'appelant vide lui-même la file
+            FlushQueue();
+            FlushAllSinks();
+            return true;
+        }
 
-            lock.lock();
+        // La barrière: tout message déjà réservé a une position inférieure.
+        // Aucun slot n'est consommé, la barrière ne peut pas être abandonnée.
+        const size_t target = m_Queue->GetWritePosition();
+        size_t requested = m_FlushTarget.load();
+        while (requested < target && !m_FlushTarget.compare_exchange_weak(requested, target)) {
+        }
+        WakeWorker();
+
+        const auto reached = [this, target] { return !m_Running || IsFlushed(target); };
+        {
+            std::unique_lock<std::mutex> lock(m_FlushMutex);
+            if (!bounded) {
+                m_FlushCondition.wait(lock, reached);
+            } else if (!m_FlushCondition.wait_for(lock, std::chrono::milliseconds(timeoutMs), reached)) {
+                return false;
+            }
+        }
+
+        // Arrêté pendant l'attente: Stop a vidé la file, reste au plus ce
+        // qui a été publié depuis
+        if (!IsFlushed(target)) {
+            FlushQueue();
+            FlushAllSinks();
+        }
+        return true;
+    }
+
+    /**
+     * @brief Franchit la barrière de flush pour un groupe si possible
+     */
+    bool AsyncLogger::ServiceFlushRequest(size_t group) {
+        SinkGroup& state = *m_Groups[group];
+        const size_t target = m_FlushTarget.load(std::memory_order_acquire);
+        if (state.flushedPosition.load(std::memory_order_relaxed) >= target) {
+            return false;
+        }
+
+        // Appelé par le seul consommateur du groupe entre deux lots: tout ce
+        // qui précède le curseur a été écrit (ou sauté)
+        const size_t position = m_Queue->GetReadPosition(group);
+        if (position < target) {
+            return true;
+        }
+
+        FlushGroupSinks(group);
+        state.flushedPosition.store(position, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> lock(m_FlushMutex);
+        }
+        m_FlushCondition.notify_all();
+        return false;
+    }
+
+    /**
+     * @brief Indique si tous les groupes ont franchi une position
+     */
+    bool AsyncLogger::IsFlushed(size_t position) const {
+        for (const auto& group : m_Groups) {
+            if (group->flushedPosition.load(std::memory_order_acquire) < position) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Vide toute la file d'attente sur l'appelant
+     */
+    void AsyncLogger::FlushQueue() {
+        bool drained = true;
+        while (drained) {
+            drained = false;
+            for (size_t group = 0; group < m_Groups.size(); ++group) {
+                drained = DrainBatch(group) > 0 || drained;
+            }
         }
     }
 
 } // namespace logger
-} // namespace nkentseu
+} // namespace nkentseu
\ No newline at end of file
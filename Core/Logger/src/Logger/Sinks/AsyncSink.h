@@ -8,12 +8,13 @@
 #pragma once
 
 #include "Logger/Logger.h"
-#include <queue>
+#include "Logger/BroadcastRing.h"
 #include <thread>
 #include <mutex>
 #include <condition_variable>
 #include <atomic>
 #include <memory>
+#include <vector>
 
 // -----------------------------------------------------------------------------
 // NAMESPACE: nkentseu::logger
@@ -21,9 +22,82 @@
 namespace nkentseu {
     namespace logger {
 
+        // -------------------------------------------------------------------------
+        // ÉNUMÉRATION: OverflowPolicy
+        // DESCRIPTION: Comportement de AsyncLogger lorsque la file est pleine
+        // -------------------------------------------------------------------------
+        enum class OverflowPolicy : uint8 {
+            /// Attendre une place libre, au plus le délai configuré, puis abandonner
+            Block = 0,
+            
+            /// Abandonner le nouveau message (comportement historique)
+            DropNewest = 1,
+            
+            /// Écraser le message le plus ancien de la file
+            DropOldest = 2,
+            
+            /// Sous pression, ne conserver qu'un message sur N
+            Sample = 3
+        };
+
+        // -------------------------------------------------------------------------
+        // STRUCTURE: OverflowStats
+        // DESCRIPTION: Compteurs de pertes de AsyncLogger
+        // -------------------------------------------------------------------------
+        struct OverflowStats {
+            /// Nouveaux messages abandonnés (DropNewest, délai Block dépassé, Sample saturé)
+            uint64 dropped = 0;
+            
+            /// Anciens messages écrasés (DropOldest)
+            uint64 overwritten = 0;
+            
+            /// Messages écartés par l'échantillonnage (Sample)
+            uint64 sampledOut = 0;
+            
+            /// Attentes Block terminées par dépassement du délai (inclus dans dropped)
+            uint64 blockTimeouts = 0;
+            
+            /**
+             * @brief Nombre total de messages perdus
+             * @return dropped + overwritten + sampledOut
+             */
+            uint64 GetTotalLost() const { return dropped + overwritten + sampledOut; }
+        };
+
+        // -------------------------------------------------------------------------
+        // ÉNUMÉRATION: SinkGroupPolicy
+        // DESCRIPTION: Contre-pression d'un groupe de sinks de AsyncLogger
+        // -------------------------------------------------------------------------
+        enum class SinkGroupPolicy : uint8 {
+            /// Les producteurs attendent ce groupe (OverflowPolicy s'applique)
+            Block = 0,
+            
+            /// En retard d'une file complète, le groupe perd ses plus anciens
+            /// messages sans retenir les producteurs ni les autres groupes
+            DropWhenBehind = 1
+        };
+
+        // -------------------------------------------------------------------------
+        // STRUCTURE: SinkGroupStats
+        // DESCRIPTION: État d'un groupe de sinks de AsyncLogger
+        // -------------------------------------------------------------------------
+        struct SinkGroupStats {
+            /// Messages sautés pour ce groupe (DropWhenBehind, DropOldest)
+            uint64 skipped = 0;
+            
+            /// Messages en attente pour ce groupe (approximatif)
+            size_t pending = 0;
+        };
+
         // -------------------------------------------------------------------------
         // CLASSE: AsyncLogger
-        // DESCRIPTION: Logger asynchrone avec file d'attente
+        // DESCRIPTION: Logger asynchrone avec file d'attente circulaire sans verrou.
+        //              Les producteurs publient dans un BroadcastRingBuffer
+        //              préalloué; chaque groupe de sinks a son thread et son
+        //              curseur dans la file, la vide par lots et n'est réveillé
+        //              que lorsqu'il est endormi. Le groupe 0 contient les sinks
+        //              du logger (AddSink); AddSinkGroup en ajoute d'autres, dont
+        //              le formatage et les écritures se font en parallèle.
         // -------------------------------------------------------------------------
         class LOGGER_API AsyncLogger : public Logger {
             public:
@@ -49,14 +123,24 @@ namespace nkentseu {
                 // ---------------------------------------------------------------------
                 
                 /**
-                 * @brief Log asynchrone
+                 * @brief Attend que les messages mis en file avant l'appel soient écrits
+                 *
+                 * Barrière: chaque thread de traitement dépasse la position de la
+                 * file au moment de l'appel puis vide ses sinks; l'appelant
+                 * attend sans verrou ni écriture de son côté. Sans thread de
+                 * traitement, la file est vidée sur l'appelant.
                  */
-                virtual void Log(LogLevel level, const char* format, ...) override;
-                void Log(LogLevel level, const std::string& message);
+                void Flush() override;
+                
                 /**
-                 * @brief Force le flush des messages en attente
+                 * @brief Flush borné dans le temps (arrêt, rapport de crash)
+                 * @param timeoutMs Délai maximum d'attente en millisecondes
+                 * @return true si tous les groupes ont franchi la barrière à temps
+                 *
+                 * Un groupe bloqué dans une écriture ne retient l'appelant
+                 * qu'au plus timeoutMs; les messages restent en file.
                  */
-                void Flush() override;
+                bool Flush(uint32 timeoutMs);
                 
                 // ---------------------------------------------------------------------
                 // CONFIGURATION ASYNCHRONE
@@ -68,7 +152,11 @@ namespace nkentseu {
                 void Start();
                 
                 /**
-                 * @brief Arrête le thread de traitement
+                 * @brief Arrête les threads de traitement
+                 *
+                 * Au retour, tout message mis en file avant l'appel a été écrit
+                 * et les sinks ont été vidés, même si le logger n'a jamais été
+                 * démarré.
                  */
                 void Stop();
                 
@@ -86,7 +174,10 @@ namespace nkentseu {
                 
                 /**
                  * @brief Définit la taille maximum de la file
-                 * @param size Taille maximum
+                 * @param size Taille maximum (arrondie à la puissance de 2 supérieure)
+                 *
+                 * La file étant préallouée, la nouvelle taille n'est appliquée que
+                 * lorsque le thread de traitement est arrêté et la file vide.
                  */
                 void SetMaxQueueSize(size_t size);
                 
@@ -99,6 +190,9 @@ namespace nkentseu {
                 /**
                  * @brief Définit l'intervalle de flush
                  * @param ms Intervalle en millisecondes
+                 *
+                 * Après un intervalle complet sans message, les sinks sont vidés:
+                 * les lignes d'un FileSink tamponné n'attendent pas indéfiniment.
                  */
                 void SetFlushInterval(uint32 ms);
                 
@@ -107,6 +201,92 @@ namespace nkentseu {
                  * @return Intervalle en millisecondes
                  */
                 uint32 GetFlushInterval() const;
+                
+                // ---------------------------------------------------------------------
+                // POLITIQUE DE DÉBORDEMENT
+                // ---------------------------------------------------------------------
+                
+                /**
+                 * @brief Définit le comportement lorsque la file est pleine
+                 * @param policy Politique de débordement
+                 */
+                void SetOverflowPolicy(OverflowPolicy policy);
+                
+                /**
+                 * @brief Obtient la politique de débordement
+                 * @return Politique courante
+                 */
+                OverflowPolicy GetOverflowPolicy() const;
+                
+                /**
+                 * @brief Définit le délai d'attente maximum de la politique Block
+                 * @param ms Délai en millisecondes (0 = aucune attente)
+                 */
+                void SetBlockTimeout(uint32 ms);
+                
+                /**
+                 * @brief Obtient le délai d'attente de la politique Block
+                 * @return Délai en millisecondes
+                 */
+                uint32 GetBlockTimeout() const;
+                
+                /**
+                 * @brief Définit le taux d'échantillonnage de la politique Sample
+                 * @param keepOneInN Nombre N: un message sur N est conservé sous pression
+                 */
+                void SetSampleRate(uint32 keepOneInN);
+                
+                /**
+                 * @brief Obtient le taux d'échantillonnage
+                 * @return Nombre N
+                 */
+                uint32 GetSampleRate() const;
+                
+                // ---------------------------------------------------------------------
+                // GROUPES DE SINKS
+                // ---------------------------------------------------------------------
+                
+                /**
+                 * @brief Ajoute un groupe de sinks avec son propre thread de traitement
+                 * @param sinks Sinks du groupe (reçoivent le pattern du logger)
+                 * @param policy Contre-pression du groupe
+                 * @return false si le logger tourne ou si la file n'est pas vide
+                 *
+                 * Un sink lent (réseau, disque) placé dans un groupe DropWhenBehind
+                 * ne retarde plus les autres sinks: il perd des messages au lieu
+                 * de bloquer la file.
+                 */
+                bool AddSinkGroup(const std::vector<std::shared_ptr<ISink>>& sinks,
+                                  SinkGroupPolicy policy = SinkGroupPolicy::DropWhenBehind);
+                
+                /**
+                 * @brief Obtient le nombre de groupes (groupe 0 compris)
+                 */
+                size_t GetSinkGroupCount() const;
+                
+                /**
+                 * @brief Change la contre-pression d'un groupe (à tout moment)
+                 * @param group Index du groupe (0: sinks du logger, Block par défaut)
+                 * @param policy Nouvelle politique
+                 */
+                void SetSinkGroupPolicy(size_t group, SinkGroupPolicy policy);
+                
+                /**
+                 * @brief Obtient l'état d'un groupe
+                 * @param group Index du groupe
+                 */
+                SinkGroupStats GetSinkGroupStats(size_t group) const;
+                
+                /**
+                 * @brief Obtient les compteurs de pertes
+                 * @return Instantané des compteurs
+                 */
+                OverflowStats GetOverflowStats() const;
+                
+                /**
+                 * @brief Remet les compteurs de pertes à zéro
+                 */
+                void ResetOverflowStats();
 
             private:
                 // ---------------------------------------------------------------------
@@ -114,50 +294,175 @@ namespace nkentseu {
                 // ---------------------------------------------------------------------
                 
                 /**
-                 * @brief Fonction du thread de traitement
+                 * @brief Fonction du thread de traitement d'un groupe
+                 * @param group Index du groupe
                  */
-                void WorkerThread();
+                void WorkerThread(size_t group);
                 
                 /**
-                 * @brief Ajoute un message à la file d'attente
+                 * @brief Ajoute un message à la file d'attente selon la politique de débordement
                  * @param message Message à ajouter
-                 * @return true si ajouté, false si file pleine
+                 * @return true si ajouté, false si abandonné
+                 */
+                bool Enqueue(LogMessage&& message);
+                
+                /**
+                 * @brief Attend une place libre dans la file (politique Block)
+                 * @param message Message à ajouter
+                 * @return true si ajouté avant l'expiration du délai
+                 */
+                bool EnqueueBlocking(LogMessage&& message);
+                
+                /**
+                 * @brief Déplace un message construit dans la file (un seul move)
+                 * @param message Message à mettre en file
                  */
-                bool Enqueue(const LogMessage& message);
+                void SubmitMessage(LogMessage& message) override;
                 
                 /**
-                 * @brief Traite un message de la file
-                 * @param message Message à traiter
+                 * @brief Traite un message de la file pour un groupe
+                 * @param group Index du groupe
+                 * @param message Message à traiter (texte produit ici s'il est différé)
+                 * @param shared true si d'autres groupes lisent le même message
                  */
-                void ProcessMessage(const LogMessage& message);
+                void ProcessMessage(size_t group, LogMessage& message, bool shared);
                 
                 /**
-                 * @brief Vide toute la file d'attente
+                 * @brief Vide toute la file d'attente sur l'appelant (sans thread de traitement)
                  */
                 void FlushQueue();
                 
+                /**
+                 * @brief Pose une barrière de flush et attend qu'elle soit franchie
+                 * @param bounded true pour limiter l'attente à timeoutMs
+                 * @param timeoutMs Délai maximum en millisecondes
+                 * @return true si la barrière a été franchie
+                 */
+                bool FlushBarrier(bool bounded, uint32 timeoutMs);
+                
+                /**
+                 * @brief Franchit la barrière de flush pour un groupe si possible
+                 * @param group Index du groupe
+                 * @return true si la barrière est encore devant le curseur du groupe
+                 */
+                bool ServiceFlushRequest(size_t group);
+                
+                /**
+                 * @brief Indique si tous les groupes ont franchi une position
+                 * @param position Position dans la file
+                 */
+                bool IsFlushed(size_t position) const;
+                
+                /**
+                 * @brief Vide les tampons des sinks de tous les groupes
+                 */
+                void FlushAllSinks();
+                
+                /**
+                 * @brief Traite un lot de messages de la file pour un groupe
+                 * @param group Index du groupe
+                 * @return Nombre de messages traités
+                 */
+                size_t DrainBatch(size_t group);
+                
+                /**
+                 * @brief Vide les tampons des sinks d'un groupe
+                 * @param group Index du groupe
+                 */
+                void FlushGroupSinks(size_t group);
+                
+                /**
+                 * @brief Recrée la file (arrêté, file vide, sous m_Mutex)
+                 * @param capacity Capacité de la nouvelle file
+                 */
+                void RebuildQueue(size_t capacity);
+                
+                /**
+                 * @brief Propage aussi le pattern aux sinks des groupes
+                 */
+                void PublishPattern() override;
+                
+                /**
+                 * @brief Réveille le thread de traitement s'il est endormi
+                 */
+                void WakeWorker();
+                
                 // ---------------------------------------------------------------------
                 // VARIABLES MEMBRE PRIVÉES
                 // ---------------------------------------------------------------------
                 
-                /// File d'attente des messages
-                std::queue<LogMessage> m_MessageQueue;
+                /// Nombre maximum de messages traités par lot
+                static constexpr size_t DRAIN_BATCH_SIZE = 256;
+                
+                // ---------------------------------------------------------------------
+                // STRUCTURE: SinkGroup
+                // DESCRIPTION: Consommateur de la file: sinks, thread et état
+                // ---------------------------------------------------------------------
+                struct SinkGroup {
+                    /// Sinks du groupe (vide pour le groupe 0: sinks du logger)
+                    std::vector<std::shared_ptr<ISink>> sinks;
+                    
+                    /// Politique de contre-pression
+                    std::atomic<SinkGroupPolicy> policy{SinkGroupPolicy::Block};
+                    
+                    /// Thread de traitement du groupe
+                    std::thread thread;
+                    
+                    /// Sérialise les consommateurs du groupe (thread et FlushQueue)
+                    std::mutex consumerMutex;
+                    
+                    /// Copies d'un lot (DropWhenBehind: slots rendus avant les écritures)
+                    std::vector<LogMessage> copies;
+                    
+                    /// Position de la file traitée et vidée vers les sinks
+                    std::atomic<size_t> flushedPosition{0};
+                };
                 
-                /// Taille maximum de la file
-                size_t m_MaxQueueSize;
+                /// File d'attente des messages (préallouée, sans verrou côté producteur)
+                std::unique_ptr<BroadcastRingBuffer<LogMessage>> m_Queue;
+                
+                /// Groupes de sinks (index = consommateur dans m_Queue)
+                std::vector<std::unique_ptr<SinkGroup>> m_Groups;
                 
                 /// Intervalle de flush en ms
-                uint32 m_FlushInterval;
+                std::atomic<uint32> m_FlushInterval;
+                
+                /// Politique de débordement
+                std::atomic<OverflowPolicy> m_OverflowPolicy;
+                
+                /// Délai d'attente maximum de la politique Block (ms)
+                std::atomic<uint32> m_BlockTimeout;
                 
-                /// Thread de traitement
-                std::thread m_WorkerThread;
+                /// Un message sur N conservé sous pression (politique Sample)
+                std::atomic<uint32> m_SampleRate;
                 
-                /// Mutex pour la file d'attente
-                mutable std::mutex m_QueueMutex;
+                /// Compteur de messages candidats à l'échantillonnage
+                std::atomic<uint64> m_SampleCounter;
+                
+                /// Compteurs de pertes
+                std::atomic<uint64> m_DroppedCount;
+                std::atomic<uint64> m_OverwrittenCount;
+                std::atomic<uint64> m_SampledOutCount;
+                std::atomic<uint64> m_BlockTimeoutCount;
+                
+                /// Mutex associé à la condition de réveil du thread de traitement
+                std::mutex m_WakeMutex;
                 
                 /// Condition variable pour la synchronisation
                 std::condition_variable m_Condition;
                 
+                /// Threads de traitement en attente sur m_Condition
+                std::atomic<uint32> m_SleepingWorkers;
+                
+                /// Barrière de flush demandée (plus grande position demandée)
+                std::atomic<size_t> m_FlushTarget;
+                
+                /// Mutex associé à la condition de fin de flush
+                std::mutex m_FlushMutex;
+                
+                /// Signalée lorsqu'un groupe franchit la barrière ou à l'arrêt
+                std::condition_variable m_FlushCondition;
+                
                 /// Indicateur d'exécution
                 std::atomic<bool> m_Running;
                 
@@ -0,0 +1,397 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/Sinks/BinarySink.cpp
+// DESCRIPTION: Implémentation du sink binaire.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#include "Logger/Sinks/BinarySink.h"
+#include "Logger/BinaryLog.h"
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        // -------------------------------------------------------------------------
+        // IMPLÉMENTATION DE BinarySink
+        // -------------------------------------------------------------------------
+
+        /**
+         * @brief Constructeur avec chemin de fichier
+         */
+        BinarySink::BinarySink(const std::string& filename, bool truncate)
+            : m_Formatter(std::make_unique<Formatter>(Formatter::DEFAULT_PATTERN))
+            , m_Backend(std::make_unique<StreamFileBackend>())
+            , m_Filename(filename)
+            , m_Truncate(truncate)
+            , m_FlushPolicy(FlushPolicy::Buffered())
+            , m_InBatch(false)
+            , m_NextStringId(1)
+            , m_LastTimestamp(0) {
+            // Créer le répertoire parent si nécessaire
+            std::filesystem::path path(filename);
+            if (path.has_parent_path()) {
+                std::filesystem::create_directories(path.parent_path());
+            }
+
+            m_Buffer.reserve(m_FlushPolicy.bufferSize);
+            Open();
+
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            UpdateFlushTimer();
+        }
+
+        /**
+         * @brief Destructeur
+         */
+        BinarySink::~BinarySink() {
+            // Arrêter le minuteur d'abord: son travail prend le verrou du sink
+            m_FlushTimer.reset();
+            Close();
+        }
+
+        /**
+         * @brief Encode un message
+         */
+        void BinarySink::Log(const LogMessage& message) {
+            if (!IsEnabled() || !ShouldLog(message.level)) {
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (!m_Backend->IsOpen()) {
+                return;
+            }
+
+            // Pattern du logger: enregistré une fois, puis à chaque changement
+            if (m_Formatter && m_Formatter->GetPattern() != m_RecordedPattern) {
+                m_RecordedPattern = m_Formatter->GetPattern();
+                m_Buffer += static_cast<char>(binary::TAG_PATTERN);
+                binary::AppendVarint(m_Buffer, m_RecordedPattern.size());
+                m_Buffer += m_RecordedPattern;
+            }
+
+            // Chaînes définies avant l'enregistrement qui les référence
+            const uint32 loggerId = GetStringId(message.loggerName);
+            const uint32 fileId = GetStringId(message.sourceFile);
+            const uint32 functionId = GetStringId(message.functionName);
+            const uint32 threadNameId = GetThreadNameId(message);
+            const uint32 formatId = message.IsDeferred() ? GetStringId(message.deferredFormat) : 0;
+
+            const int64 delta = static_cast<int64>(message.timestamp - m_LastTimestamp);
+            m_LastTimestamp = message.timestamp;
+
+            // Message différé: format et arguments bruts, formatés au décodage
+            m_Buffer += static_cast<char>(message.IsDeferred() ? binary::TAG_DEFERRED : binary::TAG_RECORD);
+            binary::AppendVarint(m_Buffer, binary::ZigZagEncode(delta));
+            m_Buffer += static_cast<char>(message.level);
+            binary::AppendVarint(m_Buffer, loggerId);
+            binary::AppendVarint(m_Buffer, fileId);
+            binary::AppendVarint(m_Buffer, message.sourceLine);
+            binary::AppendVarint(m_Buffer, functionId);
+            binary::AppendVarint(m_Buffer, message.threadId);
+            binary::AppendVarint(m_Buffer, threadNameId);
+            if (message.IsDeferred()) {
+                binary::AppendVarint(m_Buffer, formatId);
+            }
+            binary::AppendVarint(m_Buffer, message.message.Size());
+            m_Buffer.append(message.message.Data(), message.message.Size());
+
+            // Mêmes déclencheurs que FileSink
+            const bool levelTrigger =
+                m_FlushPolicy.flushLevel != LogLevel::Off && message.level >= m_FlushPolicy.flushLevel;
+
+            if (!m_FlushPolicy.IsBuffered()) {
+                if (!m_InBatch || levelTrigger) {
+                    FlushBuffer();
+                }
+            } else {
+                // Le déclencheur temporel est tenu par le minuteur (OnFlushTimer)
+                const size_t threshold = m_FlushPolicy.flushBytes > 0 ?
+                    m_FlushPolicy.flushBytes : m_FlushPolicy.bufferSize;
+
+                if (m_Buffer.size() >= threshold || levelTrigger) {
+                    FlushBuffer();
+                }
+            }
+        }
+
+        /**
+         * @brief Force l'écriture des données en attente
+         */
+        void BinarySink::Flush() {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            FlushBuffer();
+            m_Backend->Flush();
+        }
+
+        /**
+         * @brief Début d'un lot
+         */
+        void BinarySink::BeginBatch() {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_InBatch = true;
+        }
+
+        /**
+         * @brief Fin d'un lot
+         */
+        void BinarySink::EndBatch() {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_InBatch = false;
+
+            if (!m_FlushPolicy.IsBuffered()) {
+                FlushBuffer();
+            }
+        }
+
+        /**
+         * @brief Définit le formatter (seul son pattern est enregistré)
+         */
+        void BinarySink::SetFormatter(std::unique_ptr<Formatter> formatter) {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (formatter) {
+                m_Formatter = std::move(formatter);
+            }
+        }
+
+        /**
+         * @brief Définit le pattern enregistré pour le décodeur
+         */
+        void BinarySink::SetPattern(const std::string& pattern) {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Formatter->SetPattern(pattern);
+        }
+
+        /**
+         * @brief Obtient le formatter
+         */
+        Formatter* BinarySink::GetFormatter() const {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            return m_Formatter.get();
+        }
+
+        /**
+         * @brief Obtient le pattern courant
+         */
+        std::string BinarySink::GetPattern() const {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            return m_Formatter->GetPattern();
+        }
+
+        /**
+         * @brief Ouvre le fichier
+         */
+        bool BinarySink::Open() {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            return OpenFile();
+        }
+
+        /**
+         * @brief Ferme le fichier
+         */
+        void BinarySink::Close() {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (m_Backend->IsOpen()) {
+                FlushBuffer();
+                m_Backend->Close();
+            }
+        }
+
+        /**
+         * @brief Vérifie si le fichier est ouvert
+         */
+        bool BinarySink::IsOpen() const {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            return m_Backend->IsOpen();
+        }
+
+        /**
+         * @brief Obtient le nom du fichier
+         */
+        std::string BinarySink::GetFilename() const {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            return m_Filename;
+        }
+
+        /**
+         * @brief Définit la stratégie d'écriture
+         */
+        void BinarySink::SetFlushPolicy(const FlushPolicy& policy) {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            FlushBuffer();
+            m_FlushPolicy = policy;
+            UpdateFlushTimer();
+        }
+
+        /**
+         * @brief Obtient la stratégie d'écriture
+         */
+        FlushPolicy BinarySink::GetFlushPolicy() const {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            return m_FlushPolicy;
+        }
+
+        /**
+         * @brief Remplace le backend d'écriture
+         */
+        void BinarySink::SetBackend(FileBackendType type, uint32 syncIntervalMs) {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            const bool wasOpen = m_Backend->IsOpen();
+
+            FlushBuffer();
+            m_Backend->Close();
+            m_Backend = CreateFileBackend(type, syncIntervalMs);
+
+            // Même fichier, même segment: reprendre en ajout sans nouvel en-tête
+            if (wasOpen) {
+                m_Backend->Open(m_Filename, false);
+            }
+            UpdateFlushTimer();
+        }
+
+        /**
+         * @brief Ouvre le fichier et écrit l'en-tête de segment
+         */
+        bool BinarySink::OpenFile() {
+            if (m_Backend->IsOpen()) {
+                return true;
+            }
+            if (m_Filename.empty() || !m_Backend->Open(m_Filename, m_Truncate)) {
+                return false;
+            }
+
+            // Nouveau segment: nouvelle table de chaînes
+            m_StringIds.clear();
+            m_ThreadNames.clear();
+            m_NextStringId = 1;
+            m_RecordedPattern.clear();
+            m_LastTimestamp = static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count());
+
+            m_Buffer.append(binary::MAGIC, sizeof(binary::MAGIC));
+            binary::AppendVarint(m_Buffer, m_LastTimestamp);
+            return true;
+        }
+
+        /**
+         * @brief Écrit le tampon
+         */
+        void BinarySink::FlushBuffer() {
+            if (!m_Buffer.empty() && m_Backend->IsOpen()) {
+                FileChunk chunk;
+                chunk.data = m_Buffer.data();
+                chunk.size = m_Buffer.size();
+                m_Backend->Write(&chunk, 1);
+                m_Backend->Flush();
+            }
+            m_Buffer.clear();
+        }
+
+        /**
+         * @brief Démarre ou arrête le minuteur de flush selon la stratégie
+         *
+         * La période est la plus courte du déclencheur temporel (tampon
+         * seulement) et de l'intervalle de synchronisation du backend.
+         *
+         * Comme pour FileSink, le minuteur est mis en pause, jamais détruit
+         * sous le verrou.
+         */
+        void BinarySink::UpdateFlushTimer() {
+            uint32 period = m_FlushPolicy.IsBuffered() ? m_FlushPolicy.flushIntervalMs : 0;
+            const uint32 syncInterval = m_Backend->GetSyncInterval();
+            if (syncInterval > 0 && (period == 0 || syncInterval < period)) {
+                period = syncInterval;
+            }
+
+            if (period == 0) {
+                if (m_FlushTimer) {
+                    m_FlushTimer->SetJob(nullptr, 0);
+                }
+                return;
+            }
+
+            if (!m_FlushTimer) {
+                m_FlushTimer = std::make_unique<FlushTimer>();
+            }
+            m_FlushTimer->SetJob([this] { OnFlushTimer(); }, period);
+        }
+
+        /**
+         * @brief Travail du minuteur: écrit les enregistrements en attente
+         *
+         * Sans déclencheur temporel, le tampon n'est pas touché. Le backend
+         * reçoit un Flush() à chaque passage: c'est là qu'il lance une
+         * synchronisation due (fdatasync).
+         */
+        void BinarySink::OnFlushTimer() {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (!m_Buffer.empty() && m_FlushPolicy.IsBuffered() && m_FlushPolicy.flushIntervalMs > 0) {
+                FlushBuffer();
+            } else if (m_Backend->IsOpen()) {
+                m_Backend->Flush();
+            }
+        }
+
+        /**
+         * @brief Identifiant d'une chaîne, définie au premier usage
+         */
+        uint32 BinarySink::GetStringId(const char* text) {
+            if (text == nullptr || text[0] == '\0') {
+                return 0;
+            }
+
+            auto it = m_StringIds.find(text);
+            if (it != m_StringIds.end()) {
+                return it->second;
+            }
+
+            const uint32 id = DefineString(text, std::strlen(text));
+            m_StringIds.emplace(text, id);
+            return id;
+        }
+
+        /**
+         * @brief Identifiant du nom de thread du message
+         *
+         * Le nom est copié dans chaque message: il est comparé au dernier nom
+         * connu du même thread et redéfini seulement s'il a changé.
+         */
+        uint32 BinarySink::GetThreadNameId(const LogMessage& message) {
+            if (message.threadName[0] == '\0') {
+                return 0;
+            }
+
+            auto it = m_ThreadNames.find(message.threadId);
+            if (it != m_ThreadNames.end() &&
+                std::strncmp(it->second.name, message.threadName, LogMessage::THREAD_NAME_CAPACITY) == 0) {
+                return it->second.id;
+            }
+
+            ThreadNameEntry entry;
+            std::memcpy(entry.name, message.threadName, LogMessage::THREAD_NAME_CAPACITY);
+            entry.name[LogMessage::THREAD_NAME_CAPACITY - 1] = '\0';
+            entry.id = DefineString(entry.name, std::strlen(entry.name));
+            m_ThreadNames[message.threadId] = entry;
+            return entry.id;
+        }
+
+        /**
+         * @brief Ajoute une définition de chaîne au tampon
+         */
+        uint32 BinarySink::DefineString(const char* text, size_t length) {
+            const uint32 id = m_NextStringId++;
+            m_Buffer += static_cast<char>(binary::TAG_STRING);
+            binary::AppendVarint(m_Buffer, id);
+            binary::AppendVarint(m_Buffer, length);
+            m_Buffer.append(text, length);
+            return id;
+        }
+
+    } // namespace logger
+} // namespace nkentseu
@@ -0,0 +1,247 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/Sinks/BinarySink.h
+// DESCRIPTION: Sink écrivant des enregistrements binaires compacts (voir
+//              BinaryLog.h). Aucun formatage texte à l'écriture: le décodeur
+//              LogDecode formate seulement ce qui est lu.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Logger/Sink.h"
+#include "Logger/Sinks/FileBackend.h"
+#include "Logger/Sinks/FileSink.h"
+#include "Logger/Sinks/FlushTimer.h"
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        // -------------------------------------------------------------------------
+        // CLASSE: BinarySink
+        // DESCRIPTION: Chaque message devient un enregistrement de quelques
+        //              octets plus son texte: delta de timestamp, niveau,
+        //              identifiants du logger, du fichier et de la fonction,
+        //              thread. Les chaînes sont écrites une seule fois par
+        //              segment. Le pattern du sink est enregistré dans le
+        //              fichier et sert de pattern par défaut au décodeur.
+        //              Un message à format différé garde son format (chaîne
+        //              comme les autres) et ses arguments capturés: même le
+        //              printf est laissé au décodeur.
+        // -------------------------------------------------------------------------
+        class LOGGER_API BinarySink : public ISink {
+            public:
+                // ---------------------------------------------------------------------
+                // CONSTRUCTEURS
+                // ---------------------------------------------------------------------
+
+                /**
+                 * @brief Constructeur avec chemin de fichier
+                 * @param filename Chemin du fichier
+                 * @param truncate true pour tronquer le fichier existant
+                 *
+                 * En ajout, un nouveau segment commence à la fin du fichier.
+                 * La stratégie par défaut est FlushPolicy::Buffered(): un
+                 * minuteur écrit les enregistrements en attente chaque seconde.
+                 */
+                explicit BinarySink(const std::string& filename, bool truncate = false);
+
+                /**
+                 * @brief Destructeur
+                 */
+                ~BinarySink() override;
+
+                // ---------------------------------------------------------------------
+                // IMPLÉMENTATION DE ISink
+                // ---------------------------------------------------------------------
+
+                /**
+                 * @brief Encode un message
+                 */
+                void Log(const LogMessage& message) override;
+
+                /**
+                 * @brief Force l'écriture des données en attente
+                 */
+                void Flush() override;
+
+                /**
+                 * @brief Les messages différés sont enregistrés sans être formatés
+                 */
+                bool KeepsDeferred() const override { return true; }
+
+                /**
+                 * @brief Début d'un lot: les enregistrements sont retenus jusqu'à EndBatch()
+                 */
+                void BeginBatch() override;
+
+                /**
+                 * @brief Fin d'un lot
+                 */
+                void EndBatch() override;
+
+                /**
+                 * @brief Définit le formatter (seul son pattern est enregistré)
+                 */
+                void SetFormatter(std::unique_ptr<Formatter> formatter) override;
+
+                /**
+                 * @brief Définit le pattern enregistré pour le décodeur
+                 */
+                void SetPattern(const std::string& pattern) override;
+
+                /**
+                 * @brief Obtient le formatter (porteur du pattern, jamais utilisé pour formater)
+                 */
+                Formatter* GetFormatter() const override;
+
+                /**
+                 * @brief Obtient le pattern courant
+                 */
+                std::string GetPattern() const override;
+
+                // ---------------------------------------------------------------------
+                // CONFIGURATION SPÉCIFIQUE AU FICHIER
+                // ---------------------------------------------------------------------
+
+                /**
+                 * @brief Ouvre le fichier et commence un segment (si non ouvert)
+                 * @return true si ouvert avec succès
+                 */
+                bool Open();
+
+                /**
+                 * @brief Ferme le fichier
+                 */
+                void Close();
+
+                /**
+                 * @brief Vérifie si le fichier est ouvert
+                 */
+                bool IsOpen() const;
+
+                /**
+                 * @brief Obtient le nom du fichier
+                 */
+                std::string GetFilename() const;
+
+                /**
+                 * @brief Définit la stratégie d'écriture (les données en attente sont écrites)
+                 */
+                void SetFlushPolicy(const FlushPolicy& policy);
+
+                /**
+                 * @brief Obtient la stratégie d'écriture
+                 */
+                FlushPolicy GetFlushPolicy() const;
+
+                /**
+                 * @brief Remplace le backend d'écriture (le fichier est rouvert en ajout)
+                 * @param type Type de backend
+                 * @param syncIntervalMs Délai entre deux fdatasync (backend Descriptor),
+                 *        tenu par le minuteur du sink même sans nouvel enregistrement
+                 */
+                void SetBackend(FileBackendType type, uint32 syncIntervalMs = 0);
+
+            private:
+                // ---------------------------------------------------------------------
+                // MÉTHODES PRIVÉES
+                // ---------------------------------------------------------------------
+
+                /**
+                 * @brief Ouvre le fichier et écrit l'en-tête de segment (verrou tenu)
+                 */
+                bool OpenFile();
+
+                /**
+                 * @brief Écrit le tampon (verrou tenu)
+                 */
+                void FlushBuffer();
+
+                /**
+                 * @brief Démarre ou arrête le minuteur selon la stratégie et le backend (verrou tenu)
+                 */
+                void UpdateFlushTimer();
+
+                /**
+                 * @brief Travail du minuteur: écrit les enregistrements en attente
+                 */
+                void OnFlushTimer();
+
+                /**
+                 * @brief Identifiant d'une chaîne, définie au premier usage (verrou tenu)
+                 * @param text Chaîne statique ou internée (comparée par adresse)
+                 */
+                uint32 GetStringId(const char* text);
+
+                /**
+                 * @brief Identifiant du nom de thread du message (verrou tenu)
+                 */
+                uint32 GetThreadNameId(const LogMessage& message);
+
+                /**
+                 * @brief Ajoute une définition de chaîne au tampon
+                 */
+                uint32 DefineString(const char* text, size_t length);
+
+                // ---------------------------------------------------------------------
+                // VARIABLES MEMBRE PRIVÉES
+                // ---------------------------------------------------------------------
+
+                /// Porteur du pattern (mis à jour par le logger)
+                std::unique_ptr<Formatter> m_Formatter;
+
+                /// Pattern déjà écrit dans le segment courant
+                std::string m_RecordedPattern;
+
+                /// Backend d'écriture
+                std::unique_ptr<IFileBackend> m_Backend;
+
+                /// Nom du fichier
+                std::string m_Filename;
+
+                /// Mode de la première ouverture (truncate/append)
+                bool m_Truncate;
+
+                /// Stratégie d'écriture
+                FlushPolicy m_FlushPolicy;
+
+                /// Enregistrements en attente
+                std::string m_Buffer;
+
+                /// Minuteur du déclencheur temporel et de la synchronisation
+                /// (arrêté dans le destructeur avant la fermeture du fichier)
+                std::unique_ptr<FlushTimer> m_FlushTimer;
+
+                /// Lot asynchrone en cours
+                bool m_InBatch;
+
+                /// Identifiants des chaînes du segment (clé: adresse)
+                std::unordered_map<const char*, uint32> m_StringIds;
+
+                /// Dernier nom connu de chaque thread et son identifiant
+                struct ThreadNameEntry {
+                    char name[LogMessage::THREAD_NAME_CAPACITY];
+                    uint32 id;
+                };
+                std::unordered_map<uint32, ThreadNameEntry> m_ThreadNames;
+
+                /// Prochain identifiant de chaîne (0 = chaîne vide)
+                uint32 m_NextStringId;
+
+                /// Timestamp du dernier enregistrement
+                uint64 m_LastTimestamp;
+
+                /// Mutex pour la synchronisation thread-safe
+                mutable std::mutex m_Mutex;
+        };
+
+    } // namespace logger
+} // namespace nkentseu
@@ -11,8 +11,9 @@
 #ifdef _WIN32
 #include <Windows.h>
 #else
-#include <unistd.h>    // Pour isatty(), fileno()
+#include <unistd.h>    // Pour isatty(), fileno(), write()
 #include <cstring>     // Pour strstr()
+#include <cerrno>      // Pour EINTR
 #endif
 
 // -----------------------------------------------------------------------------
@@ -31,7 +32,10 @@ namespace nkentseu {
         ConsoleSink::ConsoleSink()
             : m_Stream(ConsoleStream::StdOut)
             , m_UseColors(true)
-            , m_UseStderrForErrors(true) {
+            , m_UseStderrForErrors(true)
+            , m_Batched(false)
+            , m_InBatch(false)
+            , m_BatchTarget(ConsoleStream::StdOut) {
             m_Formatter = std::make_unique<Formatter>(Formatter::COLOR_PATTERN);
         }
         
@@ -41,7 +45,10 @@ namespace nkentseu {
         ConsoleSink::ConsoleSink(ConsoleStream stream, bool useColors)
             : m_Stream(stream)
             , m_UseColors(useColors)
-            , m_UseStderrForErrors(true) {
+            , m_UseStderrForErrors(true)
+            , m_Batched(false)
+            , m_InBatch(false)
+            , m_BatchTarget(ConsoleStream::StdOut) {
             m_Formatter = std::make_unique<Formatter>(
                 useColors ? Formatter::COLOR_PATTERN : Formatter::DEFAULT_PATTERN);
         }
@@ -63,17 +70,52 @@ namespace nkentseu {
             
             std::lock_guard<std::mutex> lock(m_Mutex);
             
-            // Formater le message
-            std::string formatted = m_Formatter->Format(message, m_UseColors && SupportsColors());
+            // Formater le message dans le tampon réutilisable
+            m_FormatBuffer.clear();
+            m_Formatter->FormatTo(message, m_UseColors && SupportsColors(), m_FormatBuffer);
+            
+            WriteLine(message.level, m_FormatBuffer);
+        }
+        
+        /**
+         * @brief Écrit une ligne déjà formatée par le logger
+         */
+        void ConsoleSink::LogFormatted(const LogMessage& message, const std::string& formatted) {
+            if (!IsEnabled() || !ShouldLog(message.level)) {
+                return;
+            }
+            
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            WriteLine(message.level, formatted);
+        }
+        
+        /**
+         * @brief Indique si les lignes doivent contenir les codes couleur
+         */
+        bool ConsoleSink::WantsColors() const {
+            return m_UseColors && SupportsColors();
+        }
+        
+        /**
+         * @brief Écrit une ligne formatée sur le flux du niveau
+         */
+        void ConsoleSink::WriteLine(LogLevel level, const std::string& formatted) {
+            if (m_Batched) {
+                AppendToBatch(level, formatted);
+                return;
+            }
             
             // Obtenir le flux approprié
-            std::ostream& stream = GetStreamForLevel(message.level);
+            std::ostream& stream = GetStreamForLevel(level);
             
-            // Écrire le message
-            stream << formatted << std::endl;
+            // Écrire le message (dans un lot, le flush attend EndBatch)
+            stream << formatted << '\n';
+            if (!m_InBatch) {
+                stream.flush();
+            }
             
             // Flush pour les niveaux critiques
-            if (message.level >= LogLevel::Error) {
+            if (level >= LogLevel::Error) {
                 stream.flush();
             }
         }
@@ -84,6 +126,8 @@ namespace nkentseu {
         void ConsoleSink::Flush() {
             std::lock_guard<std::mutex> lock(m_Mutex);
             
+            FlushBatch();
+            
             if (m_Stream == ConsoleStream::StdOut || 
                 (m_UseStderrForErrors && m_Stream == ConsoleStream::StdOut)) {
                 std::cout.flush();
@@ -95,6 +139,99 @@ namespace nkentseu {
             }
         }
         
+        /**
+         * @brief Début d'un lot
+         */
+        void ConsoleSink::BeginBatch() {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_InBatch = true;
+        }
+        
+        /**
+         * @brief Fin d'un lot
+         */
+        void ConsoleSink::EndBatch() {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_InBatch = false;
+            
+            if (m_Batched) {
+                FlushBatch();
+            } else {
+                std::cout.flush();
+                std::cerr.flush();
+            }
+        }
+        
+        /**
+         * @brief Ajoute une ligne au tampon groupé
+         *
+         * Les lignes d'un lot partent ensemble à EndBatch(); hors lot, elles
+         * attendent Flush() (fin d'image). Le tampon part aussi quand la
+         * ligne change de flux (l'ordre entre stdout et stderr est conservé),
+         * quand il dépasse MAX_BATCH_BYTES, et après une ligne Error ou plus
+         * grave.
+         */
+        void ConsoleSink::AppendToBatch(LogLevel level, const std::string& formatted) {
+            const ConsoleStream target = GetTargetForLevel(level);
+            if (!m_Batch.empty() && target != m_BatchTarget) {
+                FlushBatch();
+            }
+            
+            m_BatchTarget = target;
+            m_Batch.append(formatted);
+            m_Batch.push_back('\n');
+            
+            if (level >= LogLevel::Error || m_Batch.size() >= MAX_BATCH_BYTES) {
+                FlushBatch();
+            }
+        }
+        
+        /**
+         * @brief Écrit le tampon groupé en un appel
+         */
+        void ConsoleSink::FlushBatch() {
+            if (m_Batch.empty()) {
+                return;
+            }
+            
+            // Ce que l'application a écrit par iostream passe avant
+            std::ostream& stream = (m_BatchTarget == ConsoleStream::StdOut) ? std::cout : std::cerr;
+            stream.flush();
+            
+            WriteToConsole(m_BatchTarget, m_Batch.data(), m_Batch.size());
+            m_Batch.clear(); // La capacité est conservée d'un lot à l'autre
+        }
+        
+        /**
+         * @brief Écrit un bloc sur le descripteur d'un flux de console
+         */
+        void ConsoleSink::WriteToConsole(ConsoleStream target, const char* data, size_t size) {
+            #ifdef _WIN32
+                HANDLE handle = GetStdHandle(
+                    (target == ConsoleStream::StdOut) ? STD_OUTPUT_HANDLE : STD_ERROR_HANDLE);
+                while (size > 0 && handle != INVALID_HANDLE_VALUE) {
+                    DWORD written = 0;
+                    const DWORD chunk = size > 0x40000000 ? 0x40000000 : static_cast<DWORD>(size);
+                    if (!WriteFile(handle, data, chunk, &written, nullptr) || written == 0) {
+                        return;
+                    }
+                    data += written;
+                    size -= written;
+                }
+            #else
+                const int fd = (target == ConsoleStream::StdOut) ? STDOUT_FILENO : STDERR_FILENO;
+                while (size > 0) {
+                    const ssize_t written = ::write(fd, data, size);
+                    if (written < 0) {
+                        if (errno == EINTR) continue;
+                        return; // Console fermée: les lignes sont perdues
+                    }
+                    data += written;
+                    size -= static_cast<size_t>(written);
+                }
+            #endif
+        }
+        
         /**
          * @brief Définit le formatter pour ce sink
          */
@@ -180,18 +317,44 @@ namespace nkentseu {
             return m_UseStderrForErrors;
         }
         
+        /**
+         * @brief Active la sortie groupée
+         */
+        void ConsoleSink::SetBatchedOutput(bool enable) {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (!enable) {
+                FlushBatch();
+            }
+            m_Batched = enable;
+        }
+        
+        /**
+         * @brief Vérifie si la sortie groupée est active
+         */
+        bool ConsoleSink::IsBatchedOutput() const {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            return m_Batched;
+        }
+        
         /**
          * @brief Obtient le flux de sortie approprié pour un niveau de log
          */
         std::ostream& ConsoleSink::GetStreamForLevel(LogLevel level) {
+            return (GetTargetForLevel(level) == ConsoleStream::StdOut) ? std::cout : std::cerr;
+        }
+        
+        /**
+         * @brief Obtient le flux de console d'un niveau de log
+         */
+        ConsoleStream ConsoleSink::GetTargetForLevel(LogLevel level) const {
             if (m_UseStderrForErrors && 
                 (level == LogLevel::Error || 
                 level == LogLevel::Critical || 
                 level == LogLevel::Fatal)) {
-                return std::cerr;
+                return ConsoleStream::StdErr;
             }
             
-            return (m_Stream == ConsoleStream::StdOut) ? std::cout : std::cerr;
+            return m_Stream;
         }
         
         /**
@@ -244,15 +407,15 @@ namespace nkentseu {
         /**
          * @brief Obtient le code couleur pour un niveau de log
          */
-        std::string ConsoleSink::GetColorCode(LogLevel level) const {
-            return LogLevelToANSIColor(level);
+        const std::string& ConsoleSink::GetColorCode(LogLevel level) const {
+            return LogLevelToANSIColorCode(level);
         }
         
         /**
          * @brief Obtient le code de réinitialisation de couleur
          */
-        std::string ConsoleSink::GetResetCode() const {
-            return "\033[0m";
+        const std::string& ConsoleSink::GetResetCode() const {
+            return ANSIResetCode();
         }
         
         /**
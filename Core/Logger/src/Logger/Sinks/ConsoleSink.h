@@ -28,7 +28,15 @@ namespace nkentseu {
 
         // -------------------------------------------------------------------------
         // CLASSE: ConsoleSink
-        // DESCRIPTION: Sink pour la sortie console avec couleurs
+        // DESCRIPTION: Sink pour la sortie console avec couleurs.
+        //              Par défaut, chaque ligne part sur std::cout/std::cerr et
+        //              le flux est vidé à chaque ligne, ou une fois par lot du
+        //              logger asynchrone. En sortie groupée, les lignes
+        //              s'accumulent dans un tampon du sink et partent en un seul
+        //              write() sur le descripteur: un par lot du logger
+        //              asynchrone, ou un par image pour un appelant qui appelle
+        //              Flush() en fin d'image. Une ligne Error ou plus grave
+        //              vide le tampon aussitôt.
         // -------------------------------------------------------------------------
         class LOGGER_API ConsoleSink : public ISink {
             public:
@@ -62,11 +70,36 @@ namespace nkentseu {
                  */
                 void Log(const LogMessage& message) override;
                 
+                /**
+                 * @brief Écrit une ligne déjà formatée par le logger
+                 */
+                void LogFormatted(const LogMessage& message, const std::string& formatted) override;
+                
+                /**
+                 * @brief La console accepte les lignes formatées par le logger
+                 */
+                bool SupportsPreformatted() const override { return true; }
+                
+                /**
+                 * @brief Couleurs demandées si activées et supportées par le terminal
+                 */
+                bool WantsColors() const override;
+                
                 /**
                  * @brief Force l'écriture des données en attente
                  */
                 void Flush() override;
                 
+                /**
+                 * @brief Début d'un lot: les lignes sont retenues jusqu'à EndBatch()
+                 */
+                void BeginBatch() override;
+                
+                /**
+                 * @brief Fin d'un lot: le tampon groupé est écrit
+                 */
+                void EndBatch() override;
+                
                 /**
                  * @brief Définit le formatter pour ce sink
                  */
@@ -126,6 +159,21 @@ namespace nkentseu {
                  * @return true si activé, false sinon
                  */
                 bool IsUsingStderrForErrors() const;
+                
+                /**
+                 * @brief Active la sortie groupée (tampon du sink, un write par lot)
+                 * @param enable true pour grouper; false écrit le tampon en attente
+                 */
+                void SetBatchedOutput(bool enable);
+                
+                /**
+                 * @brief Vérifie si la sortie groupée est active
+                 * @return true si activée, false sinon
+                 */
+                bool IsBatchedOutput() const;
+                
+                /// Taille du tampon groupé au-delà de laquelle il est écrit sans attendre
+                static constexpr size_t MAX_BATCH_BYTES = 64 * 1024;
 
             private:
                 // ---------------------------------------------------------------------
@@ -139,6 +187,40 @@ namespace nkentseu {
                  */
                 std::ostream& GetStreamForLevel(LogLevel level);
                 
+                /**
+                 * @brief Obtient le flux de console d'un niveau de log
+                 * @param level Niveau de log
+                 * @return StdErr pour les erreurs si demandé, sinon le flux principal
+                 */
+                ConsoleStream GetTargetForLevel(LogLevel level) const;
+                
+                /**
+                 * @brief Ajoute une ligne au tampon groupé (verrou tenu)
+                 * @param level Niveau du message
+                 * @param formatted Ligne formatée
+                 */
+                void AppendToBatch(LogLevel level, const std::string& formatted);
+                
+                /**
+                 * @brief Écrit le tampon groupé en un appel (verrou tenu)
+                 */
+                void FlushBatch();
+                
+                /**
+                 * @brief Écrit un bloc sur le descripteur d'un flux de console
+                 * @param target Flux de console
+                 * @param data Données
+                 * @param size Taille des données
+                 */
+                static void WriteToConsole(ConsoleStream target, const char* data, size_t size);
+                
+                /**
+                 * @brief Écrit une ligne formatée sur le flux du niveau (verrou tenu)
+                 * @param level Niveau du message
+                 * @param formatted Ligne formatée
+                 */
+                void WriteLine(LogLevel level, const std::string& formatted);
+                
                 /**
                  * @brief Vérifie si la console supporte les couleurs
                  * @return true si supporté, false sinon
@@ -150,13 +232,13 @@ namespace nkentseu {
                  * @param level Niveau de log
                  * @return Code couleur ANSI
                  */
-                std::string GetColorCode(LogLevel level) const;
+                const std::string& GetColorCode(LogLevel level) const;
                 
                 /**
                  * @brief Obtient le code de réinitialisation de couleur
                  * @return Code de réinitialisation ANSI
                  */
-                std::string GetResetCode() const;
+                const std::string& GetResetCode() const;
                 
                 /**
                  * @brief Configure la couleur Windows pour un niveau de log
@@ -176,6 +258,9 @@ namespace nkentseu {
                 /// Formatter pour ce sink
                 std::unique_ptr<Formatter> m_Formatter;
                 
+                /// Tampon de formatage réutilisé d'un message à l'autre
+                std::string m_FormatBuffer;
+                
                 /// Flux de console principal
                 ConsoleStream m_Stream;
                 
@@ -185,6 +270,18 @@ namespace nkentseu {
                 /// Utiliser stderr pour les niveaux d'erreur
                 bool m_UseStderrForErrors;
                 
+                /// Sortie groupée
+                bool m_Batched;
+                
+                /// Lot asynchrone en cours (voir BeginBatch)
+                bool m_InBatch;
+                
+                /// Lignes en attente de la sortie groupée
+                std::string m_Batch;
+                
+                /// Flux de console des lignes en attente
+                ConsoleStream m_BatchTarget;
+                
                 /// Mutex pour la synchronisation thread-safe
                 mutable std::mutex m_Mutex;
         };
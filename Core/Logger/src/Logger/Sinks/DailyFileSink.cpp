@@ -6,14 +6,72 @@
 // -----------------------------------------------------------------------------
 
 #include "Logger/Sinks/DailyFileSink.h"
+#include "Logger/LogClock.h"
+#include <algorithm>
 #include <filesystem>
 #include <sstream>
 #include <iomanip>
-#include <ctime>
+#include <vector>
 
 namespace nkentseu {
 namespace logger {
 
+    namespace {
+
+        /// Nanosecondes par seconde
+        const uint64 NS_PER_SECOND = 1000000000ULL;
+
+        /**
+         * @brief Heure locale d'un instant
+         */
+        std::tm LocalTime(std::time_t time) {
+            std::tm local = {};
+            #ifdef _WIN32
+                localtime_s(&local, &time);
+            #else
+                localtime_r(&time, &local);
+            #endif
+            return local;
+        }
+
+        /**
+         * @brief Jours depuis le 1970-01-01 d'une date du calendrier grégorien
+         */
+        int64 DaysFromCivil(int64 year, int64 month, int64 day) {
+            year -= month <= 2 ? 1 : 0;
+            const int64 era = (year >= 0 ? year : year - 399) / 400;
+            const int64 yearOfEra = year - era * 400;
+            const int64 dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+            const int64 dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+            return era * 146097 + dayOfEra - 719468;
+        }
+
+        int64 DaysFromDate(const std::tm& date) {
+            return DaysFromCivil(date.tm_year + 1900, date.tm_mon + 1, date.tm_mday);
+        }
+
+        /**
+         * @brief Date (année, mois, jour) d'un nombre de jours depuis le 1970-01-01
+         */
+        std::tm DateFromDays(int64 days) {
+            days += 719468;
+            const int64 era = (days >= 0 ? days : days - 146096) / 146097;
+            const int64 dayOfEra = days - era * 146097;
+            const int64 yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+            const int64 dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+            const int64 monthIndex = (5 * dayOfYear + 2) / 153;
+            const int64 day = dayOfYear - (153 * monthIndex + 2) / 5 + 1;
+            const int64 month = monthIndex < 10 ? monthIndex + 3 : monthIndex - 9;
+
+            std::tm date = {};
+            date.tm_year = static_cast<int>(yearOfEra + era * 400 + (month <= 2 ? 1 : 0) - 1900);
+            date.tm_mon = static_cast<int>(month - 1);
+            date.tm_mday = static_cast<int>(day);
+            return date;
+        }
+
+    } // namespace
+
     /**
      * @brief Constructeur avec configuration
      */
@@ -22,28 +80,28 @@ namespace logger {
         , m_RotationHour(hour)
         , m_RotationMinute(minute)
         , m_MaxDays(maxDays)
-        , m_LastCheck(std::chrono::system_clock::now()) {
-        
-        // Initialiser la date courante
-        auto now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
-        #ifdef _WIN32
-            localtime_s(&m_CurrentDate, &now);
-        #else
-            localtime_r(&now, &m_CurrentDate);
-        #endif
+        , m_CurrentDate()
+        , m_NextRotation(0)
+        , m_RotationCount(0)
+        , m_CompressionLevel(0)
+        , m_Maintenance(std::make_unique<FileMaintenance>(true)) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        UpdateSchedule(LogClock::Now());
+
+        // Rétention appliquée dès le démarrage (sauvegardes d'exécutions passées)
+        if (m_MaxDays > 0) {
+            m_Maintenance->Post([path = GetPath(), maxDays = m_MaxDays, today = m_CurrentDate] {
+                CleanOldFiles(path, maxDays, today);
+            });
+        }
     }
 
     /**
      * @brief Destructeur
      */
     DailyFileSink::~DailyFileSink() {
-    }
-
-    /**
-     * @brief Logge un message avec vérification de rotation quotidienne
-     */
-    void DailyFileSink::Log(const LogMessage& message) {
-        FileSink::Log(message);
+        // Les sauvegardes en attente sont installées avant la fermeture
+        m_Maintenance.reset();
     }
 
     /**
@@ -53,6 +111,7 @@ namespace logger {
         std::lock_guard<std::mutex> lock(m_Mutex);
         m_RotationHour = hour;
         m_RotationMinute = minute;
+        UpdateSchedule(LogClock::Now());
     }
 
     /**
@@ -72,7 +131,7 @@ namespace logger {
     }
 
     /**
-     * @brief Définit le nombre maximum de jours à conserver
+     * @brief Définit le nombre de jours de sauvegardes conservés
      */
     void DailyFileSink::SetMaxDays(size_t maxDays) {
         std::lock_guard<std::mutex> lock(m_Mutex);
@@ -80,91 +139,185 @@ namespace logger {
     }
 
     /**
-     * @brief Obtient le nombre maximum de jours à conserver
+     * @brief Obtient le nombre de jours de sauvegardes conservés
      */
     size_t DailyFileSink::GetMaxDays() const {
         std::lock_guard<std::mutex> lock(m_Mutex);
         return m_MaxDays;
     }
 
+    /**
+     * @brief Obtient le prochain instant de rotation
+     */
+    uint64 DailyFileSink::GetNextRotation() const {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_NextRotation;
+    }
+
+    /**
+     * @brief Compresse les sauvegardes en gzip sur le thread de fond
+     */
+    void DailyFileSink::SetCompression(bool enabled, int level) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_CompressionLevel = enabled ? std::max(1, std::min(9, level)) : 0;
+    }
+
+    /**
+     * @brief Indique si les sauvegardes sont compressées
+     */
+    bool DailyFileSink::IsCompressionEnabled() const {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_CompressionLevel > 0;
+    }
+
     /**
      * @brief Force la rotation du fichier
      */
     bool DailyFileSink::Rotate() {
-        PerformRotation();
-        return true;
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return PerformRotation(LogClock::Now());
     }
 
     /**
-     * @brief Vérifie et effectue la rotation si nécessaire
-     */
-    void DailyFileSink::CheckRotation() {
-        auto now = std::chrono::system_clock::now();
-        
-        // Vérifier seulement toutes les minutes
-        if (std::chrono::duration_cast<std::chrono::minutes>(now - m_LastCheck).count() < 1) {
-            return;
-        }
-        
-        m_LastCheck = now;
-        
-        // Vérifier si changement de jour
-        auto nowTime = std::chrono::system_clock::to_time_t(now);
-        std::tm nowDate;
-        #ifdef _WIN32
-            localtime_s(&nowDate, &nowTime);
-        #else
-            localtime_r(&nowTime, &nowDate);
-        #endif
-        
-        if (nowDate.tm_year != m_CurrentDate.tm_year ||
-            nowDate.tm_mon != m_CurrentDate.tm_mon ||
-            nowDate.tm_mday != m_CurrentDate.tm_mday) {
-            
-            // Vérifier l'heure de rotation
-            if (nowDate.tm_hour >= m_RotationHour && 
-                nowDate.tm_min >= m_RotationMinute) {
-                PerformRotation();
-                m_CurrentDate = nowDate;
-            }
-        }
+     * @brief Attend la fin des travaux de fond en attente
+     */
+    void DailyFileSink::WaitForBackgroundWork() {
+        m_Maintenance->WaitIdle();
+    }
+
+    /**
+     * @brief Rotation à l'échéance quotidienne
+     *
+     * FileSink n'appelle cette méthode que pour un horodatage au-delà de
+     * l'échéance: le chemin courant d'une ligne reste une comparaison.
+     */
+    void DailyFileSink::OnRotationDeadline(uint64 timestamp) {
+        PerformRotation(timestamp);
     }
 
     /**
      * @brief Effectue la rotation quotidienne
      */
-    void DailyFileSink::PerformRotation() {
-        Close();
-        
-        // Générer le nom de fichier avec la date
-        std::string rotatedFile = GetFilenameForDate(m_CurrentDate);
-        
-        // Renommer le fichier courant
-        if (std::filesystem::exists(GetFilename())) {
-            std::filesystem::rename(GetFilename(), rotatedFile);
-        }
-        
-        // Nettoyer les anciens fichiers
-        if (m_MaxDays > 0) {
-            CleanOldFiles();
+    bool DailyFileSink::PerformRotation(uint64 timestamp) {
+        // Les lignes en attente appartiennent au fichier qui part
+        CloseFile();
+
+        const std::string& path = GetPath();
+        const std::string dated = GetFilenameForDate(path, m_CurrentDate);
+        const bool hasContent = GetTrackedSizeUnlocked() > 0;
+
+        // Un seul renommage ici, vers un nom libre; le reste sur le thread de fond
+        std::string pending;
+        std::error_code error;
+        if (hasContent) {
+            std::ostringstream oss;
+            oss << path << ".pending." << m_RotationCount++;
+            pending = oss.str();
+            std::filesystem::rename(path, pending, error);
+        }
+
+        UpdateSchedule(timestamp);
+
+        const bool install = hasContent && !error;
+        if (install || m_MaxDays > 0) {
+            m_Maintenance->Post([install, pending, dated, path, level = m_CompressionLevel,
+                                 maxDays = m_MaxDays, today = m_CurrentDate] {
+                if (install) {
+                    InstallBackup(pending, dated, level);
+                }
+                if (maxDays > 0) {
+                    CleanOldFiles(path, maxDays, today);
+                }
+            });
         }
-        
-        Open();
+
+        // En ajout: si le renommage a échoué, l'ancien contenu est conservé
+        return ReopenFile(false);
     }
 
     /**
-     * @brief Nettoie les anciens fichiers
+     * @brief Recalcule la date de période et l'échéance
+     *
+     * La période commence à l'heure de rotation: avant cette heure, la
+     * période est celle de la veille. L'échéance est l'heure de rotation du
+     * jour suivant la période, convertie une fois par mktime (changements
+     * d'heure compris).
      */
-    void DailyFileSink::CleanOldFiles() {
-        // TODO: Implémenter le nettoyage des fichiers plus anciens que maxDays
+    void DailyFileSink::UpdateSchedule(uint64 timestamp) {
+        const std::time_t now = static_cast<std::time_t>(timestamp / NS_PER_SECOND);
+        const std::tm local = LocalTime(now);
+
+        const bool beforeRotation = local.tm_hour * 60 + local.tm_min < m_RotationHour * 60 + m_RotationMinute;
+        const int64 periodDay = DaysFromDate(local) - (beforeRotation ? 1 : 0);
+        m_CurrentDate = DateFromDays(periodDay);
+
+        std::tm next = DateFromDays(periodDay + 1);
+        next.tm_hour = m_RotationHour;
+        next.tm_min = m_RotationMinute;
+        next.tm_sec = 0;
+        next.tm_isdst = -1;
+        std::time_t nextTime = std::mktime(&next);
+        if (nextTime == static_cast<std::time_t>(-1) || nextTime <= now) {
+            nextTime = now + 24 * 60 * 60; // Heure locale inexploitable: un jour plus tard
+        }
+
+        m_NextRotation = static_cast<uint64>(nextTime) * NS_PER_SECOND;
+        SetRotationDeadline(m_NextRotation);
+    }
+
+    /**
+     * @brief Installe une sauvegarde sous son nom daté
+     *
+     * Plusieurs rotations le même jour (Rotate, redémarrage) donnent
+     * .AAAAMMJJ, .AAAAMMJJ.1, ...: une sauvegarde n'en remplace jamais une autre.
+     */
+    void DailyFileSink::InstallBackup(const std::string& pending, const std::string& dated, int compressionLevel) {
+        std::error_code error;
+        std::string target = dated;
+        for (size_t suffix = 1;
+             std::filesystem::exists(target, error) || std::filesystem::exists(target + ".gz", error);
+             ++suffix) {
+            target = dated + "." + std::to_string(suffix);
+        }
+
+        if (compressionLevel > 0 && GzipCompressFile(pending, target + ".gz", compressionLevel)) {
+            std::filesystem::remove(pending, error);
+        } else {
+            // Sans compression, ou en repli: la sauvegarde reste en clair
+            std::filesystem::rename(pending, target, error);
+        }
+    }
+
+    /**
+     * @brief Supprime les sauvegardes trop anciennes
+     */
+    void DailyFileSink::CleanOldFiles(const std::string& path, size_t maxDays, const std::tm& today) {
+        const std::filesystem::path current(path);
+        const std::filesystem::path directory = current.has_parent_path() ? current.parent_path() : ".";
+        const std::string baseName = current.filename().string();
+
+        // Parcours unique, suppressions ensuite (itérateur non perturbé)
+        std::vector<std::filesystem::path> expired;
+        std::error_code error;
+        for (std::filesystem::directory_iterator it(directory, error), end; !error && it != end; it.increment(error)) {
+            std::tm date;
+            const std::string name = it->path().filename().string();
+            if (ExtractDateFromFilename(baseName, name, date) && IsDateTooOld(date, today, maxDays)) {
+                expired.push_back(it->path());
+            }
+        }
+
+        for (const std::filesystem::path& file : expired) {
+            std::filesystem::remove(file, error);
+        }
     }
 
     /**
      * @brief Génère le nom de fichier pour une date donnée
      */
-    std::string DailyFileSink::GetFilenameForDate(const std::tm& date) const {
+    std::string DailyFileSink::GetFilenameForDate(const std::string& path, const std::tm& date) {
         std::ostringstream oss;
-        oss << GetFilename() << "."
+        oss << path << "."
             << std::setfill('0') << std::setw(4) << (date.tm_year + 1900)
             << std::setw(2) << (date.tm_mon + 1)
             << std::setw(2) << date.tm_mday;
@@ -172,20 +325,46 @@ namespace logger {
     }
 
     /**
-     * @brief Extrait la date d'un nom de fichier
+     * @brief Extrait la date d'un nom de sauvegarde
      */
-    std::tm DailyFileSink::ExtractDateFromFilename(const std::string& filename) const {
-        std::tm date = {};
-        // TODO: Parser le nom de fichier
-        return date;
+    bool DailyFileSink::ExtractDateFromFilename(const std::string& baseName, const std::string& filename,
+                                                std::tm& date) {
+        const size_t start = baseName.size() + 1;
+        if (filename.size() < start + 8 ||
+            filename.compare(0, baseName.size(), baseName) != 0 || filename[baseName.size()] != '.') {
+            return false;
+        }
+
+        int value[8];
+        for (size_t i = 0; i < 8; ++i) {
+            const char c = filename[start + i];
+            if (c < '0' || c > '9') return false;
+            value[i] = c - '0';
+        }
+        // Date seule, ou suivie d'un suffixe (.1, .gz, ...)
+        if (filename.size() > start + 8 && filename[start + 8] != '.') {
+            return false;
+        }
+
+        const int year = value[0] * 1000 + value[1] * 100 + value[2] * 10 + value[3];
+        const int month = value[4] * 10 + value[5];
+        const int day = value[6] * 10 + value[7];
+        if (month < 1 || month > 12 || day < 1 || day > 31) {
+            return false;
+        }
+
+        date = std::tm();
+        date.tm_year = year - 1900;
+        date.tm_mon = month - 1;
+        date.tm_mday = day;
+        return true;
     }
 
     /**
      * @brief Vérifie si une date est plus ancienne que maxDays
      */
-    bool DailyFileSink::IsDateTooOld(const std::tm& date) const {
-        // TODO: Comparer avec la date courante
-        return false;
+    bool DailyFileSink::IsDateTooOld(const std::tm& date, const std::tm& today, size_t maxDays) {
+        return DaysFromDate(today) - DaysFromDate(date) > static_cast<int64>(maxDays);
     }
 
 } // namespace logger
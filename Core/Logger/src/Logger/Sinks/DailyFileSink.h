@@ -8,7 +8,10 @@
 #pragma once
 
 #include "Logger/Sinks/FileSink.h"
-#include <chrono>
+#include "Logger/Sinks/FileMaintenance.h"
+#include "Logger/Deflate.h"
+#include <ctime>
+#include <memory>
 
 // -----------------------------------------------------------------------------
 // NAMESPACE: nkentseu::logger
@@ -18,7 +21,18 @@ namespace nkentseu {
 
         // -------------------------------------------------------------------------
         // CLASSE: DailyFileSink
-        // DESCRIPTION: Sink avec rotation quotidienne de fichiers
+        // DESCRIPTION: Sink avec rotation quotidienne de fichiers.
+        //              Le prochain instant de rotation est précalculé en
+        //              nanosecondes: chaque ligne compare son horodatage à cette
+        //              échéance, sans lire l'horloge ni convertir en heure locale.
+        //              À l'échéance, le fichier courant devient filename.AAAAMMJJ
+        //              (date du début de la période) et la ligne part dans le
+        //              nouveau fichier.
+        //
+        //              Le thread de log ne fait qu'un renommage vers un nom
+        //              d'attente; l'installation sous le nom daté, la compression
+        //              éventuelle et la rétention (un parcours du répertoire par
+        //              rotation) se font sur un thread de FileMaintenance.
         // -------------------------------------------------------------------------
         class LOGGER_API DailyFileSink : public FileSink {
             public:
@@ -28,27 +42,18 @@ namespace nkentseu {
                 
                 /**
                  * @brief Constructeur avec configuration
-                 * @param filename Chemin du fichier (peut contenir des patterns de date)
+                 * @param filename Chemin du fichier courant
                  * @param hour Heure de rotation (0-23)
                  * @param minute Minute de rotation (0-59)
-                 * @param maxDays Nombre maximum de jours à conserver (0 = illimité)
+                 * @param maxDays Nombre de jours de sauvegardes conservés (0 = illimité)
                  */
                 DailyFileSink(const std::string& filename, int hour = 0, int minute = 0, size_t maxDays = 0);
                 
                 /**
-                 * @brief Destructeur
+                 * @brief Destructeur (termine les travaux de fond en attente)
                  */
                 ~DailyFileSink() override;
                 
-                // ---------------------------------------------------------------------
-                // IMPLÉMENTATION DE FileSink
-                // ---------------------------------------------------------------------
-                
-                /**
-                 * @brief Logge un message avec vérification de rotation quotidienne
-                 */
-                void Log(const LogMessage& message) override;
-                
                 // ---------------------------------------------------------------------
                 // CONFIGURATION DE LA ROTATION QUOTIDIENNE
                 // ---------------------------------------------------------------------
@@ -73,63 +78,117 @@ namespace nkentseu {
                 int GetRotationMinute() const;
                 
                 /**
-                 * @brief Définit le nombre maximum de jours à conserver
+                 * @brief Définit le nombre de jours de sauvegardes conservés
                  * @param maxDays Nombre de jours (0 = illimité)
+                 *
+                 * Une sauvegarde datée de plus de maxDays jours avant la
+                 * période courante est supprimée à la rotation suivante.
                  */
                 void SetMaxDays(size_t maxDays);
                 
                 /**
-                 * @brief Obtient le nombre maximum de jours à conserver
+                 * @brief Obtient le nombre de jours de sauvegardes conservés
                  * @return Nombre de jours
                  */
                 size_t GetMaxDays() const;
                 
+                /**
+                 * @brief Obtient le prochain instant de rotation
+                 * @return Nanosecondes depuis l'epoch
+                 */
+                uint64 GetNextRotation() const;
+                
+                /**
+                 * @brief Compresse les sauvegardes en gzip sur le thread de fond
+                 * @param enabled true pour compresser
+                 * @param level Niveau DEFLATE 1 à 9
+                 */
+                void SetCompression(bool enabled, int level = DeflateEncoder::DEFAULT_LEVEL);
+                
+                /**
+                 * @brief Indique si les sauvegardes sont compressées
+                 */
+                bool IsCompressionEnabled() const;
+                
                 /**
                  * @brief Force la rotation du fichier
-                 * @return true si rotation réussie, false sinon
+                 * @return true si le nouveau fichier est ouvert, false sinon
                  */
                 bool Rotate();
-
+                
+                /**
+                 * @brief Attend la fin des travaux de fond en attente
+                 */
+                void WaitForBackgroundWork();
+                
             private:
                 // ---------------------------------------------------------------------
                 // MÉTHODES PRIVÉES
                 // ---------------------------------------------------------------------
                 
                 /**
-                 * @brief Vérifie et effectue la rotation si nécessaire
+                 * @brief Rotation à l'échéance quotidienne (verrou tenu)
+                 */
+                void OnRotationDeadline(uint64 timestamp) override;
+                
+                /**
+                 * @brief Effectue la rotation quotidienne (verrou tenu)
+                 * @param timestamp Instant de la rotation (ns depuis l'epoch)
+                 * @return true si le nouveau fichier est ouvert
+                 */
+                bool PerformRotation(uint64 timestamp);
+                
+                /**
+                 * @brief Recalcule la date de période et l'échéance (verrou tenu)
+                 * @param timestamp Instant de référence (ns depuis l'epoch)
                  */
-                void CheckRotation() override;
+                void UpdateSchedule(uint64 timestamp);
                 
                 /**
-                 * @brief Effectue la rotation quotidienne
+                 * @brief Installe une sauvegarde sous son nom daté (thread de fond)
+                 * @param pending Fichier tourné
+                 * @param dated Nom daté (suffixé .1, .2, ... s'il est déjà pris)
+                 * @param compressionLevel Niveau gzip (0: sans compression)
                  */
-                void PerformRotation();
+                static void InstallBackup(const std::string& pending, const std::string& dated, int compressionLevel);
                 
                 /**
-                 * @brief Nettoie les anciens fichiers
+                 * @brief Supprime les sauvegardes trop anciennes (thread de fond)
+                 * @param path Fichier courant (ses sauvegardes sont à côté)
+                 * @param maxDays Nombre de jours conservés
+                 * @param today Date de la période courante
+                 *
+                 * Un seul parcours du répertoire.
                  */
-                void CleanOldFiles();
+                static void CleanOldFiles(const std::string& path, size_t maxDays, const std::tm& today);
                 
                 /**
                  * @brief Génère le nom de fichier pour une date donnée
+                 * @param path Fichier courant
                  * @param date Date
                  * @return Nom de fichier
                  */
-                std::string GetFilenameForDate(const std::tm& date) const;
+                static std::string GetFilenameForDate(const std::string& path, const std::tm& date);
                 
                 /**
-                 * @brief Extrait la date d'un nom de fichier
-                 * @param filename Nom de fichier
-                 * @return Structure tm avec la date
+                 * @brief Extrait la date d'un nom de sauvegarde
+                 * @param baseName Nom du fichier courant (sans répertoire)
+                 * @param filename Nom à analyser (sans répertoire)
+                 * @param date Reçoit la date (année, mois, jour)
+                 * @return true si filename est baseName.AAAAMMJJ, suivi ou non
+                 *         d'un suffixe (.1, .gz, ...)
                  */
-                std::tm ExtractDateFromFilename(const std::string& filename) const;
+                static bool ExtractDateFromFilename(const std::string& baseName, const std::string& filename,
+                                                    std::tm& date);
                 
                 /**
                  * @brief Vérifie si une date est plus ancienne que maxDays
                  * @param date Date à vérifier
+                 * @param today Date de la période courante
+                 * @param maxDays Nombre de jours conservés
                  * @return true si trop ancienne, false sinon
                  */
-                bool IsDateTooOld(const std::tm& date) const;
+                static bool IsDateTooOld(const std::tm& date, const std::tm& today, size_t maxDays);
                 
                 // ---------------------------------------------------------------------
                 // VARIABLES MEMBRE PRIVÉES
@@ -141,15 +200,24 @@ namespace nkentseu {
                 /// Minute de rotation (0-59)
                 int m_RotationMinute;
                 
-                /// Nombre maximum de jours à conserver
+                /// Nombre de jours de sauvegardes conservés
                 size_t m_MaxDays;
                 
-                /// Date du fichier courant
+                /// Date de début de la période du fichier courant
                 std::tm m_CurrentDate;
                 
-                /// Dernière vérification de rotation
-                std::chrono::system_clock::time_point m_LastCheck;
+                /// Prochain instant de rotation (ns depuis l'epoch)
+                uint64 m_NextRotation;
+                
+                /// Rotations confiées au thread de fond (noms d'attente uniques)
+                uint64 m_RotationCount;
+                
+                /// Niveau de compression des sauvegardes (0: sans compression)
+                int m_CompressionLevel;
+                
+                /// Thread de fond (installation, compression, rétention)
+                std::unique_ptr<FileMaintenance> m_Maintenance;
         };
 
     } // namespace logger
-} // namespace nkentseu
\ No newline at end of file
+} // namespace nkentseu
@@ -6,7 +6,9 @@
 // -----------------------------------------------------------------------------
 
 #include "Logger/Sinks/DistributingSink.h"
+#include <Nkentseu/Sleep.h>
 #include <algorithm>
+#include <chrono>
 
 namespace nkentseu {
 namespace logger {
@@ -14,20 +16,31 @@ namespace logger {
     /**
      * @brief Constructeur par défaut
      */
-    DistributingSink::DistributingSink() {
+    DistributingSink::DistributingSink()
+        : m_QueueCapacity(DEFAULT_QUEUE_CAPACITY) {
     }
 
     /**
      * @brief Constructeur avec liste initiale de sinks
      */
     DistributingSink::DistributingSink(const std::vector<std::shared_ptr<ISink>>& sinks)
-        : m_Sinks(sinks) {
+        : m_QueueCapacity(DEFAULT_QUEUE_CAPACITY) {
+        m_Children.Update([&sinks](SubSinkList& list) {
+            for (const auto& sink : sinks) {
+                if (sink) {
+                    auto child = std::make_shared<SubSink>();
+                    child->sink = sink;
+                    list.sinks.push_back(std::move(child));
+                }
+            }
+        });
     }
 
     /**
-     * @brief Destructeur
+     * @brief Destructeur (vide les files du mode parallèle)
      */
     DistributingSink::~DistributingSink() {
+        SetParallel(false);
     }
 
     /**
@@ -38,23 +51,59 @@ namespace logger {
             return;
         }
 
-        std::lock_guard<std::mutex> lock(m_Mutex);
-        for (auto& sink : m_Sinks) {
-            if (sink) {
-                sink->Log(message);
+        SnapshotCell<SubSinkList>::Reader children(m_Children);
+        if (children->parallel) {
+            for (const auto& child : children->sinks) {
+                Enqueue(*child, message);
+            }
+        } else {
+            for (const auto& child : children->sinks) {
+                Deliver(*child, message);
             }
         }
     }
 
     /**
      * @brief Force le flush de tous les sous-sinks
+     *
+     * En mode parallèle, attend d'abord que chaque file ait traité les
+     * messages déjà distribués.
      */
     void DistributingSink::Flush() {
-        std::lock_guard<std::mutex> lock(m_Mutex);
-        for (auto& sink : m_Sinks) {
-            if (sink) {
-                sink->Flush();
+        SnapshotCell<SubSinkList>::Reader children(m_Children);
+        for (const auto& child : children->sinks) {
+            if (children->parallel) {
+                WaitForQueue(*child);
             }
+            child->sink->Flush();
+        }
+    }
+
+    /**
+     * @brief Transmet le début de lot à tous les sous-sinks
+     *
+     * En mode parallèle, chaque thread de sous-sink délimite ses propres lots.
+     */
+    void DistributingSink::BeginBatch() {
+        SnapshotCell<SubSinkList>::Reader children(m_Children);
+        if (children->parallel) {
+            return;
+        }
+        for (const auto& child : children->sinks) {
+            child->sink->BeginBatch();
+        }
+    }
+
+    /**
+     * @brief Transmet la fin de lot à tous les sous-sinks
+     */
+    void DistributingSink::EndBatch() {
+        SnapshotCell<SubSinkList>::Reader children(m_Children);
+        if (children->parallel) {
+            return;
+        }
+        for (const auto& child : children->sinks) {
+            child->sink->EndBatch();
         }
     }
 
@@ -62,13 +111,13 @@ namespace logger {
      * @brief Définit le formatter pour tous les sous-sinks
      */
     void DistributingSink::SetFormatter(std::unique_ptr<Formatter> formatter) {
-        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (!formatter) return;
+
+        SnapshotCell<SubSinkList>::Reader children(m_Children);
         // Clone le formatter pour chaque sink
-        for (auto& sink : m_Sinks) {
-            if (sink && formatter) {
-                auto clonedFormatter = std::make_unique<Formatter>(formatter->GetPattern());
-                sink->SetFormatter(std::move(clonedFormatter));
-            }
+        for (const auto& child : children->sinks) {
+            auto clonedFormatter = std::make_unique<Formatter>(formatter->GetPattern());
+            child->sink->SetFormatter(std::move(clonedFormatter));
         }
     }
 
@@ -76,11 +125,9 @@ namespace logger {
      * @brief Définit le pattern de formatage pour tous les sous-sinks
      */
     void DistributingSink::SetPattern(const std::string& pattern) {
-        std::lock_guard<std::mutex> lock(m_Mutex);
-        for (auto& sink : m_Sinks) {
-            if (sink) {
-                sink->SetPattern(pattern);
-            }
+        SnapshotCell<SubSinkList>::Reader children(m_Children);
+        for (const auto& child : children->sinks) {
+            child->sink->SetPattern(pattern);
         }
     }
 
@@ -88,9 +135,9 @@ namespace logger {
      * @brief Obtient le formatter (du premier sink)
      */
     Formatter* DistributingSink::GetFormatter() const {
-        std::lock_guard<std::mutex> lock(m_Mutex);
-        if (!m_Sinks.empty() && m_Sinks[0]) {
-            return m_Sinks[0]->GetFormatter();
+        SnapshotCell<SubSinkList>::Reader children(m_Children);
+        if (!children->sinks.empty()) {
+            return children->sinks[0]->sink->GetFormatter();
         }
         return nullptr;
     }
@@ -99,9 +146,9 @@ namespace logger {
      * @brief Obtient le pattern (du premier sink)
      */
     std::string DistributingSink::GetPattern() const {
-        std::lock_guard<std::mutex> lock(m_Mutex);
-        if (!m_Sinks.empty() && m_Sinks[0]) {
-            return m_Sinks[0]->GetPattern();
+        SnapshotCell<SubSinkList>::Reader children(m_Children);
+        if (!children->sinks.empty()) {
+            return children->sinks[0]->sink->GetPattern();
         }
         return "";
     }
@@ -112,8 +159,23 @@ namespace logger {
     void DistributingSink::AddSink(std::shared_ptr<ISink> sink) {
         if (!sink) return;
         
-        std::lock_guard<std::mutex> lock(m_Mutex);
-        m_Sinks.push_back(sink);
+        std::lock_guard<std::mutex> lock(m_ConfigMutex);
+        auto child = std::make_shared<SubSink>();
+        child->sink = std::move(sink);
+
+        // Le thread existe avant que Log puisse remplir la file
+        bool parallel = false;
+        {
+            SnapshotCell<SubSinkList>::Reader children(m_Children);
+            parallel = children->parallel;
+        }
+        if (parallel) {
+            StartWorker(*child, m_QueueCapacity);
+        }
+
+        m_Children.Update([&child](SubSinkList& list) {
+            list.sinks.push_back(child);
+        });
     }
 
     /**
@@ -122,10 +184,20 @@ namespace logger {
     void DistributingSink::RemoveSink(std::shared_ptr<ISink> sink) {
         if (!sink) return;
         
-        std::lock_guard<std::mutex> lock(m_Mutex);
-        auto it = std::find(m_Sinks.begin(), m_Sinks.end(), sink);
-        if (it != m_Sinks.end()) {
-            m_Sinks.erase(it);
+        std::lock_guard<std::mutex> lock(m_ConfigMutex);
+        std::shared_ptr<SubSink> removed;
+        m_Children.Update([&sink, &removed](SubSinkList& list) {
+            auto it = std::find_if(list.sinks.begin(), list.sinks.end(),
+                                   [&sink](const std::shared_ptr<SubSink>& child) { return child->sink == sink; });
+            if (it != list.sinks.end()) {
+                removed = *it;
+                list.sinks.erase(it);
+            }
+        });
+
+        // Plus aucun Log ne distribue vers ce sous-sink: vider sa file
+        if (removed) {
+            StopWorker(*removed);
         }
     }
 
@@ -133,32 +205,273 @@ namespace logger {
      * @brief Supprime tous les sous-sinks
      */
     void DistributingSink::ClearSinks() {
-        std::lock_guard<std::mutex> lock(m_Mutex);
-        m_Sinks.clear();
+        std::lock_guard<std::mutex> lock(m_ConfigMutex);
+        std::vector<std::shared_ptr<SubSink>> removed;
+        m_Children.Update([&removed](SubSinkList& list) {
+            removed.swap(list.sinks);
+        });
+
+        for (const auto& child : removed) {
+            StopWorker(*child);
+        }
     }
 
     /**
      * @brief Obtient la liste des sous-sinks
      */
     std::vector<std::shared_ptr<ISink>> DistributingSink::GetSinks() const {
-        std::lock_guard<std::mutex> lock(m_Mutex);
-        return m_Sinks;
+        SnapshotCell<SubSinkList>::Reader children(m_Children);
+        std::vector<std::shared_ptr<ISink>> sinks;
+        sinks.reserve(children->sinks.size());
+        for (const auto& child : children->sinks) {
+            sinks.push_back(child->sink);
+        }
+        return sinks;
     }
 
     /**
      * @brief Obtient le nombre de sous-sinks
      */
     size_t DistributingSink::GetSinkCount() const {
-        std::lock_guard<std::mutex> lock(m_Mutex);
-        return m_Sinks.size();
+        SnapshotCell<SubSinkList>::Reader children(m_Children);
+        return children->sinks.size();
     }
 
     /**
      * @brief Vérifie si un sink spécifique est présent
      */
     bool DistributingSink::ContainsSink(std::shared_ptr<ISink> sink) const {
-        std::lock_guard<std::mutex> lock(m_Mutex);
-        return std::find(m_Sinks.begin(), m_Sinks.end(), sink) != m_Sinks.end();
+        SnapshotCell<SubSinkList>::Reader children(m_Children);
+        return std::any_of(children->sinks.begin(), children->sinks.end(),
+                           [&sink](const std::shared_ptr<SubSink>& child) { return child->sink == sink; });
+    }
+
+    /**
+     * @brief Active ou désactive la distribution parallèle
+     */
+    void DistributingSink::SetParallel(bool enabled, size_t queueCapacity) {
+        std::lock_guard<std::mutex> lock(m_ConfigMutex);
+        m_QueueCapacity = queueCapacity;
+
+        std::vector<std::shared_ptr<SubSink>> children;
+        {
+            SnapshotCell<SubSinkList>::Reader snapshot(m_Children);
+            if (snapshot->parallel == enabled) {
+                return;
+            }
+            children = snapshot->sinks;
+        }
+
+        if (enabled) {
+            // Threads prêts avant la publication du mode parallèle
+            for (const auto& child : children) {
+                StartWorker(*child, m_QueueCapacity);
+            }
+            m_Children.Update([](SubSinkList& list) { list.parallel = true; });
+        } else {
+            // Update attend les Log en cours: les files ne reçoivent plus rien
+            m_Children.Update([](SubSinkList& list) { list.parallel = false; });
+            for (const auto& child : children) {
+                StopWorker(*child);
+            }
+        }
+    }
+
+    /**
+     * @brief Indique si la distribution est parallèle
+     */
+    bool DistributingSink::IsParallel() const {
+        SnapshotCell<SubSinkList>::Reader children(m_Children);
+        return children->parallel;
+    }
+
+    /**
+     * @brief Définit le comportement lorsque la file d'un sous-sink est pleine
+     */
+    void DistributingSink::SetSinkPolicy(const std::shared_ptr<ISink>& sink, SinkGroupPolicy policy) {
+        SnapshotCell<SubSinkList>::Reader children(m_Children);
+        for (const auto& child : children->sinks) {
+            if (child->sink == sink) {
+                child->policy.store(policy, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Obtient les compteurs de chaque sous-sink
+     */
+    std::vector<SubSinkStats> DistributingSink::GetSinkStats() const {
+        SnapshotCell<SubSinkList>::Reader children(m_Children);
+        std::vector<SubSinkStats> stats;
+        stats.reserve(children->sinks.size());
+        for (const auto& child : children->sinks) {
+            SubSinkStats entry;
+            entry.sink = child->sink;
+            entry.messages = child->messages.load(std::memory_order_relaxed);
+            entry.dropped = child->dropped.load(std::memory_order_relaxed);
+            entry.totalLatency = child->totalLatency.load(std::memory_order_relaxed);
+            entry.maxLatency = child->maxLatency.load(std::memory_order_relaxed);
+            entry.pending = children->parallel ? child->queue->SizeApprox() : 0;
+            stats.push_back(std::move(entry));
+        }
+        return stats;
+    }
+
+    /**
+     * @brief Appelle Log du sous-sink et met à jour ses compteurs
+     */
+    void DistributingSink::Deliver(SubSink& child, const LogMessage& message) {
+        const auto start = std::chrono::steady_clock::now();
+        child.sink->Log(message);
+        const uint64 elapsed = static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count());
+
+        child.messages.fetch_add(1, std::memory_order_relaxed);
+        child.totalLatency.fetch_add(elapsed, std::memory_order_relaxed);
+        uint64 longest = child.maxLatency.load(std::memory_order_relaxed);
+        while (elapsed > longest &&
+               !child.maxLatency.compare_exchange_weak(longest, elapsed, std::memory_order_relaxed)) {
+        }
+    }
+
+    /**
+     * @brief Copie un message dans la file d'un sous-sink
+     */
+    void DistributingSink::Enqueue(SubSink& child, const LogMessage& message) {
+        // Compté avant la réservation du slot: la barrière de Flush couvre
+        // tout message placé devant ceux du thread qui la pose
+        child.pushed.fetch_add(1, std::memory_order_seq_cst);
+
+        if (child.queue->TryPush(message)) {
+            WakeWorker(child);
+            return;
+        }
+
+        // File pleine: le thread du sous-sink doit rattraper son retard
+        WakeWorker(child);
+
+        if (child.policy.load(std::memory_order_relaxed) == SinkGroupPolicy::DropWhenBehind) {
+            // Évincer le plus ancien jusqu'à obtenir une place
+            while (!child.queue->TryPush(message)) {
+                if (child.queue->TryDiscardOldest()) {
+                    child.dropped.fetch_add(1, std::memory_order_relaxed);
+                    child.completed.fetch_add(1, std::memory_order_release);
+                } else {
+                    std::this_thread::yield(); // Slot réservé mais pas encore publié
+                }
+            }
+            WakeWorker(child);
+            return;
+        }
+
+        // Block: attendre ce sous-sink seulement
+        for (uint32 attempt = 0; !child.queue->TryPush(message); ++attempt) {
+            if (attempt < 16) {
+                std::this_thread::yield();
+            } else {
+                SleepMicro(50);
+            }
+        }
+        WakeWorker(child);
+    }
+
+    /**
+     * @brief Attend que les messages déjà confiés au sous-sink soient traités
+     */
+    void DistributingSink::WaitForQueue(SubSink& child) {
+        const uint64 target = child.pushed.load(std::memory_order_seq_cst);
+        for (uint32 attempt = 0; child.completed.load(std::memory_order_acquire) < target; ++attempt) {
+            WakeWorker(child);
+            if (attempt < 16) {
+                std::this_thread::yield();
+            } else {
+                SleepMicro(50);
+            }
+        }
+    }
+
+    /**
+     * @brief Réveille le thread du sous-sink s'il est endormi
+     */
+    void DistributingSink::WakeWorker(SubSink& child) {
+        // Même protocole que AsyncLogger::WakeWorker: la publication du slot
+        // précède cette lecture, le thread la voit ou nous le voyons endormi
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (child.sleeping.load()) {
+            {
+                std::lock_guard<std::mutex> lock(child.wakeMutex);
+            }
+            child.condition.notify_one();
+        }
+    }
+
+    /**
+     * @brief Crée la file et démarre le thread d'un sous-sink
+     */
+    void DistributingSink::StartWorker(SubSink& child, size_t queueCapacity) {
+        child.queue = std::make_unique<MPSCRingBuffer<LogMessage>>(queueCapacity);
+        child.stopRequested.store(false);
+        child.thread = std::thread(&DistributingSink::WorkerLoop, std::ref(child));
+    }
+
+    /**
+     * @brief Vide la file puis arrête le thread d'un sous-sink
+     */
+    void DistributingSink::StopWorker(SubSink& child) {
+        if (!child.thread.joinable()) {
+            return;
+        }
+
+        child.stopRequested.store(true);
+        {
+            std::lock_guard<std::mutex> lock(child.wakeMutex);
+        }
+        child.condition.notify_one();
+        child.thread.join();
+        child.queue.reset();
+    }
+
+    /**
+     * @brief Boucle du thread d'un sous-sink
+     */
+    void DistributingSink::WorkerLoop(SubSink& child) {
+        // Slots rendus avant les écritures: un Log lent ne retient jamais
+        // un producteur qui évince (DropWhenBehind)
+        std::vector<LogMessage> batch;
+        batch.reserve(DRAIN_BATCH_SIZE);
+
+        for (;;) {
+            batch.clear();
+            child.queue->PopBatch([&batch](LogMessage& message) {
+                batch.push_back(std::move(message));
+            }, DRAIN_BATCH_SIZE);
+
+            if (!batch.empty()) {
+                child.sink->BeginBatch();
+                for (const LogMessage& message : batch) {
+                    Deliver(child, message);
+                    child.completed.fetch_add(1, std::memory_order_release);
+                }
+                child.sink->EndBatch();
+                continue;
+            }
+
+            // Arrêt demandé après le dernier Log: la file vide l'est définitivement
+            if (child.stopRequested.load() && child.queue->IsEmpty()) {
+                break;
+            }
+
+            std::unique_lock<std::mutex> lock(child.wakeMutex);
+            child.sleeping.store(true);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            // Re-vérifier après avoir annoncé le sommeil (voir WakeWorker)
+            if (child.queue->IsEmpty() && !child.stopRequested.load()) {
+                child.condition.wait(lock);
+            }
+
+            child.sleeping.store(false, std::memory_order_relaxed);
+        }
     }
 
 } // namespace logger
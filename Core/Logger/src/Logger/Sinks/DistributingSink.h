@@ -8,9 +8,15 @@
 #pragma once
 
 #include "Logger/Sink.h"
+#include "Logger/Sinks/AsyncSink.h"
+#include "Logger/RingBuffer.h"
+#include "Logger/Snapshot.h"
 #include <vector>
 #include <memory>
 #include <mutex>
+#include <thread>
+#include <atomic>
+#include <condition_variable>
 
 // -----------------------------------------------------------------------------
 // NAMESPACE: nkentseu::logger
@@ -18,9 +24,47 @@
 namespace nkentseu {
     namespace logger {
 
+        // -------------------------------------------------------------------------
+        // STRUCTURE: SubSinkStats
+        // DESCRIPTION: Compteurs d'un sous-sink de DistributingSink
+        // -------------------------------------------------------------------------
+        struct SubSinkStats {
+            /// Sous-sink concerné
+            std::shared_ptr<ISink> sink;
+            
+            /// Messages transmis au sous-sink
+            uint64 messages = 0;
+            
+            /// Messages perdus (mode parallèle, DropWhenBehind)
+            uint64 dropped = 0;
+            
+            /// Temps cumulé passé dans Log du sous-sink (ns)
+            uint64 totalLatency = 0;
+            
+            /// Plus long appel à Log du sous-sink (ns)
+            uint64 maxLatency = 0;
+            
+            /// Messages en attente dans la file du sous-sink (approximatif)
+            size_t pending = 0;
+            
+            /**
+             * @brief Durée moyenne d'un appel à Log du sous-sink
+             * @return Nanosecondes (0 si aucun message)
+             */
+            uint64 GetAverageLatency() const { return messages > 0 ? totalLatency / messages : 0; }
+        };
+
         // -------------------------------------------------------------------------
         // CLASSE: DistributingSink
-        // DESCRIPTION: Sink qui distribue les messages à plusieurs sous-sinks
+        // DESCRIPTION: Sink qui distribue les messages à plusieurs sous-sinks.
+        //              La liste des sous-sinks est un instantané immuable
+        //              (SnapshotCell): Log la lit sans verrou et plusieurs
+        //              threads peuvent distribuer en même temps.
+        //
+        //              En mode parallèle, chaque sous-sink a sa file et son
+        //              thread: Log ne fait que copier le message dans chaque
+        //              file, et un sous-sink lent ne retarde les autres qu'une
+        //              fois sa file pleine (Block) ou jamais (DropWhenBehind).
         // -------------------------------------------------------------------------
         class LOGGER_API DistributingSink : public ISink {
             public:
@@ -58,6 +102,16 @@ namespace nkentseu {
                  */
                 void Flush() override;
                 
+                /**
+                 * @brief Transmet le début de lot à tous les sous-sinks
+                 */
+                void BeginBatch() override;
+                
+                /**
+                 * @brief Transmet la fin de lot à tous les sous-sinks
+                 */
+                void EndBatch() override;
+                
                 /**
                  * @brief Définit le formatter pour tous les sous-sinks
                  */
@@ -117,17 +171,149 @@ namespace nkentseu {
                  * @return true si présent, false sinon
                  */
                 bool ContainsSink(std::shared_ptr<ISink> sink) const;
+                
+                // ---------------------------------------------------------------------
+                // DISTRIBUTION PARALLÈLE
+                // ---------------------------------------------------------------------
+                
+                /// Capacité par défaut de la file d'un sous-sink (puissance de 2)
+                static constexpr size_t DEFAULT_QUEUE_CAPACITY = 8192;
+                
+                /**
+                 * @brief Active ou désactive la distribution parallèle
+                 * @param enabled true pour une file et un thread par sous-sink
+                 * @param queueCapacity Capacité de chaque file
+                 *
+                 * La désactivation attend que les files soient vidées.
+                 */
+                void SetParallel(bool enabled, size_t queueCapacity = DEFAULT_QUEUE_CAPACITY);
+                
+                /**
+                 * @brief Indique si la distribution est parallèle
+                 */
+                bool IsParallel() const;
+                
+                /**
+                 * @brief Définit le comportement lorsque la file d'un sous-sink est pleine
+                 * @param sink Sous-sink concerné
+                 * @param policy Block: Log attend une place; DropWhenBehind: le
+                 *        plus ancien message de la file est perdu
+                 */
+                void SetSinkPolicy(const std::shared_ptr<ISink>& sink, SinkGroupPolicy policy);
+                
+                /**
+                 * @brief Obtient les compteurs de chaque sous-sink
+                 * @return Un élément par sous-sink, dans l'ordre de la liste
+                 */
+                std::vector<SubSinkStats> GetSinkStats() const;
 
             private:
+                // ---------------------------------------------------------------------
+                // TYPES PRIVÉS
+                // ---------------------------------------------------------------------
+                
+                /// Messages traités par un thread de sous-sink entre deux vérifications
+                static constexpr size_t DRAIN_BATCH_SIZE = 256;
+                
+                // ---------------------------------------------------------------------
+                // STRUCTURE: SubSink
+                // DESCRIPTION: Sous-sink, ses compteurs et sa file (mode parallèle)
+                // ---------------------------------------------------------------------
+                struct SubSink {
+                    /// Sink destinataire
+                    std::shared_ptr<ISink> sink;
+                    
+                    /// Politique lorsque la file est pleine
+                    std::atomic<SinkGroupPolicy> policy{SinkGroupPolicy::Block};
+                    
+                    /// Compteurs (voir SubSinkStats)
+                    std::atomic<uint64> messages{0};
+                    std::atomic<uint64> dropped{0};
+                    std::atomic<uint64> totalLatency{0};
+                    std::atomic<uint64> maxLatency{0};
+                    
+                    /// File des messages à traiter (mode parallèle uniquement)
+                    std::unique_ptr<MPSCRingBuffer<LogMessage>> queue;
+                    
+                    /// Thread de traitement de la file
+                    std::thread thread;
+                    
+                    /// Messages confiés à la file / traités ou perdus (barrière de Flush)
+                    std::atomic<uint64> pushed{0};
+                    std::atomic<uint64> completed{0};
+                    
+                    /// Demande d'arrêt du thread (file vidée avant de sortir)
+                    std::atomic<bool> stopRequested{false};
+                    
+                    /// Réveil du thread endormi sur une file vide
+                    std::atomic<bool> sleeping{false};
+                    std::mutex wakeMutex;
+                    std::condition_variable condition;
+                };
+                
+                // ---------------------------------------------------------------------
+                // STRUCTURE: SubSinkList
+                // DESCRIPTION: Instantané des sous-sinks et du mode de distribution
+                // ---------------------------------------------------------------------
+                struct SubSinkList {
+                    std::vector<std::shared_ptr<SubSink>> sinks;
+                    bool parallel = false;
+                };
+                
+                // ---------------------------------------------------------------------
+                // MÉTHODES PRIVÉES
+                // ---------------------------------------------------------------------
+                
+                /**
+                 * @brief Appelle Log du sous-sink et met à jour ses compteurs
+                 */
+                static void Deliver(SubSink& child, const LogMessage& message);
+                
+                /**
+                 * @brief Copie un message dans la file d'un sous-sink
+                 */
+                static void Enqueue(SubSink& child, const LogMessage& message);
+                
+                /**
+                 * @brief Attend que les messages déjà confiés au sous-sink soient traités
+                 */
+                static void WaitForQueue(SubSink& child);
+                
+                /**
+                 * @brief Réveille le thread du sous-sink s'il est endormi
+                 */
+                static void WakeWorker(SubSink& child);
+                
+                /**
+                 * @brief Crée la file et démarre le thread d'un sous-sink
+                 */
+                static void StartWorker(SubSink& child, size_t queueCapacity);
+                
+                /**
+                 * @brief Vide la file puis arrête le thread d'un sous-sink
+                 *
+                 * Appelée une fois que plus aucun instantané publié ne
+                 * distribue vers cette file.
+                 */
+                static void StopWorker(SubSink& child);
+                
+                /**
+                 * @brief Boucle du thread d'un sous-sink
+                 */
+                static void WorkerLoop(SubSink& child);
+                
                 // ---------------------------------------------------------------------
                 // VARIABLES MEMBRE PRIVÉES
                 // ---------------------------------------------------------------------
                 
-                /// Liste des sous-sinks
-                std::vector<std::shared_ptr<ISink>> m_Sinks;
+                /// Instantané des sous-sinks (lu sans verrou par Log)
+                SnapshotCell<SubSinkList> m_Children;
+                
+                /// Capacité des files créées en mode parallèle
+                size_t m_QueueCapacity;
                 
-                /// Mutex pour la synchronisation thread-safe
-                mutable std::mutex m_Mutex;
+                /// Sérialise les modifications (liste, mode, threads)
+                std::mutex m_ConfigMutex;
         };
 
     } // namespace logger
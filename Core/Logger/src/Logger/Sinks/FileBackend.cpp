@@ -0,0 +1,270 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/Sinks/FileBackend.cpp
+// DESCRIPTION: Implémentation des backends d'écriture des sinks fichier.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#include "Logger/Sinks/FileBackend.h"
+
+#if defined(__linux__)
+    #include <cerrno>
+    #include <climits>
+    #include <fcntl.h>
+    #include <sys/uio.h>
+    #include <unistd.h>
+#endif
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        // -------------------------------------------------------------------------
+        // IMPLÉMENTATION DE StreamFileBackend
+        // -------------------------------------------------------------------------
+
+        /**
+         * @brief Ouvre le fichier
+         */
+        bool StreamFileBackend::Open(const std::string& filename, bool truncate) {
+            std::ios_base::openmode mode = std::ios_base::out;
+            if (!truncate) {
+                mode |= std::ios_base::app;
+            }
+
+            m_Stream.open(filename, mode);
+            return m_Stream.is_open();
+        }
+
+        /**
+         * @brief Ferme le fichier
+         */
+        void StreamFileBackend::Close() {
+            if (m_Stream.is_open()) {
+                m_Stream.close();
+            }
+        }
+
+        /**
+         * @brief Vérifie si le fichier est ouvert
+         */
+        bool StreamFileBackend::IsOpen() const {
+            return m_Stream.is_open();
+        }
+
+        /**
+         * @brief Écrit plusieurs blocs à la suite
+         */
+        bool StreamFileBackend::Write(const FileChunk* chunks, size_t count) {
+            if (count == 1) {
+                m_Stream.write(chunks[0].data, static_cast<std::streamsize>(chunks[0].size));
+                return m_Stream.good();
+            }
+
+            // Le flux écrit chaque gros bloc séparément: les joindre d'abord
+            m_Staging.clear();
+            for (size_t i = 0; i < count; ++i) {
+                m_Staging.append(chunks[i].data, chunks[i].size);
+            }
+            m_Stream.write(m_Staging.data(), static_cast<std::streamsize>(m_Staging.size()));
+            return m_Stream.good();
+        }
+
+        /**
+         * @brief Transmet les données écrites au système
+         */
+        void StreamFileBackend::Flush() {
+            if (m_Stream.is_open()) {
+                m_Stream.flush();
+            }
+        }
+
+        #if defined(__linux__)
+
+        // -------------------------------------------------------------------------
+        // IMPLÉMENTATION DE DescriptorFileBackend
+        // -------------------------------------------------------------------------
+
+        /**
+         * @brief Constructeur
+         */
+        DescriptorFileBackend::DescriptorFileBackend(uint32 syncIntervalMs)
+            : m_Fd(-1)
+            , m_SyncIntervalMs(syncIntervalMs)
+            , m_Dirty(false)
+            , m_LastSync(std::chrono::steady_clock::now())
+            , m_SyncCount(0) {
+        }
+
+        /**
+         * @brief Destructeur
+         */
+        DescriptorFileBackend::~DescriptorFileBackend() {
+            Close();
+        }
+
+        /**
+         * @brief Ouvre le fichier (O_APPEND, créé si absent)
+         */
+        bool DescriptorFileBackend::Open(const std::string& filename, bool truncate) {
+            Close();
+
+            int flags = O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC;
+            if (truncate) {
+                flags |= O_TRUNC;
+            }
+
+            do {
+                m_Fd = ::open(filename.c_str(), flags, 0644);
+            } while (m_Fd < 0 && errno == EINTR);
+
+            m_Dirty = false;
+            m_LastSync = std::chrono::steady_clock::now();
+            return m_Fd >= 0;
+        }
+
+        /**
+         * @brief Ferme le fichier (synchronisé si fdatasync est activé)
+         */
+        void DescriptorFileBackend::Close() {
+            if (m_Fd < 0) {
+                return;
+            }
+
+            if (m_SyncIntervalMs > 0 && m_Dirty) {
+                Sync();
+            }
+
+            ::close(m_Fd);
+            m_Fd = -1;
+        }
+
+        /**
+         * @brief Vérifie si le fichier est ouvert
+         */
+        bool DescriptorFileBackend::IsOpen() const {
+            return m_Fd >= 0;
+        }
+
+        /**
+         * @brief Écrit tous les blocs avec writev
+         *
+         * Un seul appel système dans le cas courant; les écritures partielles
+         * (signal, disque plein) reprennent au premier octet non écrit.
+         */
+        bool DescriptorFileBackend::Write(const FileChunk* chunks, size_t count) {
+            if (m_Fd < 0) {
+                return false;
+            }
+
+            // Vecteurs par paquets (IOV_MAX est la limite du noyau)
+            constexpr size_t MAX_VECTORS = IOV_MAX < 64 ? IOV_MAX : 64;
+            struct iovec vectors[MAX_VECTORS];
+
+            size_t index = 0;
+            size_t offset = 0;
+
+            while (index < count) {
+                size_t vectorCount = 0;
+                for (size_t i = index; i < count && vectorCount < MAX_VECTORS; ++i) {
+                    const size_t skip = i == index ? offset : 0;
+                    if (chunks[i].size == skip) continue;
+                    vectors[vectorCount].iov_base = const_cast<char*>(chunks[i].data + skip);
+                    vectors[vectorCount].iov_len = chunks[i].size - skip;
+                    ++vectorCount;
+                }
+
+                if (vectorCount == 0) {
+                    break;
+                }
+
+                ssize_t written = ::writev(m_Fd, vectors, static_cast<int>(vectorCount));
+                if (written < 0) {
+                    if (errno == EINTR) continue;
+                    return false;
+                }
+
+                // Avancer dans les blocs du nombre d'octets écrits
+                size_t remaining = static_cast<size_t>(written);
+                while (index < count && remaining >= chunks[index].size - offset) {
+                    remaining -= chunks[index].size - offset;
+                    offset = 0;
+                    ++index;
+                }
+                offset += remaining;
+            }
+
+            m_Dirty = true;
+            return true;
+        }
+
+        /**
+         * @brief Les données sont déjà chez le noyau: fdatasync seulement si
+         *        l'intervalle est écoulé
+         */
+        void DescriptorFileBackend::Flush() {
+            if (m_SyncIntervalMs == 0 || !m_Dirty) {
+                return;
+            }
+
+            if (std::chrono::steady_clock::now() - m_LastSync >= std::chrono::milliseconds(m_SyncIntervalMs)) {
+                Sync();
+            }
+        }
+
+        /**
+         * @brief Force l'écriture sur le disque
+         */
+        void DescriptorFileBackend::Sync() {
+            if (m_Fd < 0) {
+                return;
+            }
+
+            ::fdatasync(m_Fd);
+            ++m_SyncCount;
+            m_Dirty = false;
+            m_LastSync = std::chrono::steady_clock::now();
+        }
+
+        /**
+         * @brief Définit le délai entre deux fdatasync
+         */
+        void DescriptorFileBackend::SetSyncInterval(uint32 syncIntervalMs) {
+            m_SyncIntervalMs = syncIntervalMs;
+        }
+
+        /**
+         * @brief Obtient le délai entre deux fdatasync
+         */
+        uint32 DescriptorFileBackend::GetSyncInterval() const {
+            return m_SyncIntervalMs;
+        }
+
+        /**
+         * @brief Nombre d'appels fdatasync effectués
+         */
+        uint64 DescriptorFileBackend::GetSyncCount() const {
+            return m_SyncCount;
+        }
+
+        #endif
+
+        /**
+         * @brief Crée un backend du type demandé
+         */
+        std::unique_ptr<IFileBackend> CreateFileBackend(FileBackendType type, uint32 syncIntervalMs) {
+            #if defined(__linux__)
+                if (type == FileBackendType::Descriptor) {
+                    return std::make_unique<DescriptorFileBackend>(syncIntervalMs);
+                }
+            #else
+                (void)type;
+                (void)syncIntervalMs;
+            #endif
+            return std::make_unique<StreamFileBackend>();
+        }
+
+    } // namespace logger
+} // namespace nkentseu
@@ -0,0 +1,217 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/Sinks/FileBackend.h
+// DESCRIPTION: Backends d'écriture des sinks fichier: flux standard (portable)
+//              et descripteur brut avec écriture groupée writev (Linux).
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Logger/Export.h"
+#include <Nkentseu/Types.h>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <string>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        // -------------------------------------------------------------------------
+        // STRUCTURE: FileChunk
+        // DESCRIPTION: Bloc de données contigu transmis à un backend
+        // -------------------------------------------------------------------------
+        struct FileChunk {
+            /// Début des données
+            const char* data = nullptr;
+
+            /// Taille en octets
+            size_t size = 0;
+        };
+
+        // -------------------------------------------------------------------------
+        // ÉNUMÉRATION: FileBackendType
+        // DESCRIPTION: Backends fournis par la bibliothèque
+        // -------------------------------------------------------------------------
+        enum class FileBackendType : uint8 {
+            /// std::ofstream (toutes plateformes)
+            Stream,
+
+            /// Descripteur brut, O_APPEND + writev (Linux; Stream ailleurs)
+            Descriptor
+        };
+
+        // -------------------------------------------------------------------------
+        // CLASSE: IFileBackend
+        // DESCRIPTION: Destination physique d'un FileSink. Le sink garde le
+        //              tampon et la stratégie de flush; le backend n'écrit que
+        //              des blocs complets. Non thread-safe: le sink sérialise
+        //              les appels sous son mutex. Un backend qui demande une
+        //              synchronisation périodique (GetSyncInterval) reçoit un
+        //              Flush() du minuteur du sink à chaque intervalle.
+        // -------------------------------------------------------------------------
+        class LOGGER_API IFileBackend {
+            public:
+                /**
+                 * @brief Destructeur virtuel
+                 */
+                virtual ~IFileBackend() = default;
+
+                /**
+                 * @brief Ouvre le fichier
+                 * @param filename Chemin du fichier
+                 * @param truncate true pour tronquer, false pour ajouter en fin
+                 * @return true si ouvert avec succès
+                 */
+                virtual bool Open(const std::string& filename, bool truncate) = 0;
+
+                /**
+                 * @brief Ferme le fichier (sans effet s'il est fermé)
+                 */
+                virtual void Close() = 0;
+
+                /**
+                 * @brief Vérifie si le fichier est ouvert
+                 */
+                virtual bool IsOpen() const = 0;
+
+                /**
+                 * @brief Écrit plusieurs blocs à la suite
+                 * @param chunks Blocs dans l'ordre du fichier
+                 * @param count Nombre de blocs
+                 * @return true si tout a été écrit
+                 */
+                virtual bool Write(const FileChunk* chunks, size_t count) = 0;
+
+                /**
+                 * @brief Transmet les données écrites au système
+                 */
+                virtual void Flush() = 0;
+
+                /**
+                 * @brief Force l'écriture sur le disque (fdatasync si disponible)
+                 */
+                virtual void Sync() {}
+
+                /**
+                 * @brief Période à laquelle Flush() doit être appelé même sans écriture
+                 * @return Délai en ms (0 = aucun appel périodique)
+                 */
+                virtual uint32 GetSyncInterval() const { return 0; }
+
+                /**
+                 * @brief Obtient le type du backend
+                 */
+                virtual FileBackendType GetType() const = 0;
+        };
+
+        // -------------------------------------------------------------------------
+        // CLASSE: StreamFileBackend
+        // DESCRIPTION: Backend std::ofstream, comportement historique du FileSink
+        // -------------------------------------------------------------------------
+        class LOGGER_API StreamFileBackend : public IFileBackend {
+            public:
+                bool Open(const std::string& filename, bool truncate) override;
+                void Close() override;
+                bool IsOpen() const override;
+                bool Write(const FileChunk* chunks, size_t count) override;
+                void Flush() override;
+                FileBackendType GetType() const override { return FileBackendType::Stream; }
+
+            private:
+                /// Flux de fichier
+                std::ofstream m_Stream;
+
+                /// Blocs joints avant écriture (un seul appel au flux)
+                std::string m_Staging;
+        };
+
+        #if defined(__linux__)
+
+        // -------------------------------------------------------------------------
+        // CLASSE: DescriptorFileBackend
+        // DESCRIPTION: Backend Linux sur descripteur brut. Ouvert en O_APPEND
+        //              (écritures atomiques en fin de fichier même à plusieurs
+        //              processus), tous les blocs d'un flush partent en un seul
+        //              writev, sans locale ni sentry de iostream. fdatasync est
+        //              optionnel et cadencé par un intervalle: Flush() le lance
+        //              si l'intervalle est écoulé depuis le précédent, et le
+        //              minuteur du sink appelle Flush() à chaque intervalle.
+        //              Des données écrites sont donc sur le disque au plus deux
+        //              intervalles plus tard, même si le sink reste inactif.
+        // -------------------------------------------------------------------------
+        class LOGGER_API DescriptorFileBackend : public IFileBackend {
+            public:
+                /**
+                 * @brief Constructeur
+                 * @param syncIntervalMs Délai entre deux fdatasync (0 = jamais)
+                 */
+                explicit DescriptorFileBackend(uint32 syncIntervalMs = 0);
+
+                /**
+                 * @brief Destructeur (ferme le descripteur)
+                 */
+                ~DescriptorFileBackend() override;
+
+                bool Open(const std::string& filename, bool truncate) override;
+                void Close() override;
+                bool IsOpen() const override;
+                bool Write(const FileChunk* chunks, size_t count) override;
+                void Flush() override;
+                void Sync() override;
+                FileBackendType GetType() const override { return FileBackendType::Descriptor; }
+
+                /**
+                 * @brief Définit le délai entre deux fdatasync
+                 * @param syncIntervalMs Délai en ms (0 = jamais)
+                 *
+                 * Le sink lit l'intervalle quand il reçoit le backend: le
+                 * définir avant SetBackend.
+                 */
+                void SetSyncInterval(uint32 syncIntervalMs);
+
+                /**
+                 * @brief Obtient le délai entre deux fdatasync
+                 */
+                uint32 GetSyncInterval() const override;
+
+                /**
+                 * @brief Nombre d'appels fdatasync effectués (lisible hors du verrou du sink)
+                 */
+                uint64 GetSyncCount() const;
+
+            private:
+                /// Descripteur (-1 si fermé)
+                int m_Fd;
+
+                /// Délai entre deux fdatasync (0 = jamais)
+                uint32 m_SyncIntervalMs;
+
+                /// Données écrites depuis le dernier fdatasync
+                bool m_Dirty;
+
+                /// Instant du dernier fdatasync
+                std::chrono::steady_clock::time_point m_LastSync;
+
+                /// Nombre d'appels fdatasync
+                std::atomic<uint64> m_SyncCount;
+        };
+
+        #endif
+
+        /**
+         * @brief Crée un backend du type demandé
+         * @param type Type de backend (Descriptor devient Stream hors Linux)
+         * @param syncIntervalMs Délai entre deux fdatasync (backend Descriptor)
+         * @return Backend fermé
+         */
+        LOGGER_API std::unique_ptr<IFileBackend> CreateFileBackend(FileBackendType type, uint32 syncIntervalMs = 0);
+
+    } // namespace logger
+} // namespace nkentseu
@@ -0,0 +1,128 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/Sinks/FileMaintenance.cpp
+// DESCRIPTION: Implémentation du thread de fond des sinks fichier.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#include "Logger/Sinks/FileMaintenance.h"
+
+#if defined(_WIN32)
+    #include <Windows.h>
+#elif defined(__linux__)
+    #include <sys/resource.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#elif defined(__APPLE__)
+    #include <pthread.h>
+#endif
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        /**
+         * @brief Démarre le thread de fond
+         */
+        FileMaintenance::FileMaintenance(bool lowPriority)
+            : m_Busy(false)
+            , m_Stop(false)
+            , m_LowPriority(lowPriority) {
+            m_Thread = std::thread(&FileMaintenance::Run, this);
+        }
+
+        /**
+         * @brief Exécute les travaux en attente puis arrête le thread
+         */
+        FileMaintenance::~FileMaintenance() {
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                m_Stop = true;
+            }
+            m_Condition.notify_one();
+            m_Thread.join();
+        }
+
+        /**
+         * @brief Ajoute un travail à la file
+         */
+        void FileMaintenance::Post(Job job) {
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                m_Jobs.push_back(std::move(job));
+            }
+            m_Condition.notify_one();
+        }
+
+        /**
+         * @brief Attend que tous les travaux déposés soient terminés
+         */
+        void FileMaintenance::WaitIdle() {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_IdleCondition.wait(lock, [this] { return m_Jobs.empty() && !m_Busy; });
+        }
+
+        /**
+         * @brief Obtient le nombre de travaux en attente ou en cours
+         */
+        size_t FileMaintenance::GetPendingCount() const {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            return m_Jobs.size() + (m_Busy ? 1 : 0);
+        }
+
+        /**
+         * @brief Boucle du thread de fond
+         */
+        void FileMaintenance::Run() {
+            if (m_LowPriority) {
+                LowerCurrentThreadPriority();
+            }
+
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            for (;;) {
+                m_Condition.wait(lock, [this] { return m_Stop || !m_Jobs.empty(); });
+                if (m_Jobs.empty()) {
+                    break; // Arrêt demandé et plus rien à faire
+                }
+
+                Job job = std::move(m_Jobs.front());
+                m_Jobs.pop_front();
+                m_Busy = true;
+
+                // Le travail s'exécute sans verrou: Post ne l'attend jamais
+                lock.unlock();
+                try {
+                    job();
+                } catch (...) {
+                    // Une erreur de système de fichiers ne doit pas arrêter le thread
+                }
+                lock.lock();
+
+                m_Busy = false;
+                if (m_Jobs.empty()) {
+                    m_IdleCondition.notify_all();
+                }
+            }
+        }
+
+        /**
+         * @brief Abaisse la priorité du thread courant (au mieux)
+         *
+         * Sous Linux, la priorité « nice » s'applique au thread désigné par
+         * son identifiant noyau; un échec laisse simplement la priorité
+         * inchangée.
+         */
+        void FileMaintenance::LowerCurrentThreadPriority() {
+            #if defined(_WIN32)
+                SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+            #elif defined(__linux__)
+                setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), 10);
+            #elif defined(__APPLE__)
+                pthread_set_qos_class_self_np(QOS_CLASS_UTILITY, 0);
+            #endif
+        }
+
+    } // namespace logger
+} // namespace nkentseu
@@ -0,0 +1,114 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/Sinks/FileMaintenance.h
+// DESCRIPTION: Thread de fond des sinks fichier: rotation des sauvegardes et
+//              autres travaux sur le système de fichiers, hors du thread de log.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Logger/Export.h"
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        // -------------------------------------------------------------------------
+        // CLASSE: FileMaintenance
+        // DESCRIPTION: File de travaux exécutés dans l'ordre par un thread dédié.
+        //              Un sink y dépose les opérations lentes (renommages,
+        //              suppressions, parcours de répertoire) sous son verrou:
+        //              Post ne fait qu'ajouter à une file et réveiller le thread.
+        //              Le destructeur exécute les travaux restants avant de rendre
+        //              la main. En priorité basse, le thread cède le processeur
+        //              aux threads de l'application (compression des sauvegardes).
+        // -------------------------------------------------------------------------
+        class LOGGER_API FileMaintenance {
+            public:
+                /// Travail exécuté par le thread de fond
+                using Job = std::function<void()>;
+
+                // ---------------------------------------------------------------------
+                // CONSTRUCTEURS ET DESTRUCTEUR
+                // ---------------------------------------------------------------------
+
+                /**
+                 * @brief Démarre le thread de fond
+                 * @param lowPriority true pour abaisser la priorité du thread
+                 */
+                explicit FileMaintenance(bool lowPriority = false);
+
+                /**
+                 * @brief Exécute les travaux en attente puis arrête le thread
+                 */
+                ~FileMaintenance();
+
+                FileMaintenance(const FileMaintenance&) = delete;
+                FileMaintenance& operator=(const FileMaintenance&) = delete;
+
+                // ---------------------------------------------------------------------
+                // TRAVAUX
+                // ---------------------------------------------------------------------
+
+                /**
+                 * @brief Ajoute un travail à la file
+                 * @param job Travail (une exception levée est ignorée)
+                 */
+                void Post(Job job);
+
+                /**
+                 * @brief Attend que tous les travaux déposés soient terminés
+                 */
+                void WaitIdle();
+
+                /**
+                 * @brief Obtient le nombre de travaux en attente ou en cours
+                 */
+                size_t GetPendingCount() const;
+
+            private:
+                /**
+                 * @brief Boucle du thread de fond
+                 */
+                void Run();
+
+                /**
+                 * @brief Abaisse la priorité du thread courant (au mieux)
+                 */
+                static void LowerCurrentThreadPriority();
+
+                /// Travaux en attente
+                std::deque<Job> m_Jobs;
+
+                /// Travail en cours d'exécution
+                bool m_Busy;
+
+                /// Arrêt demandé (destructeur)
+                bool m_Stop;
+
+                /// Thread en priorité basse
+                const bool m_LowPriority;
+
+                /// Protège la file et les indicateurs
+                mutable std::mutex m_Mutex;
+
+                /// Réveille le thread de fond
+                std::condition_variable m_Condition;
+
+                /// Signalée quand la file devient vide
+                std::condition_variable m_IdleCondition;
+
+                /// Thread de fond (dernier membre: démarré une fois le reste construit)
+                std::thread m_Thread;
+        };
+
+    } // namespace logger
+} // namespace nkentseu
@@ -23,7 +23,8 @@ namespace nkentseu {
          * @brief Constructeur avec chemin de fichier
          */
         FileSink::FileSink(const std::string& filename, bool truncate)
-            : m_Filename(filename)
+            : m_Backend(std::make_unique<StreamFileBackend>())
+            , m_Filename(filename)
             , m_Truncate(truncate) {
             m_Formatter = std::make_unique<Formatter>(Formatter::DEFAULT_PATTERN);
             
@@ -40,6 +41,8 @@ namespace nkentseu {
          * @brief Destructeur
          */
         FileSink::~FileSink() {
+            // Arrêter le minuteur d'abord: son travail prend le verrou du sink
+            m_FlushTimer.reset();
             Close();
         }
         
@@ -54,30 +57,145 @@ namespace nkentseu {
             std::lock_guard<std::mutex> lock(m_Mutex);
             
             // Vérifier si le fichier est ouvert
-            if (!m_FileStream.is_open()) {
+            if (!m_Backend->IsOpen()) {
                 if (!OpenFile()) {
                     return; // Impossible d'ouvrir le fichier
                 }
             }
             
-            // Formater le message
-            std::string formatted = m_Formatter->Format(message, false);
+            // Formater le message dans le tampon réutilisable
+            m_FormatBuffer.clear();
+            m_Formatter->FormatTo(message, false, m_FormatBuffer);
             
-            // Écrire dans le fichier
-            m_FileStream << formatted << std::endl;
+            WriteLine(message, m_FormatBuffer);
+        }
+        
+        /**
+         * @brief Écrit une ligne déjà formatée par le logger
+         */
+        void FileSink::LogFormatted(const LogMessage& message, const std::string& formatted) {
+            if (!IsEnabled() || !ShouldLog(message.level)) {
+                return;
+            }
+            
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            
+            if (!m_Backend->IsOpen()) {
+                if (!OpenFile()) {
+                    return;
+                }
+            }
+            
+            WriteLine(message, formatted);
+        }
+        
+        /**
+         * @brief Écrit une ligne puis vérifie la rotation
+         */
+        void FileSink::WriteLine(const LogMessage& message, const std::string& formatted) {
+            // Rotation temporelle: l'échéance est précalculée par le sink dérivé
+            if (message.timestamp >= m_RotationDeadline) {
+                OnRotationDeadline(message.timestamp);
+            }
+            
+            AppendToBuffer(formatted);
+            
+            const bool levelTrigger =
+                m_FlushPolicy.flushLevel != LogLevel::Off && message.level >= m_FlushPolicy.flushLevel;
+            
+            if (!m_FlushPolicy.IsBuffered()) {
+                // Une écriture par ligne, ou une par lot asynchrone
+                if (!m_InBatch || levelTrigger || m_BufferedBytes >= MAX_BATCH_BYTES) {
+                    FlushBuffer();
+                }
+            } else {
+                // Le déclencheur temporel est tenu par le minuteur (OnFlushTimer)
+                const size_t threshold = m_FlushPolicy.flushBytes > 0 ?
+                    m_FlushPolicy.flushBytes : m_FlushPolicy.bufferSize;
+                
+                if (m_BufferedBytes >= threshold || levelTrigger) {
+                    FlushBuffer();
+                }
+            }
             
             // Vérifier la rotation si nécessaire
             CheckRotation();
         }
         
+        /**
+         * @brief Ajoute une ligne au tampon
+         *
+         * Les lignes remplissent des blocs de CHUNK_SIZE octets: le tampon
+         * grandit sans recopie et un flush transmet tous les blocs au backend
+         * en un seul appel (writev pour le backend Descriptor).
+         */
+        void FileSink::AppendToBuffer(const std::string& formatted) {
+            const size_t lineSize = formatted.size() + 1;
+            
+            if (m_ChunkCount == 0 ||
+                (!m_Chunks[m_ChunkCount - 1].empty() &&
+                 m_Chunks[m_ChunkCount - 1].size() + lineSize > CHUNK_SIZE)) {
+                if (m_ChunkCount == m_Chunks.size()) {
+                    m_Chunks.emplace_back();
+                    m_Chunks.back().reserve(CHUNK_SIZE);
+                }
+                ++m_ChunkCount;
+            }
+            
+            std::string& chunk = m_Chunks[m_ChunkCount - 1];
+            chunk += formatted;
+            chunk += '\n';
+            m_BufferedBytes += lineSize;
+            m_FileSize += lineSize;
+        }
+        
+        /**
+         * @brief Écrit le tampon dans le fichier en un bloc
+         */
+        void FileSink::FlushBuffer() {
+            if (m_BufferedBytes > 0 && m_Backend->IsOpen()) {
+                m_ChunkViews.clear();
+                for (size_t i = 0; i < m_ChunkCount; ++i) {
+                    m_ChunkViews.push_back({ m_Chunks[i].data(), m_Chunks[i].size() });
+                }
+                m_Backend->Write(m_ChunkViews.data(), m_ChunkViews.size());
+                m_Backend->Flush();
+            }
+            
+            for (size_t i = 0; i < m_ChunkCount; ++i) {
+                m_Chunks[i].clear();
+            }
+            m_ChunkCount = 0;
+            m_BufferedBytes = 0;
+        }
+        
+        /**
+         * @brief Début d'un lot de messages du logger asynchrone
+         */
+        void FileSink::BeginBatch() {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_InBatch = true;
+        }
+        
+        /**
+         * @brief Fin d'un lot: une seule écriture pour toutes ses lignes
+         */
+        void FileSink::EndBatch() {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_InBatch = false;
+            
+            if (!m_FlushPolicy.IsBuffered()) {
+                FlushBuffer();
+            }
+        }
+        
         /**
          * @brief Force l'écriture des données en attente
          */
         void FileSink::Flush() {
             std::lock_guard<std::mutex> lock(m_Mutex);
-            if (m_FileStream.is_open()) {
-                m_FileStream.flush();
-            }
+            FlushBuffer();
+            m_Backend->Flush();
         }
         
         /**
@@ -130,9 +248,7 @@ namespace nkentseu {
          */
         void FileSink::Close() {
             std::lock_guard<std::mutex> lock(m_Mutex);
-            if (m_FileStream.is_open()) {
-                m_FileStream.close();
-            }
+            CloseFile();
         }
         
         /**
@@ -140,7 +256,7 @@ namespace nkentseu {
          */
         bool FileSink::IsOpen() const {
             std::lock_guard<std::mutex> lock(m_Mutex);
-            return m_FileStream.is_open();
+            return m_Backend->IsOpen();
         }
         
         /**
@@ -159,8 +275,9 @@ namespace nkentseu {
             
             if (m_Filename != filename) {
                 // Fermer l'ancien fichier
-                if (m_FileStream.is_open()) {
-                    m_FileStream.close();
+                if (m_Backend->IsOpen()) {
+                    FlushBuffer();
+                    m_Backend->Close();
                 }
                 
                 // Mettre à jour le nom
@@ -183,15 +300,40 @@ namespace nkentseu {
         size_t FileSink::GetFileSize() const {
             std::lock_guard<std::mutex> lock(m_Mutex);
             
-            if (!std::filesystem::exists(m_Filename)) {
-                return 0;
+            std::error_code error;
+            const auto size = std::filesystem::file_size(m_Filename, error);
+            return error ? 0 : static_cast<size_t>(size);
+        }
+        
+        /**
+         * @brief Obtient la taille du fichier comptée en mémoire
+         */
+        size_t FileSink::GetTrackedSize() const {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            return m_FileSize;
+        }
+        
+        /**
+         * @brief Écrit les lignes en attente puis ferme le fichier
+         */
+        void FileSink::CloseFile() {
+            if (m_Backend->IsOpen()) {
+                FlushBuffer();
+                m_Backend->Close();
             }
+        }
+        
+        /**
+         * @brief Rouvre le fichier courant
+         */
+        bool FileSink::ReopenFile(bool truncate) {
+            CloseFile();
             
-            try {
-                return std::filesystem::file_size(m_Filename);
-            } catch (...) {
-                return 0;
-            }
+            const bool previous = m_Truncate;
+            m_Truncate = truncate;
+            const bool opened = OpenFile();
+            m_Truncate = previous;
+            return opened;
         }
         
         /**
@@ -204,8 +346,9 @@ namespace nkentseu {
                 m_Truncate = truncate;
                 
                 // Re-ouvrir le fichier avec le nouveau mode
-                if (m_FileStream.is_open()) {
-                    m_FileStream.close();
+                if (m_Backend->IsOpen()) {
+                    FlushBuffer();
+                    m_Backend->Close();
                     OpenFile();
                 }
             }
@@ -219,6 +362,69 @@ namespace nkentseu {
             return m_Truncate;
         }
         
+        /**
+         * @brief Définit la stratégie d'écriture
+         */
+        void FileSink::SetFlushPolicy(const FlushPolicy& policy) {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            FlushBuffer();
+            m_FlushPolicy = policy;
+            UpdateFlushTimer();
+        }
+        
+        /**
+         * @brief Obtient la stratégie d'écriture
+         */
+        FlushPolicy FileSink::GetFlushPolicy() const {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            return m_FlushPolicy;
+        }
+        
+        /**
+         * @brief Obtient le nombre d'octets en attente dans le tampon
+         */
+        size_t FileSink::GetBufferedBytes() const {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            return m_BufferedBytes;
+        }
+        
+        /**
+         * @brief Remplace le backend d'écriture
+         */
+        void FileSink::SetBackend(std::unique_ptr<IFileBackend> backend) {
+            if (!backend) {
+                return;
+            }
+            
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            const bool wasOpen = m_Backend->IsOpen();
+            
+            FlushBuffer();
+            m_Backend->Close();
+            m_Backend = std::move(backend);
+            
+            // Le fichier a déjà été tronqué à la première ouverture
+            if (wasOpen) {
+                m_Backend->Open(m_Filename, false);
+            }
+            UpdateFlushTimer();
+        }
+        
+        /**
+         * @brief Sélectionne un backend fourni par la bibliothèque
+         */
+        void FileSink::SetBackend(FileBackendType type, uint32 syncIntervalMs) {
+            SetBackend(CreateFileBackend(type, syncIntervalMs));
+        }
+        
+        /**
+         * @brief Obtient le type du backend courant
+         */
+        FileBackendType FileSink::GetBackendType() const {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            return m_Backend->GetType();
+        }
+        
         /**
          * @brief Ouvre le fichier avec le mode approprié
          */
@@ -227,34 +433,82 @@ namespace nkentseu {
                 return false;
             }
             
-            // Déterminer le mode d'ouverture
-            std::ios_base::openmode mode = std::ios_base::out;
-            if (!m_Truncate) {
-                mode |= std::ios_base::app;
-            }
-            
             // Ouvrir le fichier
-            m_FileStream.open(m_Filename, mode);
-            
-            if (!m_FileStream.is_open()) {
+            if (!m_Backend->Open(m_Filename, m_Truncate)) {
                 // Essayer de créer le répertoire parent
                 std::filesystem::path path(m_Filename);
                 if (path.has_parent_path()) {
                     std::filesystem::create_directories(path.parent_path());
-                    m_FileStream.open(m_Filename, mode);
+                    m_Backend->Open(m_Filename, m_Truncate);
                 }
             }
             
             // Vérifier l'ouverture
-            if (!m_FileStream.is_open()) {
+            if (!m_Backend->IsOpen()) {
                 return false;
             }
             
-            // Configurer le flux
-            m_FileStream << std::unitbuf; // Pas de buffering
+            // Taille de départ: un seul stat, à l'ouverture
+            m_FileSize = 0;
+            if (!m_Truncate) {
+                std::error_code error;
+                const auto size = std::filesystem::file_size(m_Filename, error);
+                if (!error) {
+                    m_FileSize = static_cast<size_t>(size);
+                }
+            }
+            
+            // Le tampon et les flushs sont gérés par WriteLine (voir FlushPolicy)
             return true;
         }
         
+        /**
+         * @brief Démarre ou arrête le minuteur de flush selon la stratégie
+         *
+         * La période est la plus courte du déclencheur temporel (tampon
+         * seulement) et de l'intervalle de synchronisation du backend.
+         *
+         * Le minuteur n'est jamais détruit ici: son travail attend peut-être
+         * le verrou que l'appelant tient. Il est seulement mis en pause.
+         */
+        void FileSink::UpdateFlushTimer() {
+            uint32 period = m_FlushPolicy.IsBuffered() ? m_FlushPolicy.flushIntervalMs : 0;
+            const uint32 syncInterval = m_Backend->GetSyncInterval();
+            if (syncInterval > 0 && (period == 0 || syncInterval < period)) {
+                period = syncInterval;
+            }
+            
+            if (period == 0) {
+                if (m_FlushTimer) {
+                    m_FlushTimer->SetJob(nullptr, 0);
+                }
+                return;
+            }
+            
+            if (!m_FlushTimer) {
+                m_FlushTimer = std::make_unique<FlushTimer>();
+            }
+            m_FlushTimer->SetJob([this] { OnFlushTimer(); }, period);
+        }
+        
+        /**
+         * @brief Travail du minuteur: écrit les lignes en attente
+         *
+         * Une ligne attend donc au plus flushIntervalMs dans le tampon, même
+         * si aucun autre message n'arrive (plus court si le backend se
+         * synchronise plus souvent). Sans déclencheur temporel, le tampon
+         * n'est pas touché. Le backend reçoit un Flush() à chaque passage:
+         * c'est là qu'il lance une synchronisation due (fdatasync).
+         */
+        void FileSink::OnFlushTimer() {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (m_BufferedBytes > 0 && m_FlushPolicy.IsBuffered() && m_FlushPolicy.flushIntervalMs > 0) {
+                FlushBuffer();
+            } else if (m_Backend->IsOpen()) {
+                m_Backend->Flush();
+            }
+        }
+        
         /**
          * @brief Vérifie et gère la rotation de fichier si nécessaire
          */
@@ -262,6 +516,13 @@ namespace nkentseu {
             // Par défaut, pas de rotation
             // Les sous-classes peuvent override cette méthode
         }
+        
+        /**
+         * @brief Appelé quand un message atteint l'échéance de rotation
+         */
+        void FileSink::OnRotationDeadline(uint64) {
+            // Par défaut, aucune échéance n'est fixée
+        }
 
     } // namespace logger
 } // namespace nkentseu
\ No newline at end of file
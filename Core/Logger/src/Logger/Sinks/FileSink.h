@@ -8,8 +8,12 @@
 #pragma once
 
 #include "Logger/Sink.h"
-#include <fstream>
+#include "Logger/Sinks/FileBackend.h"
+#include "Logger/Sinks/FlushTimer.h"
+#include <memory>
 #include <mutex>
+#include <string>
+#include <vector>
 
 // -----------------------------------------------------------------------------
 // NAMESPACE: nkentseu::logger
@@ -17,6 +21,66 @@
 namespace nkentseu {
     namespace logger {
 
+        // -------------------------------------------------------------------------
+        // STRUCTURE: FlushPolicy
+        // DESCRIPTION: Stratégie d'écriture d'un FileSink. Sans tampon, chaque
+        //              ligne est écrite immédiatement (un appel système par ligne).
+        //              Avec tampon, les lignes s'accumulent en mémoire et sont
+        //              écrites en un bloc dès qu'un déclencheur est atteint.
+        //              Le déclencheur temporel est tenu par un minuteur du sink:
+        //              un sink resté silencieux écrit quand même ses lignes.
+        // -------------------------------------------------------------------------
+        struct FlushPolicy {
+            /// Taille du tampon en octets (0 = pas de tampon)
+            size_t bufferSize = 0;
+            
+            /// Écrire dès que le tampon contient ce nombre d'octets (0 = quand il est plein)
+            size_t flushBytes = 0;
+            
+            /// Écrire les lignes en attente au plus n ms après leur arrivée (0 = désactivé)
+            uint32 flushIntervalMs = 0;
+            
+            /// Écrire immédiatement à partir de ce niveau (Off = désactivé)
+            LogLevel flushLevel = LogLevel::Off;
+            
+            /**
+             * @brief Une écriture par ligne (comportement historique)
+             */
+            static FlushPolicy Unbuffered() {
+                return FlushPolicy();
+            }
+            
+            /**
+             * @brief Tampon vidé quand il est plein, au moins une fois par seconde, ou sur Error et plus
+             * @param bufferSize Taille du tampon
+             */
+            static FlushPolicy Buffered(size_t bufferSize = 64 * 1024) {
+                FlushPolicy policy;
+                policy.bufferSize = bufferSize;
+                policy.flushIntervalMs = 1000;
+                policy.flushLevel = LogLevel::Error;
+                return policy;
+            }
+            
+            /**
+             * @brief Tampon vidé seulement quand il est plein ou sur Flush() explicite
+             * @param bufferSize Taille du tampon
+             */
+            static FlushPolicy ExplicitOnly(size_t bufferSize = 64 * 1024) {
+                FlushPolicy policy;
+                policy.bufferSize = bufferSize;
+                return policy;
+            }
+            
+            /**
+             * @brief Vérifie si la politique utilise un tampon
+             * @return true si bufferSize > 0
+             */
+            bool IsBuffered() const {
+                return bufferSize > 0;
+            }
+        };
+
         // -------------------------------------------------------------------------
         // CLASSE: FileSink
         // DESCRIPTION: Sink pour l'écriture dans un fichier
@@ -48,6 +112,26 @@ namespace nkentseu {
                  */
                 void Log(const LogMessage& message) override;
                 
+                /**
+                 * @brief Écrit une ligne déjà formatée par le logger
+                 */
+                void LogFormatted(const LogMessage& message, const std::string& formatted) override;
+                
+                /**
+                 * @brief Le fichier accepte les lignes formatées par le logger
+                 */
+                bool SupportsPreformatted() const override { return true; }
+                
+                /**
+                 * @brief Début d'un lot: les lignes sont retenues jusqu'à EndBatch()
+                 */
+                void BeginBatch() override;
+                
+                /**
+                 * @brief Fin d'un lot: les lignes retenues partent en une écriture
+                 */
+                void EndBatch() override;
+                
                 /**
                  * @brief Force l'écriture des données en attente
                  */
@@ -107,11 +191,17 @@ namespace nkentseu {
                 void SetFilename(const std::string& filename);
                 
                 /**
-                 * @brief Obtient la taille actuelle du fichier
-                 * @return Taille en octets
+                 * @brief Obtient la taille actuelle du fichier sur disque
+                 * @return Taille en octets (interroge le système de fichiers)
                  */
                 size_t GetFileSize() const;
                 
+                /**
+                 * @brief Obtient la taille du fichier comptée en mémoire
+                 * @return Taille à l'ouverture plus les lignes écrites ou en attente
+                 */
+                size_t GetTrackedSize() const;
+                
                 /**
                  * @brief Définit le mode d'ouverture (truncate/append)
                  * @param truncate true pour tronquer, false pour append
@@ -124,6 +214,48 @@ namespace nkentseu {
                  */
                 bool GetTruncate() const;
 
+                /**
+                 * @brief Définit la stratégie d'écriture (les données en attente sont écrites)
+                 * @param policy Stratégie (voir FlushPolicy)
+                 */
+                void SetFlushPolicy(const FlushPolicy& policy);
+
+                /**
+                 * @brief Obtient la stratégie d'écriture
+                 * @return Stratégie courante
+                 */
+                FlushPolicy GetFlushPolicy() const;
+
+                /**
+                 * @brief Obtient le nombre d'octets en attente dans le tampon
+                 * @return Octets non encore écrits dans le fichier
+                 */
+                size_t GetBufferedBytes() const;
+
+                /**
+                 * @brief Remplace le backend d'écriture (le fichier est rouvert)
+                 * @param backend Nouveau backend (ignoré si nul)
+                 *
+                 * Les lignes en attente sont écrites avec l'ancien backend. Le
+                 * fichier est rouvert en ajout pour ne pas perdre son contenu.
+                 * Le minuteur suit IFileBackend::GetSyncInterval du nouveau backend.
+                 */
+                void SetBackend(std::unique_ptr<IFileBackend> backend);
+
+                /**
+                 * @brief Sélectionne un backend fourni par la bibliothèque
+                 * @param type Type de backend
+                 * @param syncIntervalMs Délai entre deux fdatasync (backend Descriptor, 0 = jamais),
+                 *        tenu par le minuteur du sink même sans nouvelle ligne
+                 */
+                void SetBackend(FileBackendType type, uint32 syncIntervalMs = 0);
+
+                /**
+                 * @brief Obtient le type du backend courant
+                 * @return Type de backend
+                 */
+                FileBackendType GetBackendType() const;
+
             private:
                 // ---------------------------------------------------------------------
                 // MÉTHODES PRIVÉES
@@ -134,11 +266,52 @@ namespace nkentseu {
                  */
                 bool OpenFile();
                 
+                /**
+                 * @brief Écrit une ligne puis vérifie la rotation (verrou tenu)
+                 * @param message Message (niveau pour le flush, horodatage pour
+                 *        l'échéance de rotation)
+                 * @param formatted Ligne formatée
+                 */
+                void WriteLine(const LogMessage& message, const std::string& formatted);
+                
+                /**
+                 * @brief Écrit le tampon dans le fichier en un bloc (verrou tenu)
+                 */
+                void FlushBuffer();
+                
+                /**
+                 * @brief Ajoute une ligne et sa fin de ligne au tampon (verrou tenu)
+                 */
+                void AppendToBuffer(const std::string& formatted);
+                
                 /**
                  * @brief Vérifie et gère la rotation de fichier si nécessaire
+                 *
+                 * Appelé après chaque ligne, verrou tenu: une surcharge ne doit
+                 * utiliser que les accès "verrou tenu" ci-dessous.
                  */
                 virtual void CheckRotation();
                 
+                /**
+                 * @brief Appelé avant la première ligne dont l'horodatage atteint
+                 *        l'échéance fixée par SetRotationDeadline (verrou tenu)
+                 * @param timestamp Horodatage du message (ns depuis l'epoch)
+                 *
+                 * La ligne est écrite après l'appel: une rotation faite ici
+                 * place la ligne dans le nouveau fichier.
+                 */
+                virtual void OnRotationDeadline(uint64 timestamp);
+                
+                /**
+                 * @brief Démarre ou arrête le minuteur selon la stratégie et le backend (verrou tenu)
+                 */
+                void UpdateFlushTimer();
+                
+                /**
+                 * @brief Travail du minuteur: écrit les lignes en attente
+                 */
+                void OnFlushTimer();
+                
                 // ---------------------------------------------------------------------
                 // VARIABLES MEMBRE PRIVÉES
                 // ---------------------------------------------------------------------
@@ -146,16 +319,87 @@ namespace nkentseu {
                 /// Formatter pour ce sink
                 std::unique_ptr<Formatter> m_Formatter;
                 
-                /// Flux de fichier
-                std::ofstream m_FileStream;
+                /// Tampon de formatage réutilisé d'un message à l'autre
+                std::string m_FormatBuffer;
+                
+                /// Backend d'écriture (flux standard par défaut)
+                std::unique_ptr<IFileBackend> m_Backend;
                 
                 /// Nom du fichier
                 std::string m_Filename;
                 
                 /// Mode d'ouverture (truncate/append)
                 bool m_Truncate;
+                
+                /// Stratégie d'écriture
+                FlushPolicy m_FlushPolicy;
+                
+                /// Taille d'un bloc du tampon d'écriture
+                static constexpr size_t CHUNK_SIZE = 16 * 1024;
+                
+                /// Lignes retenues au-delà de laquelle un lot est écrit sans attendre EndBatch()
+                static constexpr size_t MAX_BATCH_BYTES = 1024 * 1024;
+                
+                /// Lignes en attente, par blocs (capacité conservée d'un flush à l'autre)
+                std::vector<std::string> m_Chunks;
+                
+                /// Nombre de blocs utilisés dans m_Chunks
+                size_t m_ChunkCount = 0;
+                
+                /// Octets en attente dans les blocs
+                size_t m_BufferedBytes = 0;
+                
+                /// Vue des blocs transmise au backend
+                std::vector<FileChunk> m_ChunkViews;
+                
+                /// Lot asynchrone en cours (voir BeginBatch)
+                bool m_InBatch = false;
+                
+                /// Minuteur du déclencheur temporel et de la synchronisation (créé
+                /// au premier besoin, arrêté avant la fermeture du fichier)
+                std::unique_ptr<FlushTimer> m_FlushTimer;
+            
+                /// Taille du fichier comptée en mémoire (lue à l'ouverture, puis
+                /// augmentée de chaque ligne: aucun stat par message)
+                size_t m_FileSize = 0;
+            
+                /// Échéance de rotation temporelle (ns depuis l'epoch, aucune par
+                /// défaut): une comparaison par ligne
+                uint64 m_RotationDeadline = ~uint64(0);
             
             protected:
+                // ---------------------------------------------------------------------
+                // ACCÈS POUR LES SINKS DÉRIVÉS (verrou tenu)
+                // ---------------------------------------------------------------------
+                
+                /**
+                 * @brief Écrit les lignes en attente puis ferme le fichier (verrou tenu)
+                 */
+                void CloseFile();
+                
+                /**
+                 * @brief Rouvre le fichier courant (verrou tenu)
+                 * @param truncate true pour repartir d'un fichier vide
+                 * @return true si ouvert
+                 */
+                bool ReopenFile(bool truncate);
+                
+                /**
+                 * @brief Chemin du fichier courant (verrou tenu)
+                 */
+                const std::string& GetPath() const { return m_Filename; }
+                
+                /**
+                 * @brief Taille comptée en mémoire (verrou tenu)
+                 */
+                size_t GetTrackedSizeUnlocked() const { return m_FileSize; }
+                
+                /**
+                 * @brief Fixe l'échéance de OnRotationDeadline (verrou tenu)
+                 * @param deadline Horodatage en ns depuis l'epoch
+                 */
+                void SetRotationDeadline(uint64 deadline) { m_RotationDeadline = deadline; }
+                
                 /// Mutex pour la synchronisation thread-safe
                 mutable std::mutex m_Mutex;
         };
@@ -0,0 +1,88 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/Sinks/FlushTimer.cpp
+// DESCRIPTION: Implémentation du minuteur des sinks fichier.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#include "Logger/Sinks/FlushTimer.h"
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        /**
+         * @brief Démarre le thread du minuteur (sans travail)
+         */
+        FlushTimer::FlushTimer()
+            : m_Period(0)
+            , m_Stop(false) {
+            m_Thread = std::thread(&FlushTimer::Run, this);
+        }
+
+        /**
+         * @brief Arrête le thread (attend la fin d'une exécution en cours)
+         */
+        FlushTimer::~FlushTimer() {
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                m_Stop = true;
+            }
+            m_Condition.notify_one();
+            m_Thread.join();
+        }
+
+        /**
+         * @brief Définit le travail périodique (remplace le précédent)
+         */
+        void FlushTimer::SetJob(Job job, uint32 periodMs) {
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                if (!job || periodMs == 0) {
+                    m_Job = nullptr;
+                    m_Period = std::chrono::milliseconds(0);
+                } else {
+                    m_Job = std::move(job);
+                    m_Period = std::chrono::milliseconds(periodMs);
+                    m_NextTick = std::chrono::steady_clock::now() + m_Period;
+                }
+            }
+            m_Condition.notify_one();
+        }
+
+        /**
+         * @brief Boucle du thread du minuteur
+         */
+        void FlushTimer::Run() {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            while (!m_Stop) {
+                if (!m_Job) {
+                    m_Condition.wait(lock);
+                    continue;
+                }
+
+                const auto now = std::chrono::steady_clock::now();
+                if (now < m_NextTick) {
+                    m_Condition.wait_until(lock, m_NextTick);
+                    continue;
+                }
+
+                // Pas de rattrapage après un retard: prochaine échéance depuis maintenant
+                m_NextTick = now + m_Period;
+                Job job = m_Job;
+
+                // Le travail prend le verrou du sink: SetJob ne doit pas l'attendre
+                lock.unlock();
+                try {
+                    job();
+                } catch (...) {
+                    // Une erreur d'écriture ne doit pas arrêter le minuteur
+                }
+                lock.lock();
+            }
+        }
+
+    } // namespace logger
+} // namespace nkentseu
@@ -0,0 +1,98 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/Sinks/FlushTimer.h
+// DESCRIPTION: Minuteur des sinks fichier: exécute un travail périodique
+//              (vidage des tampons) sur un thread dédié.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Logger/Export.h"
+#include <Nkentseu/Types.h>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        // -------------------------------------------------------------------------
+        // CLASSE: FlushTimer
+        // DESCRIPTION: Thread qui lance un travail à intervalle régulier. Un sink
+        //              y confie son déclencheur temporel: les lignes en attente
+        //              sont écrites même si aucun message n'arrive. SetJob peut
+        //              être appelé sous le verrou du sink; le destructeur, lui,
+        //              attend la fin du travail en cours et ne doit jamais l'être.
+        // -------------------------------------------------------------------------
+        class LOGGER_API FlushTimer {
+            public:
+                /// Travail exécuté à chaque échéance
+                using Job = std::function<void()>;
+
+                // ---------------------------------------------------------------------
+                // CONSTRUCTEURS ET DESTRUCTEUR
+                // ---------------------------------------------------------------------
+
+                /**
+                 * @brief Démarre le thread du minuteur (sans travail)
+                 */
+                FlushTimer();
+
+                /**
+                 * @brief Arrête le thread (attend la fin d'une exécution en cours)
+                 */
+                ~FlushTimer();
+
+                FlushTimer(const FlushTimer&) = delete;
+                FlushTimer& operator=(const FlushTimer&) = delete;
+
+                // ---------------------------------------------------------------------
+                // CONFIGURATION
+                // ---------------------------------------------------------------------
+
+                /**
+                 * @brief Définit le travail périodique (remplace le précédent)
+                 * @param job Travail (nullptr pour mettre le minuteur en pause)
+                 * @param periodMs Période en millisecondes (0 pour la pause)
+                 *
+                 * La première exécution a lieu periodMs après l'appel. Une
+                 * exécution en cours se termine normalement.
+                 */
+                void SetJob(Job job, uint32 periodMs);
+
+            private:
+                /**
+                 * @brief Boucle du thread du minuteur
+                 */
+                void Run();
+
+                /// Protège le travail, l'échéance et le drapeau d'arrêt
+                std::mutex m_Mutex;
+
+                /// Réveille le thread (nouveau travail, arrêt)
+                std::condition_variable m_Condition;
+
+                /// Travail périodique (vide en pause)
+                Job m_Job;
+
+                /// Période du travail
+                std::chrono::milliseconds m_Period;
+
+                /// Prochaine exécution
+                std::chrono::steady_clock::time_point m_NextTick;
+
+                /// Arrêt demandé
+                bool m_Stop;
+
+                /// Thread du minuteur
+                std::thread m_Thread;
+        };
+
+    } // namespace logger
+} // namespace nkentseu
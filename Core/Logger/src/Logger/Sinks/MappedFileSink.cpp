@@ -0,0 +1,437 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/Sinks/MappedFileSink.cpp
+// DESCRIPTION: Implémentation du sink fichier projeté en mémoire.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#include "Logger/Sinks/MappedFileSink.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#if defined(__linux__) || defined(__APPLE__)
+    #define NK_LOGGER_MAPPED_FILE 1
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        namespace {
+
+            /**
+             * @brief Arrondit une taille de bloc au multiple de page supérieur
+             */
+            size_t RoundToPage(size_t size) {
+                #if defined(NK_LOGGER_MAPPED_FILE)
+                    const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+                #else
+                    const size_t page = 4096;
+                #endif
+                if (size < page) return page;
+                return (size + page - 1) / page * page;
+            }
+
+        } // namespace
+
+        // -------------------------------------------------------------------------
+        // IMPLÉMENTATION DE MappedFileSink
+        // -------------------------------------------------------------------------
+
+        /**
+         * @brief Constructeur avec chemin de fichier
+         */
+        MappedFileSink::MappedFileSink(const std::string& filename, bool truncate, size_t chunkSize)
+            : m_Filename(filename)
+            , m_Truncate(truncate)
+            , m_ChunkSize(RoundToPage(chunkSize))
+            , m_Fd(-1)
+            , m_Chunk(nullptr)
+            , m_ChunkOffset(0)
+            , m_Size(0) {
+            m_Formatter = std::make_unique<Formatter>(Formatter::DEFAULT_PATTERN);
+
+            // Créer le répertoire parent si nécessaire
+            std::filesystem::path path(filename);
+            if (path.has_parent_path()) {
+                std::filesystem::create_directories(path.parent_path());
+            }
+
+            Open();
+        }
+
+        /**
+         * @brief Destructeur
+         */
+        MappedFileSink::~MappedFileSink() {
+            Close();
+        }
+
+        /**
+         * @brief Logge un message dans le fichier
+         */
+        void MappedFileSink::Log(const LogMessage& message) {
+            if (!IsEnabled() || !ShouldLog(message.level)) {
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (m_Chunk == nullptr) {
+                return;
+            }
+
+            m_FormatBuffer.clear();
+            m_Formatter->FormatTo(message, false, m_FormatBuffer);
+            WriteLine(m_FormatBuffer);
+        }
+
+        /**
+         * @brief Écrit une ligne déjà formatée par le logger
+         */
+        void MappedFileSink::LogFormatted(const LogMessage& message, const std::string& formatted) {
+            if (!IsEnabled() || !ShouldLog(message.level)) {
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (m_Chunk == nullptr) {
+                return;
+            }
+
+            WriteLine(formatted);
+        }
+
+        /**
+         * @brief Demande l'écriture des pages modifiées
+         */
+        void MappedFileSink::Flush() {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            #if defined(NK_LOGGER_MAPPED_FILE)
+                if (m_Chunk != nullptr) {
+                    ::msync(m_Chunk, m_ChunkSize, MS_ASYNC);
+                }
+            #endif
+        }
+
+        /**
+         * @brief Définit le formatter pour ce sink
+         */
+        void MappedFileSink::SetFormatter(std::unique_ptr<Formatter> formatter) {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Formatter = std::move(formatter);
+        }
+
+        /**
+         * @brief Définit le pattern de formatage
+         */
+        void MappedFileSink::SetPattern(const std::string& pattern) {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (m_Formatter) {
+                m_Formatter->SetPattern(pattern);
+            }
+        }
+
+        /**
+         * @brief Obtient le formatter courant
+         */
+        Formatter* MappedFileSink::GetFormatter() const {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            return m_Formatter.get();
+        }
+
+        /**
+         * @brief Obtient le pattern courant
+         */
+        std::string MappedFileSink::GetPattern() const {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (m_Formatter) {
+                return m_Formatter->GetPattern();
+            }
+            return "";
+        }
+
+        /**
+         * @brief Ouvre et projette le fichier
+         */
+        bool MappedFileSink::Open() {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            return OpenFile();
+        }
+
+        /**
+         * @brief Ferme le fichier
+         */
+        void MappedFileSink::Close() {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            CloseFile();
+        }
+
+        /**
+         * @brief Vérifie si le fichier est ouvert
+         */
+        bool MappedFileSink::IsOpen() const {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            return m_Chunk != nullptr;
+        }
+
+        /**
+         * @brief Obtient le nom du fichier
+         */
+        std::string MappedFileSink::GetFilename() const {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            return m_Filename;
+        }
+
+        /**
+         * @brief Obtient la longueur écrite
+         */
+        size_t MappedFileSink::GetFileSize() const {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            return m_Size;
+        }
+
+        /**
+         * @brief Obtient la taille d'un bloc projeté
+         */
+        size_t MappedFileSink::GetChunkSize() const {
+            return m_ChunkSize;
+        }
+
+        /**
+         * @brief Ouvre le fichier et projette le bloc de fin
+         */
+        bool MappedFileSink::OpenFile() {
+            #if defined(NK_LOGGER_MAPPED_FILE)
+                if (m_Fd >= 0) {
+                    return m_Chunk != nullptr;
+                }
+                if (m_Filename.empty()) {
+                    return false;
+                }
+
+                // Reprendre après la dernière ligne complète d'une exécution interrompue
+                if (!m_Truncate && std::filesystem::exists(m_Filename)) {
+                    Recover(m_Filename);
+                }
+
+                int flags = O_RDWR | O_CREAT | O_CLOEXEC;
+                if (m_Truncate) {
+                    flags |= O_TRUNC;
+                }
+
+                m_Fd = ::open(m_Filename.c_str(), flags, 0644);
+                if (m_Fd < 0) {
+                    return false;
+                }
+
+                struct stat info;
+                if (::fstat(m_Fd, &info) != 0) {
+                    ::close(m_Fd);
+                    m_Fd = -1;
+                    return false;
+                }
+
+                m_Size = static_cast<size_t>(info.st_size);
+                if (!MapChunk()) {
+                    ::close(m_Fd);
+                    m_Fd = -1;
+                    return false;
+                }
+                return true;
+            #else
+                return false;
+            #endif
+        }
+
+        /**
+         * @brief Libère la projection, tronque et ferme
+         */
+        void MappedFileSink::CloseFile() {
+            #if defined(NK_LOGGER_MAPPED_FILE)
+                if (m_Chunk != nullptr) {
+                    ::munmap(m_Chunk, m_ChunkSize);
+                    m_Chunk = nullptr;
+                }
+
+                if (m_Fd >= 0) {
+                    // Retirer la préallocation non utilisée
+                    if (::ftruncate(m_Fd, static_cast<off_t>(m_Size)) != 0) {
+                        // Fichier laissé préalloué: Recover() le ramènera à m_Size
+                    }
+                    ::close(m_Fd);
+                    m_Fd = -1;
+                }
+            #endif
+        }
+
+        /**
+         * @brief Projette le bloc contenant la position d'écriture
+         *
+         * Le fichier est étendu jusqu'à la fin du bloc avant la projection
+         * (posix_fallocate sous Linux: un disque plein est détecté ici et non
+         * par un SIGBUS lors de la copie).
+         */
+        bool MappedFileSink::MapChunk() {
+            #if defined(NK_LOGGER_MAPPED_FILE)
+                if (m_Chunk != nullptr) {
+                    ::munmap(m_Chunk, m_ChunkSize);
+                    m_Chunk = nullptr;
+                }
+
+                m_ChunkOffset = m_Size / m_ChunkSize * m_ChunkSize;
+                const off_t end = static_cast<off_t>(m_ChunkOffset + m_ChunkSize);
+
+                bool allocated = false;
+                #if defined(__linux__)
+                    const int result = ::posix_fallocate(m_Fd, static_cast<off_t>(m_ChunkOffset),
+                                                         static_cast<off_t>(m_ChunkSize));
+                    allocated = result == 0;
+                    if (result != 0 && result != EOPNOTSUPP && result != EINVAL) {
+                        return false;
+                    }
+                #endif
+                if (!allocated && ::ftruncate(m_Fd, end) != 0) {
+                    return false;
+                }
+
+                void* address = ::mmap(nullptr, m_ChunkSize, PROT_READ | PROT_WRITE, MAP_SHARED,
+                                       m_Fd, static_cast<off_t>(m_ChunkOffset));
+                if (address == MAP_FAILED) {
+                    return false;
+                }
+
+                m_Chunk = static_cast<char*>(address);
+                return true;
+            #else
+                return false;
+            #endif
+        }
+
+        /**
+         * @brief Copie une ligne et sa fin de ligne
+         *
+         * Si un bloc ne peut pas être projeté en cours de ligne, les octets
+         * déjà copiés ne sont pas comptés: CloseFile tronque le fichier à la
+         * dernière ligne complète.
+         */
+        void MappedFileSink::WriteLine(const std::string& formatted) {
+            const size_t lineStart = m_Size;
+            if (!Append(formatted.data(), formatted.size()) || !Append("\n", 1)) {
+                m_Size = lineStart;
+            }
+        }
+
+        /**
+         * @brief Copie des octets, en projetant les blocs suivants si besoin
+         */
+        bool MappedFileSink::Append(const char* data, size_t size) {
+            while (size > 0) {
+                size_t available = m_ChunkOffset + m_ChunkSize - m_Size;
+                if (available == 0) {
+                    if (!MapChunk()) {
+                        return false;
+                    }
+                    available = m_ChunkSize;
+                }
+
+                const size_t count = std::min(available, size);
+                std::memcpy(m_Chunk + (m_Size - m_ChunkOffset), data, count);
+                m_Size += count;
+                data += count;
+                size -= count;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Longueur valide d'un fichier après un arrêt brutal
+         *
+         * Les lignes sont copiées dans l'ordre: tout ce qui précède le dernier
+         * octet non nul est valide, sauf une ligne coupée par l'arrêt.
+         */
+        int64 MappedFileSink::FindValidLength(const std::string& filename) {
+            std::ifstream file(filename, std::ios::binary | std::ios::ate);
+            if (!file.is_open()) {
+                return -1;
+            }
+
+            const int64 fileSize = static_cast<int64>(file.tellg());
+            if (fileSize <= 0) {
+                return 0;
+            }
+
+            // Remonter les blocs de la fin jusqu'au dernier octet non nul: s'il
+            // ne termine pas une ligne, la dernière ligne est incomplète, même
+            // sans zéros derrière elle (écriture coupée en fin de bloc projeté)
+            const int64 BLOCK_SIZE = 64 * 1024;
+            std::vector<char> block(static_cast<size_t>(BLOCK_SIZE));
+            bool content = false;
+            int64 end = fileSize;
+
+            while (end > 0) {
+                const int64 start = end > BLOCK_SIZE ? end - BLOCK_SIZE : 0;
+                file.seekg(start);
+                file.read(block.data(), end - start);
+                if (!file) {
+                    return -1;
+                }
+
+                for (int64 i = end - start - 1; i >= 0; --i) {
+                    const char c = block[static_cast<size_t>(i)];
+                    if (!content) {
+                        if (c == '\0') {
+                            continue;
+                        }
+                        content = true;
+                    }
+                    // Fin de la dernière ligne complète
+                    if (c == '\n') {
+                        return start + i + 1;
+                    }
+                }
+                end = start;
+            }
+
+            return 0;
+        }
+
+        /**
+         * @brief Tronque un fichier à sa longueur valide
+         */
+        bool MappedFileSink::Recover(const std::string& filename, size_t* validLength) {
+            const int64 length = FindValidLength(filename);
+            if (length < 0) {
+                return false;
+            }
+
+            std::error_code error;
+            const uintmax_t fileSize = std::filesystem::file_size(filename, error);
+            if (error) {
+                return false;
+            }
+
+            if (static_cast<uintmax_t>(length) < fileSize) {
+                std::filesystem::resize_file(filename, static_cast<uintmax_t>(length), error);
+                if (error) {
+                    return false;
+                }
+            }
+
+            if (validLength) {
+                *validLength = static_cast<size_t>(length);
+            }
+            return true;
+        }
+
+    } // namespace logger
+} // namespace nkentseu
@@ -0,0 +1,234 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/Sinks/MappedFileSink.h
+// DESCRIPTION: Sink fichier projeté en mémoire (mmap), en ajout seul. Les
+//              lignes sont copiées dans des pages partagées avec le noyau:
+//              aucun appel système par ligne et le contenu survit à un
+//              SIGKILL du processus.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Logger/Sink.h"
+#include <mutex>
+#include <string>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        // -------------------------------------------------------------------------
+        // CLASSE: MappedFileSink
+        // DESCRIPTION: Le fichier est préalloué et projeté par blocs de taille
+        //              fixe. Quand un bloc est plein, le fichier grandit et le
+        //              bloc suivant est projeté. À la fermeture, le fichier est
+        //              tronqué à la longueur réellement écrite.
+        //
+        //              Après un arrêt brutal, le fichier garde sa taille
+        //              préallouée et se termine par des zéros:
+        //              MappedFileSink::Recover() (ou l'outil LogRecover) le
+        //              ramène à sa dernière ligne complète.
+        //
+        //              Disponible sur les systèmes POSIX; ailleurs Open()
+        //              échoue et les messages sont ignorés.
+        // -------------------------------------------------------------------------
+        class LOGGER_API MappedFileSink : public ISink {
+            public:
+                /// Taille par défaut d'un bloc projeté
+                static constexpr size_t DEFAULT_CHUNK_SIZE = 4 * 1024 * 1024;
+
+                // ---------------------------------------------------------------------
+                // CONSTRUCTEURS
+                // ---------------------------------------------------------------------
+
+                /**
+                 * @brief Constructeur avec chemin de fichier
+                 * @param filename Chemin du fichier
+                 * @param truncate true pour tronquer le fichier existant
+                 * @param chunkSize Taille d'un bloc projeté (arrondie à la page)
+                 *
+                 * En ajout, un fichier laissé par un arrêt brutal est d'abord
+                 * récupéré (voir Recover()).
+                 */
+                explicit MappedFileSink(const std::string& filename, bool truncate = false,
+                                        size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+                /**
+                 * @brief Destructeur (ferme et tronque le fichier)
+                 */
+                ~MappedFileSink() override;
+
+                // ---------------------------------------------------------------------
+                // IMPLÉMENTATION DE ISink
+                // ---------------------------------------------------------------------
+
+                /**
+                 * @brief Logge un message dans le fichier
+                 */
+                void Log(const LogMessage& message) override;
+
+                /**
+                 * @brief Écrit une ligne déjà formatée par le logger
+                 */
+                void LogFormatted(const LogMessage& message, const std::string& formatted) override;
+
+                /**
+                 * @brief Le fichier accepte les lignes formatées par le logger
+                 */
+                bool SupportsPreformatted() const override { return true; }
+
+                /**
+                 * @brief Demande l'écriture des pages modifiées (msync asynchrone)
+                 *
+                 * Inutile pour survivre à un SIGKILL (les pages appartiennent
+                 * au noyau); utile contre une panne du système.
+                 */
+                void Flush() override;
+
+                /**
+                 * @brief Définit le formatter pour ce sink
+                 */
+                void SetFormatter(std::unique_ptr<Formatter> formatter) override;
+
+                /**
+                 * @brief Définit le pattern de formatage
+                 */
+                void SetPattern(const std::string& pattern) override;
+
+                /**
+                 * @brief Obtient le formatter courant
+                 */
+                Formatter* GetFormatter() const override;
+
+                /**
+                 * @brief Obtient le pattern courant
+                 */
+                std::string GetPattern() const override;
+
+                // ---------------------------------------------------------------------
+                // CONFIGURATION SPÉCIFIQUE AU FICHIER
+                // ---------------------------------------------------------------------
+
+                /**
+                 * @brief Ouvre et projette le fichier (si non ouvert)
+                 * @return true si ouvert avec succès
+                 */
+                bool Open();
+
+                /**
+                 * @brief Ferme le fichier et le tronque à la longueur écrite
+                 */
+                void Close();
+
+                /**
+                 * @brief Vérifie si le fichier est ouvert
+                 */
+                bool IsOpen() const;
+
+                /**
+                 * @brief Obtient le nom du fichier
+                 */
+                std::string GetFilename() const;
+
+                /**
+                 * @brief Obtient la longueur écrite (hors préallocation)
+                 * @return Taille en octets
+                 */
+                size_t GetFileSize() const;
+
+                /**
+                 * @brief Obtient la taille d'un bloc projeté
+                 */
+                size_t GetChunkSize() const;
+
+                // ---------------------------------------------------------------------
+                // RÉCUPÉRATION
+                // ---------------------------------------------------------------------
+
+                /**
+                 * @brief Longueur valide d'un fichier après un arrêt brutal
+                 * @param filename Chemin du fichier
+                 * @return Octets jusqu'à la fin de la dernière ligne complète
+                 *         (taille du fichier s'il se termine par une fin de
+                 *         ligne), -1 si le fichier est illisible
+                 */
+                static int64 FindValidLength(const std::string& filename);
+
+                /**
+                 * @brief Tronque un fichier à sa longueur valide
+                 * @param filename Chemin du fichier
+                 * @param validLength Longueur conservée (optionnel)
+                 * @return true si le fichier est lisible et a été tronqué si besoin
+                 */
+                static bool Recover(const std::string& filename, size_t* validLength = nullptr);
+
+            private:
+                // ---------------------------------------------------------------------
+                // MÉTHODES PRIVÉES
+                // ---------------------------------------------------------------------
+
+                /**
+                 * @brief Ouvre le fichier et projette le bloc de fin (verrou tenu)
+                 */
+                bool OpenFile();
+
+                /**
+                 * @brief Libère la projection, tronque et ferme (verrou tenu)
+                 */
+                void CloseFile();
+
+                /**
+                 * @brief Projette le bloc contenant la position d'écriture (verrou tenu)
+                 */
+                bool MapChunk();
+
+                /**
+                 * @brief Copie une ligne et sa fin de ligne (verrou tenu)
+                 */
+                void WriteLine(const std::string& formatted);
+
+                /**
+                 * @brief Copie des octets, en projetant les blocs suivants si besoin
+                 */
+                bool Append(const char* data, size_t size);
+
+                // ---------------------------------------------------------------------
+                // VARIABLES MEMBRE PRIVÉES
+                // ---------------------------------------------------------------------
+
+                /// Formatter pour ce sink
+                std::unique_ptr<Formatter> m_Formatter;
+
+                /// Tampon de formatage réutilisé d'un message à l'autre
+                std::string m_FormatBuffer;
+
+                /// Nom du fichier
+                std::string m_Filename;
+
+                /// Mode d'ouverture (truncate/append)
+                bool m_Truncate;
+
+                /// Taille d'un bloc projeté (multiple de la page)
+                size_t m_ChunkSize;
+
+                /// Descripteur (-1 si fermé)
+                int m_Fd;
+
+                /// Bloc projeté courant (nullptr si aucun)
+                char* m_Chunk;
+
+                /// Position du bloc courant dans le fichier
+                size_t m_ChunkOffset;
+
+                /// Longueur écrite
+                size_t m_Size;
+
+                /// Mutex pour la synchronisation thread-safe
+                mutable std::mutex m_Mutex;
+        };
+
+    } // namespace logger
+} // namespace nkentseu
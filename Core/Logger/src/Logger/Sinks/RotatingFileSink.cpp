@@ -6,6 +6,7 @@
 // -----------------------------------------------------------------------------
 
 #include "Logger/Sinks/RotatingFileSink.h"
+#include <algorithm>
 #include <filesystem>
 #include <sstream>
 
@@ -19,21 +20,16 @@ namespace logger {
         : FileSink(filename, false)
         , m_MaxSize(maxSize)
         , m_MaxFiles(maxFiles)
-        , m_CurrentSize(0) {
+        , m_RotationCount(0)
+        , m_CompressionLevel(0) {
     }
 
     /**
      * @brief Destructeur
      */
     RotatingFileSink::~RotatingFileSink() {
-    }
-
-    /**
-     * @brief Logge un message avec vérification de rotation
-     */
-    void RotatingFileSink::Log(const LogMessage& message) {
-        FileSink::Log(message);
-        m_CurrentSize = GetFileSize();
+        // Les sauvegardes en attente sont installées avant la fermeture
+        m_Maintenance.reset();
     }
 
     /**
@@ -72,15 +68,78 @@ namespace logger {
      * @brief Force la rotation du fichier
      */
     bool RotatingFileSink::Rotate() {
-        PerformRotation();
-        return true;
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return PerformRotation();
+    }
+
+    /**
+     * @brief Confie le glissement des sauvegardes à un thread de fond
+     */
+    void RotatingFileSink::SetBackgroundRotation(bool enabled) {
+        std::unique_ptr<FileMaintenance> previous;
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (enabled == (m_Maintenance != nullptr)) return;
+
+            if (enabled) {
+                m_Maintenance = std::make_unique<FileMaintenance>(true);
+            } else {
+                previous = std::move(m_Maintenance);
+                m_CompressionLevel = 0;
+            }
+        }
+        // Travaux restants terminés hors du verrou du sink
+    }
+
+    /**
+     * @brief Indique si la rotation de fond est active
+     */
+    bool RotatingFileSink::IsBackgroundRotation() const {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_Maintenance != nullptr;
+    }
+
+    /**
+     * @brief Compresse les sauvegardes en gzip sur le thread de fond
+     */
+    void RotatingFileSink::SetCompression(bool enabled, int level) {
+        if (enabled) {
+            SetBackgroundRotation(true);
+        }
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_CompressionLevel = enabled ? std::max(1, std::min(9, level)) : 0;
+    }
+
+    /**
+     * @brief Indique si les sauvegardes sont compressées
+     */
+    bool RotatingFileSink::IsCompressionEnabled() const {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_CompressionLevel > 0;
+    }
+
+    /**
+     * @brief Attend la fin des rotations de fond en attente
+     */
+    void RotatingFileSink::WaitForBackgroundWork() {
+        FileMaintenance* maintenance = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            maintenance = m_Maintenance.get();
+        }
+        if (maintenance) {
+            maintenance->WaitIdle();
+        }
     }
 
     /**
      * @brief Vérifie et effectue la rotation si nécessaire
+     *
+     * Appelé après chaque ligne, verrou tenu: une comparaison d'entiers.
      */
     void RotatingFileSink::CheckRotation() {
-        if (m_CurrentSize >= m_MaxSize) {
+        if (m_MaxSize > 0 && GetTrackedSizeUnlocked() >= m_MaxSize) {
             PerformRotation();
         }
     }
@@ -88,39 +147,76 @@ namespace logger {
     /**
      * @brief Effectue la rotation des fichiers
      */
-    void RotatingFileSink::PerformRotation() {
-        // Fermer le fichier courant
-        Close();
-
-        // Rotation des fichiers: .log.N -> .log.N+1
-        for (size_t i = m_MaxFiles - 1; i > 0; --i) {
-            std::string oldFile = GetFilenameForIndex(i - 1);
-            std::string newFile = GetFilenameForIndex(i);
-
-            if (std::filesystem::exists(oldFile)) {
-                std::filesystem::rename(oldFile, newFile);
+    bool RotatingFileSink::PerformRotation() {
+        // Les lignes en attente appartiennent au fichier qui part
+        CloseFile();
+
+        const std::string& path = GetPath();
+        std::error_code error;
+
+        if (m_MaxFiles == 0) {
+            // Aucune sauvegarde conservée
+            std::filesystem::remove(path, error);
+        } else if (m_Maintenance) {
+            // Un seul renommage ici, le reste sur le thread de fond
+            std::ostringstream pending;
+            pending << path << ".pending." << m_RotationCount++;
+            std::filesystem::rename(path, pending.str(), error);
+            if (!error) {
+                m_Maintenance->Post([path, rotated = pending.str(), maxFiles = m_MaxFiles,
+                                     level = m_CompressionLevel] {
+                    ShiftBackups(path, rotated, maxFiles, level);
+                });
             }
+        } else {
+            ShiftBackups(path, path, m_MaxFiles, 0);
         }
 
-        // Renommer le fichier courant en .log.0
-        std::string currentFile = GetFilename();
-        std::string rotatedFile = GetFilenameForIndex(0);
+        // En ajout: si un renommage a échoué, l'ancien contenu est conservé
+        return ReopenFile(false);
+    }
 
-        if (std::filesystem::exists(currentFile)) {
-            std::filesystem::rename(currentFile, rotatedFile);
+    /**
+     * @brief Fait glisser les sauvegardes puis installe la nouvelle
+     *
+     * Sans test d'existence préalable: un renommage dont la source manque
+     * échoue simplement (un appel système au lieu de deux). La plus ancienne
+     * est supprimée d'abord pour que chaque renommage vise un nom libre: un
+     * renommage qui remplace un fichier force l'écriture des données du
+     * fichier renommé sur certains systèmes (ext4) et tient le répertoire.
+     * Chaque rang peut exister en clair ou compressé (compression activée
+     * en cours de route, ou compression échouée): les deux glissent.
+     */
+    void RotatingFileSink::ShiftBackups(const std::string& path, const std::string& rotated,
+                                        size_t maxFiles, int compressionLevel) {
+        std::error_code error;
+        const std::string oldest = GetFilenameForIndex(path, maxFiles - 1);
+        std::filesystem::remove(oldest, error);
+        std::filesystem::remove(oldest + ".gz", error);
+
+        // .N-2 -> .N-1, ..., .0 -> .1
+        for (size_t i = maxFiles - 1; i > 0; --i) {
+            const std::string from = GetFilenameForIndex(path, i - 1);
+            const std::string to = GetFilenameForIndex(path, i);
+            std::filesystem::rename(from, to, error);
+            std::filesystem::rename(from + ".gz", to + ".gz", error);
         }
 
-        // Rouvrir le fichier
-        Open();
-        m_CurrentSize = 0;
+        const std::string newest = GetFilenameForIndex(path, 0);
+        if (compressionLevel > 0 && GzipCompressFile(rotated, newest + ".gz", compressionLevel)) {
+            std::filesystem::remove(rotated, error);
+        } else {
+            // Sans compression, ou en repli: la sauvegarde reste en clair
+            std::filesystem::rename(rotated, newest, error);
+        }
     }
 
     /**
      * @brief Génère le nom de fichier pour un index donné
      */
-    std::string RotatingFileSink::GetFilenameForIndex(size_t index) const {
+    std::string RotatingFileSink::GetFilenameForIndex(const std::string& path, size_t index) {
         std::ostringstream oss;
-        oss << GetFilename() << "." << index;
+        oss << path << "." << index;
         return oss.str();
     }
 
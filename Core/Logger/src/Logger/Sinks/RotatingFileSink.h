@@ -8,6 +8,9 @@
 #pragma once
 
 #include "Logger/Sinks/FileSink.h"
+#include "Logger/Sinks/FileMaintenance.h"
+#include "Logger/Deflate.h"
+#include <memory>
 
 // -----------------------------------------------------------------------------
 // NAMESPACE: nkentseu::logger
@@ -17,7 +20,22 @@ namespace nkentseu {
 
         // -------------------------------------------------------------------------
         // CLASSE: RotatingFileSink
-        // DESCRIPTION: Sink avec rotation de fichier basée sur la taille
+        // DESCRIPTION: Sink avec rotation de fichier basée sur la taille.
+        //              La taille est comptée en mémoire par FileSink (un stat à
+        //              l'ouverture, aucun par ligne). Au-delà de maxSize, le
+        //              fichier devient la sauvegarde .0, les sauvegardes
+        //              existantes glissent d'un rang (.0 -> .1, ...) et la
+        //              plus ancienne au-delà de maxFiles disparaît.
+        //
+        //              En rotation de fond, le thread de log ne fait qu'un
+        //              renommage vers un nom d'attente et rouvre le fichier;
+        //              le glissement des sauvegardes se fait sur un thread de
+        //              FileMaintenance, dans l'ordre des rotations.
+        //
+        //              Avec la compression, ce même thread (en priorité basse)
+        //              compresse chaque fichier tourné en gzip: les sauvegardes
+        //              deviennent .0.gz, .1.gz, ... et ne sont jamais tronquées
+        //              (écriture dans .gz.tmp puis renommage).
         // -------------------------------------------------------------------------
         class LOGGER_API RotatingFileSink : public FileSink {
             public:
@@ -34,19 +52,10 @@ namespace nkentseu {
                 RotatingFileSink(const std::string& filename, size_t maxSize, size_t maxFiles);
                 
                 /**
-                 * @brief Destructeur
+                 * @brief Destructeur (termine les rotations de fond en attente)
                  */
                 ~RotatingFileSink() override;
                 
-                // ---------------------------------------------------------------------
-                // IMPLÉMENTATION DE FileSink
-                // ---------------------------------------------------------------------
-                
-                /**
-                 * @brief Logge un message avec vérification de rotation
-                 */
-                void Log(const LogMessage& message) override;
-                
                 // ---------------------------------------------------------------------
                 // CONFIGURATION DE LA ROTATION
                 // ---------------------------------------------------------------------
@@ -77,9 +86,39 @@ namespace nkentseu {
                 
                 /**
                  * @brief Force la rotation du fichier
-                 * @return true si rotation réussie, false sinon
+                 * @return true si le nouveau fichier est ouvert, false sinon
                  */
                 bool Rotate();
+                
+                /**
+                 * @brief Confie le glissement des sauvegardes à un thread de fond
+                 * @param enabled true pour ne jamais bloquer le thread de log
+                 *        sur plus d'un renommage (false désactive aussi la
+                 *        compression)
+                 */
+                void SetBackgroundRotation(bool enabled);
+                
+                /**
+                 * @brief Indique si la rotation de fond est active
+                 */
+                bool IsBackgroundRotation() const;
+                
+                /**
+                 * @brief Compresse les sauvegardes en gzip sur le thread de fond
+                 * @param enabled true pour compresser (active la rotation de fond)
+                 * @param level Niveau DEFLATE 1 à 9
+                 */
+                void SetCompression(bool enabled, int level = DeflateEncoder::DEFAULT_LEVEL);
+                
+                /**
+                 * @brief Indique si les sauvegardes sont compressées
+                 */
+                bool IsCompressionEnabled() const;
+                
+                /**
+                 * @brief Attend la fin des rotations de fond en attente
+                 */
+                void WaitForBackgroundWork();
 
             private:
                 // ---------------------------------------------------------------------
@@ -92,16 +131,29 @@ namespace nkentseu {
                 void CheckRotation() override;
                 
                 /**
-                 * @brief Effectue la rotation des fichiers
+                 * @brief Effectue la rotation des fichiers (verrou tenu)
+                 * @return true si le nouveau fichier est ouvert
+                 */
+                bool PerformRotation();
+                
+                /**
+                 * @brief Fait glisser les sauvegardes puis installe la nouvelle
+                 * @param path Fichier courant
+                 * @param rotated Fichier à installer en sauvegarde .0
+                 * @param maxFiles Nombre de sauvegardes conservées
+                 * @param compressionLevel Niveau gzip de la nouvelle sauvegarde
+                 *        (0: sans compression)
                  */
-                void PerformRotation();
+                static void ShiftBackups(const std::string& path, const std::string& rotated,
+                                         size_t maxFiles, int compressionLevel);
                 
                 /**
                  * @brief Génère le nom de fichier pour un index donné
+                 * @param path Fichier courant
                  * @param index Index du fichier
                  * @return Nom de fichier
                  */
-                std::string GetFilenameForIndex(size_t index) const;
+                static std::string GetFilenameForIndex(const std::string& path, size_t index);
                 
                 // ---------------------------------------------------------------------
                 // VARIABLES MEMBRE PRIVÉES
@@ -113,8 +165,14 @@ namespace nkentseu {
                 /// Nombre maximum de fichiers conservés
                 size_t m_MaxFiles;
                 
-                /// Taille courante du fichier
-                size_t m_CurrentSize;
+                /// Rotations déjà confiées au thread de fond (noms d'attente uniques)
+                uint64 m_RotationCount;
+                
+                /// Niveau de compression des sauvegardes (0: sans compression)
+                int m_CompressionLevel;
+                
+                /// Thread de fond (nul: rotation sur le thread de log)
+                std::unique_ptr<FileMaintenance> m_Maintenance;
         };
 
     } // namespace logger
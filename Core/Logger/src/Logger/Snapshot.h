@@ -0,0 +1,144 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/Snapshot.h
+// DESCRIPTION: Cellule copy-on-write: les lecteurs obtiennent un instantané
+//              immuable sans verrou, les écrivains publient une nouvelle copie.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Logger/RingBuffer.h"
+#include <Nkentseu/Types.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        // -------------------------------------------------------------------------
+        // CLASSE: SnapshotCell
+        // DESCRIPTION: Valeur lue très souvent et modifiée rarement (liste de
+        //              sinks). Un lecteur incrémente le compteur de l'époque
+        //              courante puis charge le pointeur: deux opérations
+        //              atomiques, aucun mutex. Un écrivain copie l'instantané,
+        //              le modifie, échange le pointeur puis attend que les deux
+        //              compteurs d'époque se vident avant de libérer l'ancien.
+        //              Les écritures sont sérialisées par un mutex interne.
+        //
+        //              Un lecteur ne doit pas modifier la cellule qu'il lit
+        //              (l'écrivain attendrait sa propre lecture).
+        // -------------------------------------------------------------------------
+        template <typename T>
+        class SnapshotCell {
+            public:
+                // ---------------------------------------------------------------------
+                // CLASSE: Reader
+                // DESCRIPTION: Garde l'instantané courant vivant pendant sa portée
+                // ---------------------------------------------------------------------
+                class Reader {
+                    public:
+                        explicit Reader(const SnapshotCell& cell) {
+                            const uint64 epoch = cell.m_Epoch.load(std::memory_order_seq_cst);
+                            m_Readers = &cell.m_Readers[epoch & 1].count;
+                            m_Readers->fetch_add(1, std::memory_order_seq_cst);
+                            m_Value = cell.m_Current.load(std::memory_order_seq_cst);
+                        }
+
+                        ~Reader() {
+                            m_Readers->fetch_sub(1, std::memory_order_release);
+                        }
+
+                        Reader(const Reader&) = delete;
+                        Reader& operator=(const Reader&) = delete;
+
+                        const T& operator*() const { return *m_Value; }
+                        const T* operator->() const { return m_Value; }
+                        const T* Get() const { return m_Value; }
+
+                    private:
+                        const T* m_Value;
+                        std::atomic<uint32>* m_Readers;
+                };
+
+                // ---------------------------------------------------------------------
+                // CONSTRUCTEURS ET DESTRUCTEUR
+                // ---------------------------------------------------------------------
+
+                SnapshotCell()
+                    : m_Current(new T())
+                    , m_Epoch(0) {
+                }
+
+                ~SnapshotCell() {
+                    delete m_Current.load(std::memory_order_relaxed);
+                }
+
+                SnapshotCell(const SnapshotCell&) = delete;
+                SnapshotCell& operator=(const SnapshotCell&) = delete;
+
+                // ---------------------------------------------------------------------
+                // ÉCRITURE (rare, sérialisée)
+                // ---------------------------------------------------------------------
+
+                /**
+                 * @brief Copie l'instantané, le modifie puis publie la copie
+                 * @param mutate Fonction appelée avec la copie (T&)
+                 *
+                 * Retourne après que plus aucun lecteur n'utilise l'ancien
+                 * instantané, qui est alors libéré.
+                 */
+                template <typename Mutate>
+                void Update(Mutate&& mutate) {
+                    std::lock_guard<std::mutex> lock(m_WriteMutex);
+                    std::unique_ptr<T> next(new T(*m_Current.load(std::memory_order_relaxed)));
+                    mutate(*next);
+                    Retire(m_Current.exchange(next.release(), std::memory_order_seq_cst));
+                }
+
+            private:
+                /**
+                 * @brief Attend la fin des lectures en cours puis libère l'ancien
+                 *
+                 * Tout lecteur qui a pu charger l'ancien pointeur a incrémenté
+                 * un compteur avant l'échange: vider les deux suffit. Avancer
+                 * l'époque avant chaque attente dirige les nouveaux lecteurs vers
+                 * l'autre compteur, l'attente ne peut donc pas être affamée.
+                 */
+                void Retire(const T* previous) {
+                    for (int round = 0; round < 2; ++round) {
+                        const uint64 epoch = m_Epoch.fetch_add(1, std::memory_order_seq_cst);
+                        std::atomic<uint32>& readers = m_Readers[epoch & 1].count;
+                        while (readers.load(std::memory_order_acquire) != 0) {
+                            std::this_thread::yield();
+                        }
+                    }
+                    delete previous;
+                }
+
+                /// Compteur de lecteurs d'une époque, seul sur sa ligne de cache
+                struct alignas(LOGGER_CACHE_LINE_SIZE) ReaderCount {
+                    std::atomic<uint32> count{0};
+                };
+
+                /// Instantané courant
+                std::atomic<const T*> m_Current;
+
+                /// Époque courante (sa parité choisit le compteur des lecteurs)
+                std::atomic<uint64> m_Epoch;
+
+                /// Lecteurs en cours, par parité d'époque
+                mutable ReaderCount m_Readers[2];
+
+                /// Sérialise les écrivains
+                std::mutex m_WriteMutex;
+        };
+
+    } // namespace logger
+} // namespace nkentseu
@@ -0,0 +1,56 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/SourceLocation.h
+// DESCRIPTION: Emplacement source d'un appel de log, transporté par valeur.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Nkentseu/Types.h>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        // -------------------------------------------------------------------------
+        // STRUCTURE: SourceLocation
+        // DESCRIPTION: Fichier, ligne et fonction d'un appel. Deux pointeurs vers
+        //              des chaînes statiques (__FILE__, __FUNCTION__) et un
+        //              entier: copié avec l'appel, jamais stocké dans le logger.
+        // -------------------------------------------------------------------------
+        struct SourceLocation {
+            /// Fichier source (chaîne statique, jamais nullptr)
+            const char* file;
+
+            /// Ligne source (0 si inconnue)
+            uint32 line;
+
+            /// Fonction source (chaîne statique, jamais nullptr)
+            const char* function;
+
+            /**
+             * @brief Emplacement inconnu
+             */
+            constexpr SourceLocation()
+                : file(""), line(0), function("") {
+            }
+
+            /**
+             * @brief Emplacement donné (nullptr remplacé par "")
+             */
+            constexpr SourceLocation(const char* sourceFile, uint32 sourceLine, const char* functionName)
+                : file(sourceFile ? sourceFile : "")
+                , line(sourceLine)
+                , function(functionName ? functionName : "") {
+            }
+        };
+
+    } // namespace logger
+} // namespace nkentseu
+
+/// Emplacement de l'appelant
+#define NK_SOURCE_LOCATION \
+    ::nkentseu::logger::SourceLocation(__FILE__, static_cast<::nkentseu::uint32>(__LINE__), __FUNCTION__)
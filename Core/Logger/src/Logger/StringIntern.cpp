@@ -0,0 +1,50 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/StringIntern.cpp
+// DESCRIPTION: Implémentation de la table de chaînes internées.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#include "Logger/StringIntern.h"
+#include <mutex>
+#include <unordered_set>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        namespace {
+
+            /// Table des chaînes (les nœuds ne sont jamais supprimés ni déplacés)
+            struct InternTable {
+                std::mutex mutex;
+                std::unordered_set<std::string> strings;
+            };
+
+            InternTable& GetInternTable() {
+                static InternTable* table = new InternTable(); // Jamais détruite
+                return *table;
+            }
+
+        } // namespace
+
+        /**
+         * @brief Interne une chaîne
+         */
+        const char* InternString(const std::string& text) {
+            InternTable& table = GetInternTable();
+            std::lock_guard<std::mutex> lock(table.mutex);
+            return table.strings.insert(text).first->c_str();
+        }
+
+        /**
+         * @brief Interne une chaîne C
+         */
+        const char* InternString(const char* text) {
+            return InternString(std::string(text ? text : ""));
+        }
+
+    } // namespace logger
+} // namespace nkentseu
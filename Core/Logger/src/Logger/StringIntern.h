@@ -0,0 +1,38 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/StringIntern.h
+// DESCRIPTION: Table globale de chaînes internées (noms de loggers, de threads)
+//              dont l'adresse reste valide jusqu'à la fin du programme.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Logger/Export.h"
+#include <string>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        /**
+         * @brief Interne une chaîne
+         * @param text Chaîne à interner
+         * @return Pointeur stable, identique pour deux chaînes égales
+         *
+         * À appeler hors du chemin critique (configuration d'un logger, nommage
+         * d'un thread): la première insertion d'une chaîne alloue.
+         */
+        LOGGER_API const char* InternString(const std::string& text);
+
+        /**
+         * @brief Interne une chaîne C
+         * @param text Chaîne à interner (nullptr donne "")
+         * @return Pointeur stable
+         */
+        LOGGER_API const char* InternString(const char* text);
+
+    } // namespace logger
+} // namespace nkentseu
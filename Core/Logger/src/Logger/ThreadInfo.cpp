@@ -0,0 +1,76 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/ThreadInfo.cpp
+// DESCRIPTION: Cache thread_local de l'identité du thread courant.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#include "Logger/ThreadInfo.h"
+#include <atomic>
+#include <cstring>
+
+#if defined(__APPLE__) || defined(__linux__)
+    #include <pthread.h>
+#endif
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        namespace {
+
+            /// Prochain index attribué (0 réservé)
+            std::atomic<uint32> s_NextThreadIndex(1);
+
+            // ---------------------------------------------------------------------
+            // STRUCTURE: ThreadInfoCache
+            // DESCRIPTION: Remplit l'identité du thread à sa construction
+            //              (premier usage de t_ThreadInfo dans ce thread)
+            // ---------------------------------------------------------------------
+            struct ThreadInfoCache {
+                ThreadInfo info;
+
+                ThreadInfoCache() {
+                    info.index = s_NextThreadIndex.fetch_add(1, std::memory_order_relaxed);
+                    info.name[0] = '\0';
+
+                    #if defined(__APPLE__) || defined(__linux__)
+                        if (pthread_getname_np(pthread_self(), info.name, sizeof(info.name)) != 0) {
+                            info.name[0] = '\0';
+                        }
+                    #endif
+                }
+            };
+
+            thread_local ThreadInfoCache t_ThreadInfo;
+
+        } // namespace
+
+        /**
+         * @brief Identité du thread courant
+         */
+        const ThreadInfo& GetCurrentThreadInfo() {
+            return t_ThreadInfo.info;
+        }
+
+        /**
+         * @brief Nomme le thread courant pour les logs et pour le système
+         */
+        void SetCurrentThreadName(const char* name) {
+            ThreadInfo& info = t_ThreadInfo.info;
+            if (!name) name = "";
+
+            std::strncpy(info.name, name, ThreadInfo::NAME_CAPACITY - 1);
+            info.name[ThreadInfo::NAME_CAPACITY - 1] = '\0';
+
+            #if defined(__linux__)
+                pthread_setname_np(pthread_self(), info.name);
+            #elif defined(__APPLE__)
+                pthread_setname_np(info.name);
+            #endif
+        }
+
+    } // namespace logger
+} // namespace nkentseu
@@ -0,0 +1,59 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/src/Logger/ThreadInfo.h
+// DESCRIPTION: Identité du thread courant (index et nom), mise en cache par
+//              thread au premier usage et recopiée dans chaque message.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Logger/Export.h"
+#include <Nkentseu/Types.h>
+#include <cstddef>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+
+        // -------------------------------------------------------------------------
+        // STRUCTURE: ThreadInfo
+        // DESCRIPTION: Identité d'un thread vue par le logger. L'index est un
+        //              petit entier attribué dans l'ordre du premier log (1, 2,
+        //              3...), stable pour la durée de vie du thread. Le nom est
+        //              lu une seule fois auprès du système puis mis à jour par
+        //              SetCurrentThreadName().
+        // -------------------------------------------------------------------------
+        struct ThreadInfo {
+            /// Capacité du nom ('\0' compris, limite de pthread)
+            static constexpr size_t NAME_CAPACITY = 16;
+
+            /// Index du thread (0 réservé: thread inconnu)
+            uint32 index;
+
+            /// Nom du thread (vide si aucun)
+            char name[NAME_CAPACITY];
+        };
+
+        /**
+         * @brief Identité du thread courant
+         * @return Référence vers le cache du thread (valide jusqu'à sa fin)
+         *
+         * Le premier appel attribue l'index et lit le nom système; les
+         * suivants ne font qu'un accès thread_local.
+         */
+        LOGGER_API const ThreadInfo& GetCurrentThreadInfo();
+
+        /**
+         * @brief Nomme le thread courant pour les logs et pour le système
+         * @param name Nouveau nom (tronqué à NAME_CAPACITY - 1, nullptr = vide)
+         *
+         * À préférer à pthread_setname_np: un nom donné directement au système
+         * après le premier log de ce thread n'est pas relu.
+         */
+        LOGGER_API void SetCurrentThreadName(const char* name);
+
+    } // namespace logger
+} // namespace nkentseu
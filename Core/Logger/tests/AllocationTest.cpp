@@ -0,0 +1,157 @@
+#include <Logger/Logger.h>
+#include <Logger/MessageBuffer.h>
+#include <Logger/Sinks/AsyncSink.h>
+#include <Logger/Sinks/NullSink.h>
+#include <Unitest/Unitest.h>
+#include "TestSinks.h"
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+
+// -----------------------------------------------------------------------------
+// Comptage des allocations du thread courant (operator new global remplacé)
+// -----------------------------------------------------------------------------
+namespace {
+
+    thread_local bool t_CountAllocations = false;
+    thread_local size_t t_AllocationCount = 0;
+
+    // Compte les allocations faites pendant la durée de vie de l'objet
+    class AllocationScope {
+        public:
+            AllocationScope() { t_AllocationCount = 0; t_CountAllocations = true; }
+            ~AllocationScope() { t_CountAllocations = false; }
+            size_t Count() const { return t_AllocationCount; }
+    };
+
+    // Logger dont le renommage (protégé) est accessible au test
+    class RenamableLogger : public nkentseu::logger::Logger {
+        public:
+            using nkentseu::logger::Logger::Logger;
+            using nkentseu::logger::Logger::SetName;
+    };
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    if (t_CountAllocations) ++t_AllocationCount;
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    operator delete(p);
+}
+
+// -----------------------------------------------------------------------------
+// MessageBuffer
+// -----------------------------------------------------------------------------
+
+TEST_CASE(Logger, MessageBuffer_ShortTextStaysInline) {
+    nkentseu::logger::MessageBuffer buffer;
+    {
+        AllocationScope scope;
+        buffer.Assign("hello", 5);
+        ASSERT_EQUAL(0u, scope.Count());
+    }
+    ASSERT_TRUE(buffer.IsInline());
+    ASSERT_EQUAL(std::string("hello"), buffer.ToString());
+}
+
+TEST_CASE(Logger, MessageBuffer_LongTextSpillsAndMoves) {
+    const std::string text(1000, 'x');
+    nkentseu::logger::MessageBuffer buffer(text);
+    ASSERT_FALSE(buffer.IsInline());
+
+    const char* block = buffer.Data();
+    nkentseu::logger::MessageBuffer moved(std::move(buffer));
+    ASSERT_EQUAL(block, moved.Data());
+    ASSERT_EQUAL(text, moved.ToString());
+    ASSERT_TRUE(buffer.IsEmpty());
+    ASSERT_TRUE(buffer.IsInline());
+}
+
+// -----------------------------------------------------------------------------
+// Chemin critique des loggers
+// -----------------------------------------------------------------------------
+
+TEST_CASE(Logger, Allocation_SyncLoggerHotPathIsAllocationFree) {
+    nkentseu::logger::Logger logger("alloc-sync");
+    logger.AddSink(std::make_shared<nkentseu::logger::NullSink>());
+    logger.SetLevel(nkentseu::logger::LogLevel::Trace);
+    logger.Source(__FILE__, __LINE__, __FUNCTION__).Info("warm-up %d", 0);
+
+    AllocationScope scope;
+    for (int i = 0; i < 1000; ++i) {
+        logger.Source(__FILE__, __LINE__, __FUNCTION__).Info("player %d moved to (%f, %f)", i, 1.5, 2.5);
+        logger.Log(nkentseu::logger::LogLevel::Warn, __FILE__, __LINE__, __FUNCTION__, "frame %d", i);
+    }
+    ASSERT_EQUAL(0u, scope.Count());
+}
+
+TEST_CASE(Logger, Allocation_LongMessagesReuseArenaBlocks) {
+    nkentseu::logger::Logger logger("alloc-long");
+    logger.AddSink(std::make_shared<nkentseu::logger::NullSink>());
+    const std::string padding(2000, '-');
+    logger.Info("%s", padding.c_str()); // Premier slab de l'arène
+
+    AllocationScope scope;
+    for (int i = 0; i < 100; ++i) {
+        logger.Info("%d %s", i, padding.c_str());
+    }
+    ASSERT_EQUAL(0u, scope.Count());
+}
+
+TEST_CASE(Logger, Allocation_AsyncEnqueueIsAllocationFree) {
+    nkentseu::logger::AsyncLogger logger("alloc-async", 1024);
+    logger.AddSink(std::make_shared<nkentseu::logger::NullSink>());
+
+    {
+        AllocationScope scope;
+        for (int i = 0; i < 500; ++i) {
+            logger.Info("queued message %d", i);
+        }
+        ASSERT_EQUAL(0u, scope.Count());
+    }
+
+    ASSERT_EQUAL(500u, logger.GetQueueSize());
+    logger.Flush();
+    ASSERT_EQUAL(0u, logger.GetQueueSize());
+}
+
+// -----------------------------------------------------------------------------
+// Noms internés
+// -----------------------------------------------------------------------------
+
+TEST_CASE(Logger, InternedName_RenameWhileLogging) {
+    RenamableLogger logger("before");
+    auto sink = std::make_shared<nkentseu::logger::test::RecordingSink>();
+    logger.AddSink(sink);
+
+    std::atomic<bool> done(false);
+    std::thread writer([&] {
+        for (int i = 0; i < 2000; ++i) {
+            logger.Info("message %d", i);
+        }
+        done = true;
+    });
+    for (int i = 0; !done.load(); ++i) {
+        logger.SetName(i % 2 == 0 ? "after" : "before");
+    }
+    writer.join();
+
+    // Chaque message porte l'un des deux noms, jamais une chaîne incomplète
+    ASSERT_EQUAL(2000u, sink->Count());
+    for (const nkentseu::logger::LogMessage& message : sink->Messages()) {
+        ASSERT_TRUE(std::strcmp(message.loggerName, "before") == 0 ||
+                    std::strcmp(message.loggerName, "after") == 0);
+    }
+}
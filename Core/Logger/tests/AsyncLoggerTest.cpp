@@ -0,0 +1,255 @@
+#include <Logger/Sinks/AsyncSink.h>
+#include <Unitest/Unitest.h>
+#include "TestSinks.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    using nkentseu::logger::test::RecordingSink;
+
+    // Sink qui bloque chaque écriture tant que la porte est fermée
+    class GateSink : public RecordingSink {
+        public:
+            void Log(const nkentseu::logger::LogMessage& message) override {
+                {
+                    std::unique_lock<std::mutex> lock(m_GateMutex);
+                    m_Gate.wait(lock, [this] { return m_Open; });
+                }
+                RecordingSink::Log(message);
+            }
+
+            void Open() {
+                {
+                    std::lock_guard<std::mutex> lock(m_GateMutex);
+                    m_Open = true;
+                }
+                m_Gate.notify_all();
+            }
+
+        private:
+            std::mutex m_GateMutex;
+            std::condition_variable m_Gate;
+            bool m_Open = false;
+    };
+
+    // Sink lent qui note, à chaque Flush, le nombre de messages déjà écrits
+    class FlushTrackingSink : public RecordingSink {
+        public:
+            void Log(const nkentseu::logger::LogMessage& message) override {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+                RecordingSink::Log(message);
+            }
+            void Flush() override {
+                flushedCount = Count();
+                flushThread = std::this_thread::get_id();
+            }
+
+            std::atomic<size_t> flushedCount{0};
+            std::thread::id flushThread;
+    };
+
+    // Remplit la file d'un logger non démarré (aucun consommateur actif)
+    void FillQueue(nkentseu::logger::AsyncLogger& logger, int count) {
+        for (int i = 0; i < count; ++i) {
+            logger.Log(nkentseu::logger::LogLevel::Info, "msg " + std::to_string(i));
+        }
+    }
+
+} // namespace
+
+TEST_CASE(Logger, AsyncLogger_DeliversAllMessages) {
+    nkentseu::logger::AsyncLogger logger("async", 64);
+    auto sink = std::make_shared<RecordingSink>();
+    logger.AddSink(sink);
+    logger.Start();
+
+    FillQueue(logger, 50);
+    logger.Stop();
+
+    ASSERT_EQUAL(50u, sink->Count());
+    ASSERT_EQUAL(std::string("msg 0"), sink->Texts().front());
+    ASSERT_EQUAL(std::string("msg 49"), sink->Texts().back());
+}
+
+TEST_CASE(Logger, AsyncLogger_DropNewestCountsDrops) {
+    nkentseu::logger::AsyncLogger logger("async", 4);
+    auto sink = std::make_shared<RecordingSink>();
+    logger.AddSink(sink);
+    logger.SetOverflowPolicy(nkentseu::logger::OverflowPolicy::DropNewest);
+
+    FillQueue(logger, 10);
+    logger.Flush();
+
+    auto stats = logger.GetOverflowStats();
+    ASSERT_EQUAL(6u, stats.dropped);
+    ASSERT_EQUAL(0u, stats.overwritten);
+    ASSERT_EQUAL(4u, sink->Count());
+    ASSERT_EQUAL(std::string("msg 0"), sink->Texts().front());
+}
+
+TEST_CASE(Logger, AsyncLogger_DropOldestKeepsNewest) {
+    nkentseu::logger::AsyncLogger logger("async", 4);
+    auto sink = std::make_shared<RecordingSink>();
+    logger.AddSink(sink);
+    logger.SetOverflowPolicy(nkentseu::logger::OverflowPolicy::DropOldest);
+
+    FillQueue(logger, 10);
+    logger.Flush();
+
+    auto stats = logger.GetOverflowStats();
+    ASSERT_EQUAL(6u, stats.overwritten);
+    ASSERT_EQUAL(0u, stats.dropped);
+    ASSERT_EQUAL(4u, sink->Count());
+    ASSERT_EQUAL(std::string("msg 6"), sink->Texts().front());
+    ASSERT_EQUAL(std::string("msg 9"), sink->Texts().back());
+}
+
+TEST_CASE(Logger, AsyncLogger_BlockTimesOut) {
+    nkentseu::logger::AsyncLogger logger("async", 4);
+    logger.AddSink(std::make_shared<RecordingSink>());
+    logger.SetOverflowPolicy(nkentseu::logger::OverflowPolicy::Block);
+    logger.SetBlockTimeout(1);
+
+    FillQueue(logger, 6);
+
+    auto stats = logger.GetOverflowStats();
+    ASSERT_EQUAL(2u, stats.blockTimeouts);
+    ASSERT_EQUAL(2u, stats.dropped);
+
+    logger.ResetOverflowStats();
+    ASSERT_EQUAL(0u, logger.GetOverflowStats().GetTotalLost());
+}
+
+TEST_CASE(Logger, AsyncLogger_SampleUnderPressure) {
+    nkentseu::logger::AsyncLogger logger("async", 16);
+    auto sink = std::make_shared<RecordingSink>();
+    logger.AddSink(sink);
+    logger.SetOverflowPolicy(nkentseu::logger::OverflowPolicy::Sample);
+    logger.SetSampleRate(4);
+
+    // 12 messages passent avant la pression (3/4 de 16), puis 1 sur 4
+    FillQueue(logger, 12 + 8);
+
+    auto stats = logger.GetOverflowStats();
+    ASSERT_EQUAL(6u, stats.sampledOut);
+    ASSERT_EQUAL(0u, stats.dropped);
+
+    logger.Flush();
+    ASSERT_EQUAL(14u, sink->Count());
+}
+
+TEST_CASE(Logger, AsyncLogger_SinkGroupsReceiveEveryMessage) {
+    nkentseu::logger::AsyncLogger logger("async", 32);
+    auto first = std::make_shared<RecordingSink>();
+    auto second = std::make_shared<RecordingSink>();
+    logger.AddSink(first);
+    ASSERT_TRUE(logger.AddSinkGroup({ second }, nkentseu::logger::SinkGroupPolicy::Block));
+    ASSERT_EQUAL(2u, logger.GetSinkGroupCount());
+    logger.SetOverflowPolicy(nkentseu::logger::OverflowPolicy::Block);
+    logger.SetBlockTimeout(1000);
+    logger.Start();
+
+    // Groupes fixés une fois démarré
+    ASSERT_FALSE(logger.AddSinkGroup({ std::make_shared<RecordingSink>() }));
+
+    FillQueue(logger, 500);
+    logger.Stop();
+
+    ASSERT_EQUAL(500u, first->Count());
+    ASSERT_EQUAL(500u, second->Count());
+    ASSERT_EQUAL(std::string("msg 499"), second->Texts().back());
+    ASSERT_EQUAL(0u, logger.GetOverflowStats().GetTotalLost());
+}
+
+TEST_CASE(Logger, AsyncLogger_BlockedGroupDoesNotStallOthers) {
+    nkentseu::logger::AsyncLogger logger("async", 64);
+    auto fast = std::make_shared<RecordingSink>();
+    auto slow = std::make_shared<GateSink>();
+    logger.AddSink(fast);
+    ASSERT_TRUE(logger.AddSinkGroup({ slow }, nkentseu::logger::SinkGroupPolicy::DropWhenBehind));
+    logger.SetOverflowPolicy(nkentseu::logger::OverflowPolicy::Block);
+    logger.SetBlockTimeout(1000);
+    logger.Start();
+
+    // Le sink lent est bloqué dès son premier message
+    const int count = 1000;
+    FillQueue(logger, count);
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (fast->Count() < static_cast<size_t>(count) && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_EQUAL(static_cast<size_t>(count), fast->Count());
+    ASSERT_EQUAL(0u, logger.GetOverflowStats().GetTotalLost());
+
+    slow->Open();
+    logger.Stop();
+
+    const nkentseu::logger::SinkGroupStats stats = logger.GetSinkGroupStats(1);
+    ASSERT_TRUE(stats.skipped > 0);
+    ASSERT_EQUAL(static_cast<nkentseu::uint64>(count), stats.skipped + slow->Count());
+    ASSERT_EQUAL(std::string("msg 999"), slow->Texts().back());
+}
+
+TEST_CASE(Logger, AsyncLogger_FlushIsABarrier) {
+    nkentseu::logger::AsyncLogger logger("async", 256);
+    auto sink = std::make_shared<FlushTrackingSink>();
+    logger.AddSink(sink);
+    logger.Start();
+
+    FillQueue(logger, 200);
+    logger.Flush();
+
+    // Tout est écrit puis vidé par le thread de traitement, dans l'ordre
+    ASSERT_EQUAL(200u, sink->Count());
+    ASSERT_EQUAL(200u, sink->flushedCount.load());
+    ASSERT_TRUE(sink->flushThread != std::this_thread::get_id());
+    ASSERT_EQUAL(std::string("msg 0"), sink->Texts().front());
+    ASSERT_EQUAL(std::string("msg 199"), sink->Texts().back());
+
+    logger.Stop();
+}
+
+TEST_CASE(Logger, AsyncLogger_FlushDeadlineOnBlockedGroup) {
+    nkentseu::logger::AsyncLogger logger("async", 64);
+    auto fast = std::make_shared<RecordingSink>();
+    auto slow = std::make_shared<GateSink>();
+    logger.AddSink(fast);
+    ASSERT_TRUE(logger.AddSinkGroup({ slow }));
+    logger.Start();
+
+    FillQueue(logger, 10);
+
+    const auto start = std::chrono::steady_clock::now();
+    ASSERT_FALSE(logger.Flush(20));
+    ASSERT_TRUE(std::chrono::steady_clock::now() - start < std::chrono::seconds(5));
+
+    slow->Open();
+    ASSERT_TRUE(logger.Flush(5000));
+    ASSERT_EQUAL(10u, fast->Count());
+    ASSERT_EQUAL(10u, slow->Count());
+
+    logger.Stop();
+}
+
+TEST_CASE(Logger, AsyncLogger_StopDrainsWithoutStart) {
+    auto sink = std::make_shared<RecordingSink>();
+    {
+        nkentseu::logger::AsyncLogger logger("async", 64);
+        logger.AddSink(sink);
+        FillQueue(logger, 20);
+        logger.Stop();
+        ASSERT_EQUAL(20u, sink->Count());
+
+        // Le destructeur écrit aussi ce qui reste en file
+        FillQueue(logger, 5);
+    }
+    ASSERT_EQUAL(25u, sink->Count());
+}
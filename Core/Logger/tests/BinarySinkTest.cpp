@@ -0,0 +1,157 @@
+#include <Logger/BinaryLog.h>
+#include <Logger/DeferredFormat.h>
+#include <Logger/Sinks/AsyncSink.h>
+#include <Logger/Sinks/BinarySink.h>
+#include <Unitest/Unitest.h>
+#include "TestHelpers.h"
+#include "TestSinks.h"
+#include <filesystem>
+#include <memory>
+#include <string>
+
+namespace {
+
+    using nkentseu::logger::test::TempFile;
+
+    size_t CountOccurrences(const std::string& text, const std::string& needle) {
+        size_t count = 0;
+        for (size_t pos = text.find(needle); pos != std::string::npos; pos = text.find(needle, pos + 1)) {
+            ++count;
+        }
+        return count;
+    }
+
+} // namespace
+
+TEST_CASE(Logger, BinarySink_RoundTripMatchesTextFormatting) {
+    TempFile file("nk_binary_roundtrip.nkb");
+    const char* pattern = "[%Y-%m-%d %H:%M:%S.%e] [%n] [%L] [%T] %v (%s:%# %F)";
+
+    nkentseu::logger::LogMessage original(nkentseu::logger::LogLevel::Warn, "disk at 91%",
+                                          "src/Storage.cpp", 42, "CheckDisk", "storage");
+    original.SetThreadName("io-worker");
+    {
+        nkentseu::logger::BinarySink sink(file.path, true);
+        sink.SetPattern(pattern);
+        sink.Log(original);
+    }
+
+    nkentseu::logger::BinaryLogReader reader(file.path);
+    ASSERT_TRUE(reader.IsOpen());
+
+    nkentseu::logger::LogMessage decoded;
+    ASSERT_TRUE(reader.Next(decoded));
+    ASSERT_EQUAL(std::string(pattern), reader.GetPattern());
+    ASSERT_EQUAL(original.timestamp, decoded.timestamp);
+    ASSERT_EQUAL(original.threadId, decoded.threadId);
+    ASSERT_EQUAL(42u, decoded.sourceLine);
+
+    nkentseu::logger::Formatter formatter(pattern);
+    ASSERT_EQUAL(formatter.Format(original), formatter.Format(decoded));
+
+    ASSERT_FALSE(reader.Next(decoded));
+    ASSERT_FALSE(reader.HasError());
+}
+
+TEST_CASE(Logger, BinarySink_DeferredKeepsFormatAndArguments) {
+    TempFile file("nk_binary_deferred.nkb");
+    auto text = std::make_shared<nkentseu::logger::test::RecordingSink>();
+    {
+        auto sink = std::make_shared<nkentseu::logger::BinarySink>(file.path, true);
+        nkentseu::logger::AsyncLogger logger("binary-deferred", 256);
+        logger.SetOverflowPolicy(nkentseu::logger::OverflowPolicy::Block);
+        logger.AddSink(text);
+        logger.AddSink(sink);
+        logger.Start();
+
+        for (int i = 0; i < 3; ++i) {
+            logger.LogDeferred(nkentseu::logger::LogLevel::Info, __FILE__, __LINE__, __FUNCTION__,
+                               "frame %d took %.2f ms (%s)", i, 16.5, "vsync");
+        }
+        logger.Flush();
+    }
+
+    // Le sink texte reçoit le message formaté, le sink binaire le format brut
+    ASSERT_EQUAL(3u, text->Count());
+    ASSERT_EQUAL(std::string("frame 2 took 16.50 ms (vsync)"), text->Texts().back());
+
+    const std::string content = file.Read();
+    ASSERT_EQUAL(1u, CountOccurrences(content, "frame %d took %.2f ms (%s)"));
+    ASSERT_EQUAL(0u, CountOccurrences(content, "took 16.50"));
+
+    nkentseu::logger::BinaryLogReader reader(file.path);
+    nkentseu::logger::LogMessage decoded;
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(reader.Next(decoded));
+        ASSERT_TRUE(decoded.IsDeferred());
+
+        nkentseu::logger::MessageBuffer rendered;
+        nkentseu::logger::FormatDeferred(decoded.deferredFormat, decoded.message.Data(),
+                                         decoded.message.Size(), rendered);
+        ASSERT_EQUAL("frame " + std::to_string(i) + " took 16.50 ms (vsync)", rendered.ToString());
+    }
+    ASSERT_FALSE(reader.Next(decoded));
+    ASSERT_FALSE(reader.HasError());
+}
+
+TEST_CASE(Logger, BinarySink_StringsWrittenOncePerSegment) {
+    TempFile file("nk_binary_strings.nkb");
+    {
+        nkentseu::logger::BinarySink sink(file.path, true);
+        for (int i = 0; i < 100; ++i) {
+            sink.Log(nkentseu::logger::LogMessage(nkentseu::logger::LogLevel::Info, "tick",
+                                                  "src/GameLoop.cpp", 10, "Update", "gameplay"));
+        }
+    }
+
+    const std::string raw = file.Read();
+    ASSERT_EQUAL(1u, CountOccurrences(raw, "gameplay"));
+    ASSERT_EQUAL(1u, CountOccurrences(raw, "src/GameLoop.cpp"));
+    ASSERT_EQUAL(100u, CountOccurrences(raw, "tick"));
+}
+
+TEST_CASE(Logger, BinarySink_AppendStartsNewSegment) {
+    TempFile file("nk_binary_append.nkb");
+    {
+        nkentseu::logger::BinarySink sink(file.path, true);
+        sink.Log(nkentseu::logger::LogMessage(nkentseu::logger::LogLevel::Info, "first", "a"));
+    }
+    {
+        nkentseu::logger::BinarySink sink(file.path, false);
+        sink.Log(nkentseu::logger::LogMessage(nkentseu::logger::LogLevel::Error, "second", "b"));
+    }
+
+    nkentseu::logger::BinaryLogReader reader(file.path);
+    nkentseu::logger::LogMessage decoded;
+
+    ASSERT_TRUE(reader.Next(decoded));
+    ASSERT_EQUAL(std::string("first"), decoded.message.ToString());
+    ASSERT_EQUAL(std::string("a"), std::string(decoded.loggerName));
+
+    ASSERT_TRUE(reader.Next(decoded));
+    ASSERT_EQUAL(std::string("second"), decoded.message.ToString());
+    ASSERT_EQUAL(std::string("b"), std::string(decoded.loggerName));
+    ASSERT_TRUE(decoded.level == nkentseu::logger::LogLevel::Error);
+
+    ASSERT_FALSE(reader.Next(decoded));
+    ASSERT_FALSE(reader.HasError());
+}
+
+TEST_CASE(Logger, BinarySink_TruncatedTailStopsWithError) {
+    TempFile file("nk_binary_truncated.nkb");
+    {
+        nkentseu::logger::BinarySink sink(file.path, true);
+        for (int i = 0; i < 10; ++i) {
+            sink.Log(nkentseu::logger::LogMessage(nkentseu::logger::LogLevel::Info, "record", "t"));
+        }
+    }
+    std::filesystem::resize_file(file.path, std::filesystem::file_size(file.path) - 3);
+
+    nkentseu::logger::BinaryLogReader reader(file.path);
+    nkentseu::logger::LogMessage decoded;
+    while (reader.Next(decoded)) {
+    }
+
+    ASSERT_EQUAL(9u, reader.GetRecordCount());
+    ASSERT_TRUE(reader.HasError());
+}
@@ -0,0 +1,104 @@
+#include <Logger/Sinks/ConsoleSink.h>
+#include <Logger/LogLevel.h>
+#include <Unitest/Unitest.h>
+#include "TestHelpers.h"
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+#if !defined(_WIN32)
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace {
+
+    using nkentseu::logger::test::MakeMessage;
+
+#if !defined(_WIN32)
+    // Redirige stdout vers un fichier le temps du test
+    struct StdoutCapture {
+        StdoutCapture()
+            : path((std::filesystem::temp_directory_path() / "nk_console_capture.log").string()) {
+            std::fflush(stdout);
+            std::cout.flush();
+            saved = dup(STDOUT_FILENO);
+            const int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            dup2(fd, STDOUT_FILENO);
+            close(fd);
+        }
+        ~StdoutCapture() {
+            Restore();
+            std::remove(path.c_str());
+        }
+
+        void Restore() {
+            if (saved < 0) return;
+            std::cout.flush();
+            dup2(saved, STDOUT_FILENO);
+            close(saved);
+            saved = -1;
+        }
+
+        std::string Read() const { return nkentseu::logger::test::ReadFile(path); }
+
+        std::string path;
+        int saved = -1;
+    };
+#endif
+
+} // namespace
+
+TEST_CASE(Logger, ConsoleSink_PrerenderedColorCodes) {
+    using namespace nkentseu::logger;
+
+    const LogLevel levels[] = { LogLevel::Trace, LogLevel::Debug, LogLevel::Info, LogLevel::Warn,
+                                LogLevel::Error, LogLevel::Critical, LogLevel::Fatal };
+    for (LogLevel level : levels) {
+        ASSERT_EQUAL(std::string(LogLevelToANSIColor(level)), LogLevelToANSIColorCode(level));
+        // Même objet d'un appel à l'autre: rien n'est construit par ligne
+        ASSERT_TRUE(&LogLevelToANSIColorCode(level) == &LogLevelToANSIColorCode(level));
+    }
+    ASSERT_EQUAL(std::string("\033[0m"), ANSIResetCode());
+}
+
+#if !defined(_WIN32)
+TEST_CASE(Logger, ConsoleSink_BatchedOutputWritesOncePerBatch) {
+    using namespace nkentseu::logger;
+
+    std::string inBatch, afterBatch, beforeFlush, afterError, afterFlush;
+    {
+        StdoutCapture capture;
+        ConsoleSink sink(ConsoleStream::StdOut, false);
+        sink.SetPattern("%v");
+        sink.SetUseStderrForErrors(false);
+        sink.SetBatchedOutput(true);
+
+        // Lot asynchrone: rien n'est écrit avant EndBatch
+        sink.BeginBatch();
+        sink.Log(MakeMessage(LogLevel::Info, "a"));
+        sink.Log(MakeMessage(LogLevel::Debug, "b"));
+        inBatch = capture.Read();
+        sink.EndBatch();
+        afterBatch = capture.Read();
+
+        // Hors lot: les lignes attendent Flush (fin d'image), sauf une erreur
+        sink.Log(MakeMessage(LogLevel::Info, "c"));
+        beforeFlush = capture.Read();
+        sink.Log(MakeMessage(LogLevel::Error, "d"));
+        afterError = capture.Read();
+        sink.Log(MakeMessage(LogLevel::Info, "e"));
+        sink.Flush();
+        afterFlush = capture.Read();
+
+        capture.Restore();
+    }
+
+    ASSERT_EQUAL(std::string(), inBatch);
+    ASSERT_EQUAL(std::string("a\nb\n"), afterBatch);
+    ASSERT_EQUAL(std::string("a\nb\n"), beforeFlush);
+    ASSERT_EQUAL(std::string("a\nb\nc\nd\n"), afterError);
+    ASSERT_EQUAL(std::string("a\nb\nc\nd\ne\n"), afterFlush);
+}
+#endif
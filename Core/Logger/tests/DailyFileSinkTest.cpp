@@ -0,0 +1,96 @@
+#include <Logger/Sinks/DailyFileSink.h>
+#include <Logger/Deflate.h>
+#include <Logger/LogClock.h>
+#include <Unitest/Unitest.h>
+#include "TestHelpers.h"
+#include <ctime>
+#include <filesystem>
+#include <string>
+
+namespace {
+
+    using nkentseu::logger::test::MakeMessage;
+    using nkentseu::logger::test::TempDir;
+
+    // Suffixe .AAAAMMJJ de la date locale d'un instant (ns)
+    std::string DateSuffix(nkentseu::uint64 timestamp) {
+        const std::time_t time = static_cast<std::time_t>(timestamp / 1000000000ULL);
+        std::tm local = {};
+    #ifdef _WIN32
+        localtime_s(&local, &time);
+    #else
+        localtime_r(&time, &local);
+    #endif
+        char buffer[16];
+        std::strftime(buffer, sizeof(buffer), ".%Y%m%d", &local);
+        return buffer;
+    }
+
+    const nkentseu::uint64 NS_PER_DAY = 24ULL * 3600ULL * 1000000000ULL;
+
+} // namespace
+
+TEST_CASE(Logger, DailyFileSink_RotatesAtDeadline) {
+    TempDir dir("nk_daily_deadline");
+    const std::string path = dir.File("app.log");
+    {
+        nkentseu::logger::DailyFileSink sink(path);
+        sink.SetPattern("%v");
+
+        // Échéance précalculée: prochain minuit local, moins d'un jour plus tard
+        const nkentseu::uint64 deadline = sink.GetNextRotation();
+        ASSERT_TRUE(deadline > nkentseu::logger::LogClock::Now());
+        ASSERT_TRUE(deadline - nkentseu::logger::LogClock::Now() <= NS_PER_DAY + NS_PER_DAY / 24);
+
+        sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, "before", deadline - 1));
+        sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, "after", deadline));
+        sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, "later", deadline + 1));
+        sink.WaitForBackgroundWork();
+
+        // La ligne qui atteint l'échéance ouvre le nouveau fichier
+        ASSERT_TRUE(sink.GetNextRotation() > deadline);
+        ASSERT_EQUAL(std::string("before\n"), TempDir::Read(path + DateSuffix(deadline - 1)));
+    }
+    ASSERT_EQUAL(std::string("after\nlater\n"), TempDir::Read(path));
+}
+
+TEST_CASE(Logger, DailyFileSink_RetentionAndCompression) {
+    TempDir dir("nk_daily_retention");
+    const std::string path = dir.File("app.log");
+    const nkentseu::uint64 now = nkentseu::logger::LogClock::Now();
+
+    // Sauvegardes d'exécutions passées et fichiers étrangers
+    TempDir::Write(path + ".20000101", "old");
+    TempDir::Write(path + ".20000102.gz", "old");
+    TempDir::Write(path + DateSuffix(now - 2 * NS_PER_DAY), "recent");
+    TempDir::Write(path + ".notadate", "keep");
+    TempDir::Write(dir.File("other.log.20000101"), "keep");
+    {
+        nkentseu::logger::DailyFileSink sink(path, 0, 0, 7);
+        sink.SetPattern("%v");
+        sink.SetCompression(true);
+
+        // Deux rotations forcées le même jour: aucune sauvegarde remplacée
+        sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, "first", now));
+        ASSERT_TRUE(sink.Rotate());
+        sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, "second", now));
+        ASSERT_TRUE(sink.Rotate());
+        sink.WaitForBackgroundWork();
+    }
+
+    ASSERT_FALSE(std::filesystem::exists(path + ".20000101"));
+    ASSERT_FALSE(std::filesystem::exists(path + ".20000102.gz"));
+    ASSERT_TRUE(std::filesystem::exists(path + DateSuffix(now - 2 * NS_PER_DAY)));
+    ASSERT_TRUE(std::filesystem::exists(path + ".notadate"));
+    ASSERT_TRUE(std::filesystem::exists(dir.File("other.log.20000101")));
+
+    auto gunzip = [](const std::string& file) {
+        const std::string compressed = TempDir::Read(file);
+        std::string content;
+        return nkentseu::logger::GzipDecompress(compressed.data(), compressed.size(), content)
+            ? content : std::string("<invalide>");
+    };
+    const std::string dated = path + DateSuffix(now);
+    ASSERT_EQUAL(std::string("first\n"), gunzip(dated + ".gz"));
+    ASSERT_EQUAL(std::string("second\n"), gunzip(dated + ".1.gz"));
+}
@@ -0,0 +1,146 @@
+#include <Logger/DeferredFormat.h>
+#include <Logger/Sinks/AsyncSink.h>
+#include <Unitest/Unitest.h>
+#include "TestSinks.h"
+#include <climits>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+    using nkentseu::logger::test::RecordingSink;
+
+    // Vrai si un message est arrivé au sink sans être formaté
+    bool AnyDeferred(const RecordingSink& sink) {
+        for (const nkentseu::logger::LogMessage& message : sink.Messages()) {
+            if (message.IsDeferred()) return true;
+        }
+        return false;
+    }
+
+    enum class Stage : int { Load = 3 };
+
+    // Capture puis formate, comme le ferait le thread de traitement
+    template <typename... Args>
+    std::string Deferred(const char* format, const Args&... args) {
+        nkentseu::logger::MessageBuffer captured;
+        nkentseu::logger::deferred::Capture(captured, args...);
+
+        nkentseu::logger::MessageBuffer text;
+        nkentseu::logger::FormatDeferred(format, captured.Data(), captured.Size(), text);
+        return text.ToString();
+    }
+
+    template <typename... Args>
+    std::string Printf(const char* format, Args... args) {
+        char buffer[512];
+        std::snprintf(buffer, sizeof(buffer), format, args...);
+        return buffer;
+    }
+
+} // namespace
+
+TEST_CASE(Logger, DeferredFormat_MatchesPrintf) {
+    ASSERT_EQUAL(Printf("%d|%5d|%-5d|%05d|%+d", 42, -7, 3, 12, 9),
+                 Deferred("%d|%5d|%-5d|%05d|%+d", 42, -7, 3, 12, 9));
+    ASSERT_EQUAL(Printf("%u %x %X %#o", 4000000000u, 255u, 0xBEEFu, 8u),
+                 Deferred("%u %x %X %#o", 4000000000u, 255u, 0xBEEFu, 8u));
+    ASSERT_EQUAL(Printf("%lld %llu", LLONG_MIN, ULLONG_MAX),
+                 Deferred("%lld %llu", LLONG_MIN, ULLONG_MAX));
+    ASSERT_EQUAL(Printf("%.3f %10.2e %g", 3.14159, 12345.678, 0.5f),
+                 Deferred("%.3f %10.2e %g", 3.14159, 12345.678, 0.5f));
+    ASSERT_EQUAL(Printf("[%s] [%8s] [%-6.2s] %c %%", "abc", "right", "trunc", 'z'),
+                 Deferred("[%s] [%8s] [%-6.2s] %c %%", "abc", "right", "trunc", 'z'));
+    ASSERT_EQUAL(Printf("%*d|%-*.*f", 6, 42, 9, 2, 1.5),
+                 Deferred("%*d|%-*.*f", 6, 42, 9, 2, 1.5));
+
+    int value = 0;
+    ASSERT_EQUAL(Printf("%p", static_cast<void*>(&value)), Deferred("%p", &value));
+}
+
+TEST_CASE(Logger, DeferredFormat_UnsignedConversionsUseArgumentWidth) {
+    ASSERT_EQUAL(std::string("ffffffff 80004005 4294967295 fffe"),
+                 Deferred("%x %08X %u %hx", static_cast<int>(-1), static_cast<int>(0x80004005), -1,
+                          static_cast<short>(-2)));
+
+    // Un short négatif est promu en int, puis h et hh le tronquent comme printf
+    const short negative = -2;
+    const signed char tiny = -1;
+    ASSERT_EQUAL(Printf("%x %X %u %hu %hhx %o", negative, negative, negative, negative, tiny, tiny),
+                 Deferred("%x %X %u %hu %hhx %o", negative, negative, negative, negative, tiny, tiny));
+    ASSERT_EQUAL(Printf("%hd %hhd %hx", 70000, 300, 0x12345),
+                 Deferred("%hd %hhd %hx", 70000, 300, 0x12345));
+    ASSERT_EQUAL(Printf("%lx %llu %#llo", -1L, -1LL, -8LL),
+                 Deferred("%lx %llu %#llo", -1L, -1LL, -8LL));
+}
+
+TEST_CASE(Logger, DeferredFormat_PointerOfCString) {
+    const char* literal = "abc";
+    char buffer[] = "xyz";
+    const char* missing = nullptr;
+
+    ASSERT_EQUAL(Printf("%p %p %p", static_cast<const void*>(literal), static_cast<void*>(buffer),
+                        static_cast<const void*>(missing)),
+                 Deferred("%p %p %p", literal, buffer, missing));
+
+    // Le texte reste disponible pour %s; une chaîne C++ n'a pas d'adresse à afficher
+    ASSERT_EQUAL(std::string("abc xyz"), Deferred("%s %s", literal, buffer));
+    ASSERT_EQUAL(std::string("(?)"), Deferred("%p", std::string("abc")));
+}
+
+TEST_CASE(Logger, DeferredFormat_CapturesStringsAndEnums) {
+    std::string name = "player";
+    const char* missing = nullptr;
+
+    ASSERT_EQUAL(std::string("player stage=3 (null) ok 1"),
+                 Deferred("%s stage=%d %s %s %d", name, Stage::Load, missing,
+                          std::string_view("ok!", 2), true));
+
+    // Le type capturé fait foi: pas de comportement indéfini sur un mauvais modificateur
+    ASSERT_EQUAL(std::string("7 2.000 (?)"), Deferred("%ld %.3f %d", 7, 2, "text"));
+}
+
+TEST_CASE(Logger, DeferredFormat_MissingArgumentsKeepSpec) {
+    ASSERT_EQUAL(std::string("a=1 b=%5.1f c=%s"), Deferred("a=%d b=%5.1f c=%s", 1));
+    ASSERT_EQUAL(std::string("trailing %"), Deferred("trailing %"));
+    ASSERT_EQUAL(std::string("no args"), Deferred("no args"));
+}
+
+TEST_CASE(Logger, DeferredFormat_SyncLoggerMatchesEagerPath) {
+    nkentseu::logger::Logger logger("deferred");
+    auto sink = std::make_shared<RecordingSink>();
+    logger.AddSink(sink);
+
+    logger.Log(nkentseu::logger::LogLevel::Info, __FILE__, __LINE__, __FUNCTION__,
+               "frame %d took %.2f ms (%s)", 12, 16.67, "vsync");
+    logger.LogDeferred(nkentseu::logger::LogLevel::Info, __FILE__, __LINE__, __FUNCTION__,
+                       "frame %d took %.2f ms (%s)", 12, 16.67, "vsync");
+
+    ASSERT_EQUAL(2u, sink->Count());
+    ASSERT_EQUAL(sink->Texts()[0], sink->Texts()[1]);
+    ASSERT_FALSE(AnyDeferred(*sink));
+}
+
+TEST_CASE(Logger, DeferredFormat_AsyncCopiesArgumentsAtCallSite) {
+    nkentseu::logger::AsyncLogger logger("deferred-async", 256);
+    auto sink = std::make_shared<RecordingSink>();
+    logger.AddSink(sink);
+    logger.SetOverflowPolicy(nkentseu::logger::OverflowPolicy::Block);
+
+    // Logger non démarré: les messages restent capturés dans la file
+    using nkentseu::logger::LogLevel;
+    std::string label = "before";
+    for (int i = 0; i < 100; ++i) {
+        LOG_INFO_DEFERRED(&logger, "%s #%03d", label, i);
+    }
+    label = "after";
+
+    logger.Flush();
+
+    ASSERT_EQUAL(100u, sink->Count());
+    ASSERT_EQUAL(std::string("before #000"), sink->Texts().front());
+    ASSERT_EQUAL(std::string("before #099"), sink->Texts().back());
+    ASSERT_FALSE(AnyDeferred(*sink));
+}
@@ -0,0 +1,76 @@
+#include <Logger/Deflate.h>
+#include <Unitest/Unitest.h>
+#include <cstdio>
+#include <string>
+
+namespace {
+
+    // Texte de journal répétitif, proche d'un fichier tourné
+    std::string MakeLogText(size_t lines) {
+        std::string text;
+        char line[160];
+        for (size_t i = 0; i < lines; ++i) {
+            const int length = std::snprintf(line, sizeof(line),
+                "[2026-01-01 10:%02zu:%02zu.%03zu] [INFO] [worker-%zu] request %zu served in %zu us\n",
+                (i / 60000) % 60, (i / 1000) % 60, i % 1000, i % 7, i * 2654435761u % 100000, i % 997);
+            text.append(line, static_cast<size_t>(length));
+        }
+        return text;
+    }
+
+} // namespace
+
+TEST_CASE(Logger, Deflate_RoundTrip) {
+    using namespace nkentseu::logger;
+
+    const std::string text = MakeLogText(20000);
+    for (int level : { 1, DeflateEncoder::DEFAULT_LEVEL, 9 }) {
+        const std::string compressed = GzipCompress(text.data(), text.size(), level);
+        ASSERT_TRUE(compressed.size() * 4 < text.size());
+
+        std::string restored;
+        ASSERT_TRUE(GzipDecompress(compressed.data(), compressed.size(), restored));
+        ASSERT_TRUE(restored == text);
+    }
+
+    // Entrées minimales et non compressibles
+    std::string noise;
+    nkentseu::uint32 state = 1;
+    for (size_t i = 0; i < 70000; ++i) {
+        state = state * 1103515245u + 12345u;
+        noise.push_back(static_cast<char>(state >> 24));
+    }
+    for (const std::string& input : { std::string(), std::string("a"), std::string(300, 'z'), noise }) {
+        const std::string compressed = GzipCompress(input.data(), input.size());
+        std::string restored;
+        ASSERT_TRUE(GzipDecompress(compressed.data(), compressed.size(), restored));
+        ASSERT_TRUE(restored == input);
+    }
+}
+
+TEST_CASE(Logger, Deflate_StreamingAndCorruption) {
+    using namespace nkentseu::logger;
+
+    // Écriture par petits morceaux: même contenu restitué
+    const std::string text = MakeLogText(5000);
+    GzipEncoder encoder;
+    std::string compressed;
+    for (size_t offset = 0; offset < text.size(); offset += 777) {
+        const size_t size = text.size() - offset < 777 ? text.size() - offset : 777;
+        encoder.Write(text.data() + offset, size, compressed);
+    }
+    encoder.Finish(compressed);
+
+    std::string restored;
+    ASSERT_TRUE(GzipDecompress(compressed.data(), compressed.size(), restored));
+    ASSERT_TRUE(restored == text);
+
+    // Un octet altéré est détecté (flux invalide ou CRC)
+    compressed[compressed.size() / 2] ^= 0x10;
+    restored.clear();
+    ASSERT_FALSE(GzipDecompress(compressed.data(), compressed.size(), restored) && restored == text);
+
+    // Un flux tronqué est refusé
+    restored.clear();
+    ASSERT_FALSE(GzipDecompress(compressed.data(), compressed.size() - 4, restored));
+}
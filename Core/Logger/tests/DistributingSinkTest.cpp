@@ -0,0 +1,141 @@
+#include <Logger/Sinks/DistributingSink.h>
+#include <Unitest/Unitest.h>
+#include "TestSinks.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    using nkentseu::logger::test::RecordingSink;
+
+    // Sink bloqué tant que la porte est fermée
+    class GatedSink : public RecordingSink {
+        public:
+            explicit GatedSink(bool open = true)
+                : open(open) {
+            }
+
+            void Log(const nkentseu::logger::LogMessage& message) override {
+                while (!open.load()) {
+                    std::this_thread::sleep_for(std::chrono::microseconds(100));
+                }
+                RecordingSink::Log(message);
+            }
+            void Flush() override { flushes.fetch_add(1); }
+
+            std::atomic<bool> open;
+            std::atomic<nkentseu::uint64> flushes{0};
+    };
+
+    // Attend qu'un sink ait reçu un nombre de messages (au plus 5 s)
+    bool WaitForCount(const RecordingSink& sink, size_t expected) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (sink.Count() < expected) {
+            if (std::chrono::steady_clock::now() >= deadline) return false;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+
+} // namespace
+
+TEST_CASE(Logger, DistributingSink_SlowChildDoesNotBlockOthers) {
+    using namespace nkentseu::logger;
+
+    auto fast = std::make_shared<GatedSink>();
+    auto slow = std::make_shared<GatedSink>(false);
+    DistributingSink sink({fast, slow});
+    sink.SetParallel(true, 64);
+    ASSERT_TRUE(sink.IsParallel());
+
+    LogMessage message(LogLevel::Info, "fan-out", "test");
+    for (int i = 0; i < 32; ++i) {
+        sink.Log(message);
+    }
+
+    // Log a rendu la main et le sous-sink rapide avance seul
+    ASSERT_TRUE(WaitForCount(*fast, 32));
+    ASSERT_EQUAL(0u, slow->Count());
+
+    slow->open.store(true);
+    sink.Flush();
+    ASSERT_EQUAL(32u, slow->Count());
+    ASSERT_EQUAL(1u, slow->flushes.load());
+
+    std::vector<SubSinkStats> stats = sink.GetSinkStats();
+    ASSERT_EQUAL(2u, stats.size());
+    ASSERT_TRUE(stats[1].sink == slow);
+    ASSERT_EQUAL(32u, stats[0].messages);
+    ASSERT_EQUAL(32u, stats[1].messages);
+    ASSERT_EQUAL(0u, stats[1].pending);
+    ASSERT_TRUE(stats[1].maxLatency >= stats[0].maxLatency);
+
+    // Retour au mode séquentiel: les messages sont livrés pendant Log
+    sink.SetParallel(false);
+    sink.Log(message);
+    ASSERT_EQUAL(33u, fast->Count());
+    ASSERT_EQUAL(33u, slow->Count());
+}
+
+TEST_CASE(Logger, DistributingSink_DropWhenBehindCountsLosses) {
+    using namespace nkentseu::logger;
+
+    auto fast = std::make_shared<GatedSink>();
+    auto slow = std::make_shared<GatedSink>(false);
+    DistributingSink sink({fast, slow});
+    sink.SetParallel(true, 16);
+    sink.SetSinkPolicy(slow, SinkGroupPolicy::DropWhenBehind);
+
+    LogMessage message(LogLevel::Info, "burst", "test");
+    for (int i = 0; i < 200; ++i) {
+        sink.Log(message);
+    }
+
+    slow->open.store(true);
+    sink.Flush();
+
+    std::vector<SubSinkStats> stats = sink.GetSinkStats();
+    ASSERT_EQUAL(200u, fast->Count());
+    ASSERT_EQUAL(0u, stats[0].dropped);
+    ASSERT_TRUE(stats[1].dropped > 0);
+    ASSERT_EQUAL(200u, slow->Count() + stats[1].dropped);
+}
+
+TEST_CASE(Logger, DistributingSink_ChildrenChangeWhileLogging) {
+    using namespace nkentseu::logger;
+
+    auto stable = std::make_shared<GatedSink>();
+    DistributingSink sink({stable});
+    sink.SetParallel(true, 256);
+
+    std::vector<std::thread> producers;
+    for (int t = 0; t < 2; ++t) {
+        producers.emplace_back([&sink]() {
+            LogMessage message(LogLevel::Info, "concurrent", "test");
+            for (int i = 0; i < 5000; ++i) {
+                sink.Log(message);
+            }
+        });
+    }
+
+    for (int i = 0; i < 50; ++i) {
+        auto transient = std::make_shared<GatedSink>();
+        sink.AddSink(transient);
+        ASSERT_TRUE(sink.ContainsSink(transient));
+        sink.RemoveSink(transient);
+        ASSERT_FALSE(sink.ContainsSink(transient));
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    sink.Flush();
+
+    ASSERT_EQUAL(1u, sink.GetSinkCount());
+    ASSERT_EQUAL(10000u, stable->Count());
+    ASSERT_EQUAL(10000u, sink.GetSinkStats()[0].messages);
+}
@@ -0,0 +1,203 @@
+#include <Logger/Sinks/AsyncSink.h>
+#include <Logger/Sinks/FileSink.h>
+#include <Unitest/Unitest.h>
+#include "TestHelpers.h"
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <thread>
+
+namespace {
+
+    using nkentseu::logger::test::MakeMessage;
+    using nkentseu::logger::test::TempFile;
+
+} // namespace
+
+TEST_CASE(Logger, FileSink_UnbufferedWritesEachLine) {
+    TempFile file("nk_filesink_unbuffered.log");
+    nkentseu::logger::FileSink sink(file.path, true);
+    sink.SetPattern("%v");
+
+    sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, "one"));
+    ASSERT_EQUAL(std::string("one\n"), file.Read());
+    ASSERT_EQUAL(0u, sink.GetBufferedBytes());
+}
+
+TEST_CASE(Logger, FileSink_ExplicitOnlyWaitsForFlush) {
+    TempFile file("nk_filesink_explicit.log");
+    nkentseu::logger::FileSink sink(file.path, true);
+    sink.SetPattern("%v");
+    sink.SetFlushPolicy(nkentseu::logger::FlushPolicy::ExplicitOnly(4096));
+
+    sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, "one"));
+    sink.Log(MakeMessage(nkentseu::logger::LogLevel::Fatal, "two"));
+    ASSERT_EQUAL(std::string(""), file.Read());
+    ASSERT_EQUAL(8u, sink.GetBufferedBytes());
+
+    sink.Flush();
+    ASSERT_EQUAL(std::string("one\ntwo\n"), file.Read());
+}
+
+TEST_CASE(Logger, FileSink_LevelTriggerFlushes) {
+    TempFile file("nk_filesink_level.log");
+    nkentseu::logger::FileSink sink(file.path, true);
+    sink.SetPattern("%v");
+
+    nkentseu::logger::FlushPolicy policy = nkentseu::logger::FlushPolicy::ExplicitOnly(4096);
+    policy.flushLevel = nkentseu::logger::LogLevel::Error;
+    sink.SetFlushPolicy(policy);
+
+    sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, "info"));
+    ASSERT_EQUAL(std::string(""), file.Read());
+
+    sink.Log(MakeMessage(nkentseu::logger::LogLevel::Error, "error"));
+    ASSERT_EQUAL(std::string("info\nerror\n"), file.Read());
+}
+
+TEST_CASE(Logger, FileSink_ByteTriggerAndFullBuffer) {
+    TempFile file("nk_filesink_bytes.log");
+    nkentseu::logger::FileSink sink(file.path, true);
+    sink.SetPattern("%v");
+
+    nkentseu::logger::FlushPolicy policy = nkentseu::logger::FlushPolicy::ExplicitOnly(16);
+    policy.flushBytes = 10;
+    sink.SetFlushPolicy(policy);
+
+    sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, "abcd"));   // 5 octets
+    ASSERT_EQUAL(std::string(""), file.Read());
+    sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, "efghi"));  // 11 octets >= 10
+    ASSERT_EQUAL(std::string("abcd\nefghi\n"), file.Read());
+
+    // Ligne plus grande que le tampon: écrite d'un bloc au-delà du seuil
+    sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, "0123456789abcdefghij"));
+    ASSERT_EQUAL(std::string("abcd\nefghi\n0123456789abcdefghij\n"), file.Read());
+}
+
+TEST_CASE(Logger, FileSink_IntervalFlushesIdleSink) {
+    TempFile file("nk_filesink_interval.log");
+    nkentseu::logger::FileSink sink(file.path, true);
+    sink.SetPattern("%v");
+
+    nkentseu::logger::FlushPolicy policy = nkentseu::logger::FlushPolicy::ExplicitOnly(4096);
+    policy.flushIntervalMs = 20;
+    sink.SetFlushPolicy(policy);
+
+    // Aucun autre message: le minuteur doit écrire la ligne seul
+    sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, "idle"));
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (sink.GetBufferedBytes() > 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    ASSERT_EQUAL(std::string("idle\n"), file.Read());
+
+    // Sans déclencheur temporel, le minuteur est en pause
+    sink.SetFlushPolicy(nkentseu::logger::FlushPolicy::ExplicitOnly(4096));
+    sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, "held"));
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    ASSERT_EQUAL(5u, sink.GetBufferedBytes());
+}
+
+TEST_CASE(Logger, FileSink_CloseWritesPendingLines) {
+    TempFile file("nk_filesink_close.log");
+    {
+        nkentseu::logger::FileSink sink(file.path, true);
+        sink.SetPattern("%v");
+        sink.SetFlushPolicy(nkentseu::logger::FlushPolicy::ExplicitOnly());
+        sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, "pending"));
+    }
+    ASSERT_EQUAL(std::string("pending\n"), file.Read());
+}
+
+TEST_CASE(Logger, FileSink_BatchWritesOnEnd) {
+    TempFile file("nk_filesink_batch.log");
+    nkentseu::logger::FileSink sink(file.path, true);
+    sink.SetPattern("%v");
+
+    sink.BeginBatch();
+    sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, "one"));
+    sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, "two"));
+    ASSERT_EQUAL(std::string(""), file.Read());
+    ASSERT_EQUAL(8u, sink.GetBufferedBytes());
+
+    sink.EndBatch();
+    ASSERT_EQUAL(std::string("one\ntwo\n"), file.Read());
+}
+
+TEST_CASE(Logger, FileSink_DescriptorBackendWritesChunks) {
+    TempFile file("nk_filesink_descriptor.log");
+    std::string expected = "kept\n";
+    {
+        std::ofstream previous(file.path);
+        previous << "kept\n";
+    }
+
+    nkentseu::logger::FileSink sink(file.path, false);
+    sink.SetPattern("%v");
+    sink.SetBackend(nkentseu::logger::FileBackendType::Descriptor, 1);
+    sink.SetFlushPolicy(nkentseu::logger::FlushPolicy::ExplicitOnly(1024 * 1024));
+
+    // Plusieurs blocs de tampon: un seul writev, ordre préservé
+    const std::string line(1000, 'x');
+    for (int i = 0; i < 100; ++i) {
+        std::string text = std::to_string(i) + line;
+        sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, text.c_str()));
+        expected += text + "\n";
+    }
+    ASSERT_EQUAL(std::string("kept\n"), file.Read());
+
+    sink.Flush();
+    ASSERT_EQUAL(expected, file.Read());
+
+#if defined(__linux__)
+    ASSERT_TRUE(sink.GetBackendType() == nkentseu::logger::FileBackendType::Descriptor);
+#endif
+}
+
+#if defined(__linux__)
+TEST_CASE(Logger, FileSink_DescriptorSyncsIdleSink) {
+    TempFile file("nk_filesink_sync.log");
+    nkentseu::logger::FileSink sink(file.path, true);
+    sink.SetPattern("%v");
+
+    auto backend = std::make_unique<nkentseu::logger::DescriptorFileBackend>(20);
+    const nkentseu::logger::DescriptorFileBackend* descriptor = backend.get();
+    sink.SetBackend(std::move(backend));
+
+    // La ligne part tout de suite (sans tampon)
+    sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, "synced"));
+    ASSERT_EQUAL(std::string("synced\n"), file.Read());
+
+    // Plus aucun appel au sink: le minuteur lance la synchronisation
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (descriptor->GetSyncCount() == 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    ASSERT_EQUAL(nkentseu::uint64(1), descriptor->GetSyncCount());
+}
+#endif
+
+TEST_CASE(Logger, FileSink_AsyncLoggerThroughDescriptor) {
+    TempFile file("nk_filesink_async.log");
+    auto sink = std::make_shared<nkentseu::logger::FileSink>(file.path, true);
+    sink->SetBackend(nkentseu::logger::FileBackendType::Descriptor);
+
+    {
+        nkentseu::logger::AsyncLogger logger("async", 1024);
+        logger.SetOverflowPolicy(nkentseu::logger::OverflowPolicy::Block);
+        logger.SetBlockTimeout(10000);
+        logger.SetPattern("%v");
+        logger.AddSink(sink);
+        logger.Start();
+        for (int i = 0; i < 2000; ++i) {
+            logger.Info("line %d", i);
+        }
+        logger.Flush();
+    }
+
+    std::string expected;
+    for (int i = 0; i < 2000; ++i) {
+        expected += "line " + std::to_string(i) + "\n";
+    }
+    ASSERT_EQUAL(expected, file.Read());
+}
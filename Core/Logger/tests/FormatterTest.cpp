@@ -0,0 +1,103 @@
+#include <Logger/CompiledFormatter.h>
+#include <Logger/Formatter.h>
+#include <Unitest/Unitest.h>
+#include "TestHelpers.h"
+#include <chrono>
+#include <ctime>
+#include <string>
+
+namespace {
+
+    using nkentseu::logger::test::MakeMessage;
+
+    // Message à un instant fixe (2026-03-14 15:09:26.535897 heure locale)
+    nkentseu::logger::LogMessage MakeFixedMessage() {
+        std::tm tm = {};
+        tm.tm_year = 2026 - 1900;
+        tm.tm_mon = 2;
+        tm.tm_mday = 14;
+        tm.tm_hour = 15;
+        tm.tm_min = 9;
+        tm.tm_sec = 26;
+        tm.tm_isdst = -1;
+
+        const auto timePoint = std::chrono::system_clock::from_time_t(std::mktime(&tm)) +
+                               std::chrono::microseconds(535897);
+        nkentseu::logger::LogMessage message = MakeMessage(nkentseu::logger::LogLevel::Warn, "hello",
+            std::chrono::duration_cast<std::chrono::nanoseconds>(timePoint.time_since_epoch()).count());
+        message.loggerName = "core";
+        message.threadId = 42;
+        message.sourceFile = "/src/game/Player.cpp";
+        message.sourceLine = 128;
+        return message;
+    }
+
+    // Pattern utilisateur compilé (séquence inconnue %q conservée telle quelle)
+    constexpr char USER_PATTERN[] = "%H:%M %% %q <%T> %F %v";
+
+    // Compare la version compilée au Formatter interprété
+    template <const char* Pattern>
+    bool MatchesInterpreter(const nkentseu::logger::LogMessage& message, bool useColors) {
+        // Le suffixe empêche le Formatter de déléguer à la version compilée
+        nkentseu::logger::Formatter interpreter{std::string(Pattern) + "|"};
+        return nkentseu::logger::CompiledFormatter<Pattern>::Format(message, useColors) + "|" ==
+               interpreter.Format(message, useColors);
+    }
+
+} // namespace
+
+// Littéraux adjacents joints et date-heure fusionnée à la compilation
+static_assert(nkentseu::logger::compiled::CountTokens(nkentseu::logger::patterns::Default) == 12, "");
+static_assert(nkentseu::logger::compiled::CountTokens(nkentseu::logger::patterns::Simple) == 1, "");
+static_assert(nkentseu::logger::compiled::CountTokens("a%%b%qc") == 1, "");
+
+TEST_CASE(Logger, Formatter_DateTimeFields) {
+    nkentseu::logger::Formatter formatter("[%Y-%m-%d %H:%M:%S.%e] [%L] [%n] [%t] -> %v");
+    ASSERT_EQUAL(std::string("[2026-03-14 15:09:26.535] [WRN] [core] [42] -> hello"),
+                 formatter.Format(MakeFixedMessage()));
+}
+
+TEST_CASE(Logger, Formatter_SeparateTimeTokens) {
+    // Séparateurs non standards: pas de fusion, mêmes valeurs
+    nkentseu::logger::Formatter formatter("%d/%m/%Y %H%M%S %f %s:%#");
+    ASSERT_EQUAL(std::string("14/03/2026 150926 535897 Player.cpp:128"),
+                 formatter.Format(MakeFixedMessage()));
+}
+
+TEST_CASE(Logger, Formatter_CacheFollowsSeconds) {
+    nkentseu::logger::Formatter formatter("%H:%M:%S");
+    nkentseu::logger::LogMessage message = MakeFixedMessage();
+    ASSERT_EQUAL(std::string("15:09:26"), formatter.Format(message));
+
+    message.timestamp += 1000000000ULL;
+    ASSERT_EQUAL(std::string("15:09:27"), formatter.Format(message));
+
+    message.timestamp -= 2000000000ULL;
+    ASSERT_EQUAL(std::string("15:09:25"), formatter.Format(message));
+}
+
+TEST_CASE(Logger, CompiledFormatter_MatchesInterpreter) {
+    using namespace nkentseu::logger;
+    LogMessage message = MakeFixedMessage();
+    message.functionName = "Update";
+    message.SetThreadName("render");
+
+    for (bool useColors : { false, true }) {
+        ASSERT_TRUE(MatchesInterpreter<patterns::Default>(message, useColors));
+        ASSERT_TRUE(MatchesInterpreter<patterns::Simple>(message, useColors));
+        ASSERT_TRUE(MatchesInterpreter<patterns::Detailed>(message, useColors));
+        ASSERT_TRUE(MatchesInterpreter<patterns::Color>(message, useColors));
+        ASSERT_TRUE(MatchesInterpreter<patterns::Json>(message, useColors));
+        ASSERT_TRUE(MatchesInterpreter<USER_PATTERN>(message, useColors));
+    }
+}
+
+TEST_CASE(Logger, CompiledFormatter_UserPattern) {
+    ASSERT_EQUAL(std::string("15:09 % %q <render> Update hello"),
+                 nkentseu::logger::CompiledFormatter<USER_PATTERN>::Format([] {
+                     nkentseu::logger::LogMessage message = MakeFixedMessage();
+                     message.functionName = "Update";
+                     message.SetThreadName("render");
+                     return message;
+                 }()));
+}
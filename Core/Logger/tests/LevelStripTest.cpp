@@ -0,0 +1,65 @@
+// Ce fichier retire Trace et Debug à la compilation (les autres tests gardent tout)
+#define NK_LOG_ACTIVE_LEVEL NK_LOG_LEVEL_INFO
+
+#include <Logger/Log.h>
+#include <Logger/Logger.h>
+#include <Unitest/Unitest.h>
+#include "TestSinks.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+using nkentseu::logger::LogLevel;
+using nkentseu::logger::test::RecordingSink;
+
+TEST_CASE(Logger, LevelStrip_CompiledOutCallSitesEvaluateNothing) {
+    nkentseu::logger::Logger logger("strip");
+    auto sink = std::make_shared<RecordingSink>();
+    logger.AddSink(sink);
+    logger.SetLevel(LogLevel::Trace);
+
+    int evaluated = 0;
+    auto next = [&evaluated] { return ++evaluated; };
+
+    LOG_TRACE(&logger, "trace %d", next());
+    LOG_DEBUG_DEFERRED(&logger, "debug %d", next());
+    NK_LOG_DEBUG("default %d", next());
+    ASSERT_EQUAL(0, evaluated);
+    ASSERT_EQUAL(0u, sink->Count());
+
+    LOG_INFO(&logger, "info %d", next());
+    LOG_WARN_DEFERRED(&logger, "warn %d", next());
+    ASSERT_EQUAL(2, evaluated);
+    ASSERT_EQUAL(2u, sink->Count());
+    ASSERT_EQUAL(std::string("info 1"), sink->Texts()[0]);
+    ASSERT_EQUAL(std::string("warn 2"), sink->Texts()[1]);
+}
+
+TEST_CASE(Logger, LevelStrip_RuntimeCheckPrecedesArguments) {
+    nkentseu::logger::Logger logger("strip");
+    auto sink = std::make_shared<RecordingSink>();
+    logger.AddSink(sink);
+    logger.SetLevel(LogLevel::Error);
+
+    int evaluated = 0;
+    auto next = [&evaluated] { return ++evaluated; };
+
+    LOG_WARN(&logger, "warn %d", next());
+    ASSERT_EQUAL(0, evaluated);
+
+    logger.SetEnabled(false);
+    LOG_ERROR(&logger, "error %d", next());
+    ASSERT_EQUAL(0, evaluated);
+
+    // Sans accolades, le else appartient bien au if de l'appelant
+    logger.SetEnabled(true);
+    bool elseTaken = false;
+    if (evaluated == 0)
+        LOG_ERROR(&logger, "error %d", next());
+    else
+        elseTaken = true;
+
+    ASSERT_FALSE(elseTaken);
+    ASSERT_EQUAL(1, evaluated);
+    ASSERT_EQUAL(1u, sink->Count());
+}
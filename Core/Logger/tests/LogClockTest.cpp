@@ -0,0 +1,75 @@
+#include <Logger/LogClock.h>
+#include <Logger/LogMessage.h>
+#include <Unitest/Unitest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using nkentseu::logger::ClockSource;
+using nkentseu::logger::LogClock;
+
+namespace {
+
+    nkentseu::uint64 WallNs() {
+        return static_cast<nkentseu::uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+    }
+
+    // Écart absolu entre LogClock::Now() et l'heure murale
+    nkentseu::uint64 DistanceToWall() {
+        const nkentseu::uint64 before = WallNs();
+        const nkentseu::uint64 now = LogClock::Now();
+        const nkentseu::uint64 after = WallNs();
+        if (now < before) return before - now;
+        if (now > after) return now - after;
+        return 0;
+    }
+
+} // namespace
+
+TEST_CASE(Logger, LogClock_SourcesFollowWallClock) {
+    const ClockSource sources[] = { ClockSource::System, ClockSource::Monotonic, ClockSource::Tsc };
+    for (ClockSource source : sources) {
+        LogClock::SetSource(source);
+        if (source == ClockSource::Tsc && !LogClock::IsTscAvailable()) {
+            ASSERT_TRUE(LogClock::GetSource() == ClockSource::Monotonic);
+        }
+
+        // Moins d'une milliseconde d'écart, y compris après 20 ms d'extrapolation
+        ASSERT_TRUE(DistanceToWall() < 1000000u);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        ASSERT_TRUE(DistanceToWall() < 1000000u);
+
+        nkentseu::logger::LogMessage message;
+        const nkentseu::uint64 after = WallNs();
+        ASSERT_TRUE(message.timestamp <= after + 1000000u);
+        ASSERT_TRUE(message.timestamp + 1000000u >= after - 1000000u);
+    }
+    LogClock::SetSource(ClockSource::System);
+}
+
+TEST_CASE(Logger, LogClock_RecalibratesWhileThreadsStamp) {
+    LogClock::SetSource(ClockSource::Tsc);
+    LogClock::SetCalibrationPeriod(100000); // 100 µs: recalage quasi permanent
+
+    std::atomic<bool> stop(false);
+    std::atomic<nkentseu::uint64> outliers(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&] {
+            while (!stop.load()) {
+                if (DistanceToWall() > 1000000u) {
+                    outliers.fetch_add(1);
+                }
+            }
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    stop = true;
+    for (auto& thread : threads) thread.join();
+
+    LogClock::SetCalibrationPeriod(LogClock::DEFAULT_CALIBRATION_PERIOD);
+    LogClock::SetSource(ClockSource::System);
+    ASSERT_EQUAL(0u, outliers.load());
+}
@@ -0,0 +1,89 @@
+#include <Logger/Logger.h>
+#include <Logger/Registry.h>
+#include <Unitest/Unitest.h>
+#include "TestSinks.h"
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using nkentseu::logger::LogLevel;
+using nkentseu::logger::test::RecordingSink;
+
+TEST_CASE(Logger, LoggerLevel_EnableKeepsLevel) {
+    nkentseu::logger::Logger logger("level");
+    logger.SetLevel(LogLevel::Warn);
+
+    logger.SetEnabled(false);
+    ASSERT_FALSE(logger.IsEnabled());
+    ASSERT_TRUE(logger.GetLevel() == LogLevel::Warn);
+    ASSERT_FALSE(logger.ShouldLog(LogLevel::Fatal));
+
+    logger.SetLevel(LogLevel::Debug);
+    ASSERT_FALSE(logger.ShouldLog(LogLevel::Fatal));
+
+    logger.SetEnabled(true);
+    ASSERT_TRUE(logger.GetLevel() == LogLevel::Debug);
+    ASSERT_TRUE(logger.ShouldLog(LogLevel::Debug));
+    ASSERT_FALSE(logger.ShouldLog(LogLevel::Trace));
+
+    logger.SetLevel(LogLevel::Off);
+    ASSERT_FALSE(logger.ShouldLog(LogLevel::Fatal));
+}
+
+TEST_CASE(Logger, LoggerLevel_TogglingWhileSixteenThreadsLog) {
+    const int threadCount = 16;
+    const int messagesPerThread = 2000;
+
+    auto logger = std::make_shared<nkentseu::logger::Logger>("level-stress");
+    auto sink = std::make_shared<RecordingSink>();
+    logger->AddSink(sink);
+
+    auto& registry = nkentseu::logger::Registry::Instance();
+    ASSERT_TRUE(registry.Register(logger));
+
+    std::atomic<bool> go(false);
+    std::atomic<int> running(threadCount);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&, t] {
+            while (!go.load()) std::this_thread::yield();
+            for (int i = 0; i < messagesPerThread; ++i) {
+                LOG_DEBUG(logger, "thread %d message %d", t, i);
+                LOG_ERROR(logger, "thread %d message %d", t, i);
+            }
+            running.fetch_sub(1);
+        });
+    }
+
+    // Reconfiguration concurrente: niveau direct, activation et niveau global
+    std::thread toggler([&] {
+        while (!go.load()) std::this_thread::yield();
+        for (nkentseu::uint32 round = 0; running.load() > 0; ++round) {
+            logger->SetLevel(round % 2 ? LogLevel::Trace : LogLevel::Error);
+            logger->SetEnabled(round % 3 != 0);
+            registry.SetGlobalLevel(round % 5 ? LogLevel::Debug : LogLevel::Critical);
+            (void)logger->GetLevel();
+            (void)registry.GetGlobalLevel();
+        }
+    });
+
+    go = true;
+    for (auto& thread : threads) thread.join();
+    toggler.join();
+
+    const size_t delivered = sink->Count();
+    ASSERT_TRUE(delivered <= static_cast<size_t>(threadCount) * messagesPerThread * 2);
+
+    // État final cohérent et de nouveau utilisable
+    logger->SetEnabled(true);
+    registry.SetGlobalLevel(LogLevel::Trace);
+    ASSERT_TRUE(logger->GetLevel() == LogLevel::Trace);
+    LOG_TRACE(logger, "after stress");
+    ASSERT_EQUAL(delivered + 1, sink->Count());
+
+    registry.SetGlobalLevel(LogLevel::Info);
+    ASSERT_TRUE(registry.Unregister("level-stress"));
+}
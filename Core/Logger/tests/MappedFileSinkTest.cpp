@@ -0,0 +1,166 @@
+#include <Logger/Sinks/MappedFileSink.h>
+#include <Unitest/Unitest.h>
+#include "TestHelpers.h"
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#if defined(__linux__)
+    #include <csignal>
+    #include <sys/resource.h>
+    #include <sys/wait.h>
+    #include <unistd.h>
+#endif
+
+namespace {
+
+    using nkentseu::logger::test::MakeMessage;
+    using nkentseu::logger::test::TempFile;
+
+} // namespace
+
+#if defined(__linux__) || defined(__APPLE__)
+
+TEST_CASE(Logger, MappedFileSink_GrowsAcrossChunksAndTruncatesOnClose) {
+    TempFile file("nk_mapped_chunks.log");
+    std::string expected;
+    {
+        nkentseu::logger::MappedFileSink sink(file.path, true, 4096);
+        sink.SetPattern("%v");
+        ASSERT_TRUE(sink.IsOpen());
+
+        for (int i = 0; i < 200; ++i) {
+            std::string text = "line " + std::to_string(i) + std::string(90, '.');
+            sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, text));
+            expected += text + "\n";
+        }
+
+        // Fichier préalloué au bloc, longueur écrite exacte
+        ASSERT_EQUAL(expected.size(), sink.GetFileSize());
+        ASSERT_EQUAL(0u, std::filesystem::file_size(file.path) % sink.GetChunkSize());
+    }
+    ASSERT_EQUAL(expected, file.Read());
+}
+
+TEST_CASE(Logger, MappedFileSink_AppendsToExistingFile) {
+    TempFile file("nk_mapped_append.log");
+    {
+        nkentseu::logger::MappedFileSink sink(file.path, true, 4096);
+        sink.SetPattern("%v");
+        sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, "first"));
+    }
+    {
+        nkentseu::logger::MappedFileSink sink(file.path, false, 4096);
+        sink.SetPattern("%v");
+        sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, "second"));
+    }
+    ASSERT_EQUAL(std::string("first\nsecond\n"), file.Read());
+}
+
+TEST_CASE(Logger, MappedFileSink_RecoverDropsPaddingAndTornLine) {
+    TempFile file("nk_mapped_recover.log");
+    {
+        std::ofstream stream(file.path, std::ios::binary);
+        stream << "complete\npartial li";
+        stream << std::string(100, '\0');
+    }
+
+    ASSERT_EQUAL(9, nkentseu::logger::MappedFileSink::FindValidLength(file.path));
+
+    size_t length = 0;
+    ASSERT_TRUE(nkentseu::logger::MappedFileSink::Recover(file.path, &length));
+    ASSERT_EQUAL(9u, length);
+    ASSERT_EQUAL(std::string("complete\n"), file.Read());
+
+    // Fichier fermé proprement: laissé tel quel
+    ASSERT_EQUAL(9, nkentseu::logger::MappedFileSink::FindValidLength(file.path));
+}
+
+TEST_CASE(Logger, MappedFileSink_RecoverDropsTornLineOnChunkBoundary) {
+    TempFile file("nk_mapped_recover_boundary.log");
+    {
+        // Ligne coupée qui remplit exactement le bloc: aucun zéro derrière elle
+        std::ofstream stream(file.path, std::ios::binary);
+        stream << "complete\n";
+        stream << std::string(4096 - 9, 'x');
+    }
+    ASSERT_EQUAL(4096u, std::filesystem::file_size(file.path));
+
+    size_t length = 0;
+    ASSERT_TRUE(nkentseu::logger::MappedFileSink::Recover(file.path, &length));
+    ASSERT_EQUAL(9u, length);
+    ASSERT_EQUAL(std::string("complete\n"), file.Read());
+}
+
+#endif
+
+#if defined(__linux__)
+
+TEST_CASE(Logger, MappedFileSink_SurvivesSigkill) {
+    TempFile file("nk_mapped_sigkill.log");
+
+    const pid_t child = ::fork();
+    if (child == 0) {
+        nkentseu::logger::MappedFileSink sink(file.path, true, 4096);
+        sink.SetPattern("%v");
+        for (int i = 0; i < 100; ++i) {
+            sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, "entry " + std::to_string(i)));
+        }
+        ::raise(SIGKILL);
+        ::_exit(0);
+    }
+
+    int status = 0;
+    ::waitpid(child, &status, 0);
+    ASSERT_TRUE(WIFSIGNALED(status));
+
+    // Pas de fermeture: fichier encore préalloué
+    ASSERT_EQUAL(0u, std::filesystem::file_size(file.path) % 4096);
+
+    std::string expected;
+    for (int i = 0; i < 100; ++i) {
+        expected += "entry " + std::to_string(i) + "\n";
+    }
+
+    ASSERT_TRUE(nkentseu::logger::MappedFileSink::Recover(file.path));
+    ASSERT_EQUAL(expected, file.Read());
+}
+
+TEST_CASE(Logger, MappedFileSink_FailedChunkDropsPartialLine) {
+    TempFile file("nk_mapped_full.log");
+
+    const pid_t child = ::fork();
+    if (child == 0) {
+        // Fichier limité à deux blocs: le troisième ne peut pas être projeté
+        ::signal(SIGXFSZ, SIG_IGN);
+        struct rlimit limit;
+        limit.rlim_cur = 2 * 4096;
+        limit.rlim_max = 2 * 4096;
+        ::setrlimit(RLIMIT_FSIZE, &limit);
+        {
+            nkentseu::logger::MappedFileSink sink(file.path, true, 4096);
+            sink.SetPattern("%v");
+            for (int i = 0; i < 1000; ++i) {
+                sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, "entry " + std::to_string(i)));
+            }
+        }
+        ::_exit(0);
+    }
+
+    int status = 0;
+    ::waitpid(child, &status, 0);
+    ASSERT_TRUE(WIFEXITED(status));
+
+    // Seules les lignes complètes restent, la ligne coupée n'est pas comptée
+    const std::string content = file.Read();
+    ASSERT_TRUE(content.size() > 4096 && content.size() <= 2 * 4096);
+    ASSERT_EQUAL('\n', content.back());
+
+    std::string expected;
+    for (int i = 0; expected.size() < content.size(); ++i) {
+        expected += "entry " + std::to_string(i) + "\n";
+    }
+    ASSERT_EQUAL(expected, content);
+}
+
+#endif
@@ -0,0 +1,115 @@
+#include <Logger/Logger.h>
+#include <Unitest/Unitest.h>
+#include "TestSinks.h"
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using nkentseu::logger::LogLevel;
+
+namespace {
+
+    using nkentseu::logger::test::RecordingSink;
+
+    // Même site d'appel à chaque itération (une seule ligne source)
+    void LogMove(nkentseu::logger::Logger& logger, int x) {
+        logger.Log(LogLevel::Info, __FILE__, __LINE__, __FUNCTION__, "mouse moved to %d", x);
+    }
+
+    void LogClick(nkentseu::logger::Logger& logger, int x) {
+        logger.Log(LogLevel::Info, __FILE__, __LINE__, __FUNCTION__, "mouse clicked at %d", x);
+    }
+
+} // namespace
+
+TEST_CASE(Logger, RateLimit_SuppressesRepeatsPerCallSite) {
+    nkentseu::logger::Logger logger("ratelimit");
+    auto sink = std::make_shared<RecordingSink>();
+    logger.AddSink(sink);
+
+    nkentseu::logger::RateLimitConfig config;
+    config.repeatWindowMs = 60000;
+    logger.SetRateLimit(config);
+
+    for (int i = 0; i < 100; ++i) {
+        LogMove(logger, i);
+        LogClick(logger, i);
+    }
+
+    // Un message par site, les arguments différents ne changent rien
+    ASSERT_EQUAL(2u, sink->Count());
+    ASSERT_EQUAL(std::string("mouse moved to 0"), sink->Texts()[0]);
+    ASSERT_EQUAL(std::string("mouse clicked at 0"), sink->Texts()[1]);
+    ASSERT_EQUAL(198u, logger.GetRateLimitStats().suppressedRepeats);
+
+    // Le flush résume les rafales restées sans suite
+    logger.Flush();
+    ASSERT_EQUAL(4u, sink->Count());
+    ASSERT_EQUAL(std::string("last message repeated 99 times"), sink->Texts()[2]);
+    ASSERT_EQUAL(std::string("last message repeated 99 times"), sink->Texts()[3]);
+
+    // Texte sans emplacement: les messages identiques sont dédoublonnés
+    logger.Info(std::string("same text"));
+    logger.Info(std::string("same text"));
+    logger.Info(std::string("other text"));
+    ASSERT_EQUAL(6u, sink->Count());
+    ASSERT_EQUAL(std::string("other text"), sink->Texts()[5]);
+}
+
+TEST_CASE(Logger, RateLimit_WindowExpiryReportsRepeats) {
+    nkentseu::logger::Logger logger("ratelimit-window");
+    auto sink = std::make_shared<RecordingSink>();
+    logger.AddSink(sink);
+
+    nkentseu::logger::RateLimitConfig config;
+    config.repeatWindowMs = 20;
+    logger.SetRateLimit(config);
+
+    for (int i = 0; i < 10; ++i) {
+        LogMove(logger, i);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    LogMove(logger, 10);
+
+    ASSERT_EQUAL(3u, sink->Count());
+    ASSERT_EQUAL(std::string("last message repeated 9 times"), sink->Texts()[1]);
+    ASSERT_EQUAL(std::string("mouse moved to 10"), sink->Texts()[2]);
+}
+
+TEST_CASE(Logger, RateLimit_TokenBucketCapsThroughput) {
+    nkentseu::logger::Logger logger("ratelimit-bucket");
+    auto sink = std::make_shared<RecordingSink>();
+    logger.AddSink(sink);
+
+    nkentseu::logger::RateLimitConfig config;
+    config.messagesPerSecond = 100;
+    config.burst = 10;
+    logger.SetRateLimit(config);
+
+    const int count = 1000;
+    for (int i = 0; i < count; ++i) {
+        LogMove(logger, i);
+    }
+
+    // La rafale passe, le reste est refusé (un jeton toutes les 10 ms)
+    const size_t admitted = sink->Count();
+    ASSERT_TRUE(admitted >= 10u);
+    ASSERT_TRUE(admitted < 20u);
+    ASSERT_EQUAL(static_cast<nkentseu::uint64>(count - admitted), logger.GetRateLimitStats().rateLimited);
+
+    // Le premier message admis ensuite rapporte les refus
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    LogClick(logger, 0);
+    ASSERT_EQUAL(admitted + 2, sink->Count());
+    ASSERT_EQUAL(std::to_string(count - admitted) + " messages dropped by rate limit", sink->Texts()[admitted]);
+
+    // Config par défaut: étape retirée
+    logger.SetRateLimit(nkentseu::logger::RateLimitConfig());
+    ASSERT_FALSE(logger.GetRateLimit().IsEnabled());
+    for (int i = 0; i < 50; ++i) {
+        LogMove(logger, i);
+    }
+    ASSERT_EQUAL(admitted + 52, sink->Count());
+}
@@ -0,0 +1,185 @@
+#include <Logger/BroadcastRing.h>
+#include <Logger/RingBuffer.h>
+#include <Unitest/Unitest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST_CASE(Logger, RingBuffer_CapacityRoundedToPowerOfTwo) {
+    nkentseu::logger::MPSCRingBuffer<int> buffer(100);
+    ASSERT_EQUAL(128u, buffer.Capacity());
+    ASSERT_TRUE(buffer.IsEmpty());
+}
+
+TEST_CASE(Logger, RingBuffer_FifoOrder) {
+    nkentseu::logger::MPSCRingBuffer<int> buffer(8);
+
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_TRUE(buffer.TryPush(i));
+    }
+    ASSERT_EQUAL(5u, buffer.SizeApprox());
+
+    int value = -1;
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_TRUE(buffer.TryPop(value));
+        ASSERT_EQUAL(i, value);
+    }
+    ASSERT_FALSE(buffer.TryPop(value));
+}
+
+TEST_CASE(Logger, RingBuffer_FullRejectsPush) {
+    nkentseu::logger::MPSCRingBuffer<int> buffer(4);
+
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(buffer.TryPush(i));
+    }
+    ASSERT_FALSE(buffer.TryPush(99));
+
+    // Un slot libéré redevient disponible
+    int value = 0;
+    ASSERT_TRUE(buffer.TryPop(value));
+    ASSERT_TRUE(buffer.TryPush(4));
+}
+
+TEST_CASE(Logger, RingBuffer_PopBatchLimit) {
+    nkentseu::logger::MPSCRingBuffer<int> buffer(16);
+    for (int i = 0; i < 10; ++i) {
+        buffer.TryPush(i);
+    }
+
+    int sum = 0;
+    size_t count = buffer.PopBatch([&sum](int& value) { sum += value; }, 4);
+    ASSERT_EQUAL(4u, count);
+    ASSERT_EQUAL(0 + 1 + 2 + 3, sum);
+
+    count = buffer.PopBatch([&sum](int& value) { sum += value; }, 100);
+    ASSERT_EQUAL(6u, count);
+    ASSERT_EQUAL(45, sum);
+}
+
+TEST_CASE(Logger, RingBuffer_MultipleProducers) {
+    const int producers = 8;
+    const int perProducer = 10000;
+    nkentseu::logger::MPSCRingBuffer<int> buffer(256);
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&buffer, p] {
+            for (int i = 0; i < perProducer; ++i) {
+                while (!buffer.TryPush(p * perProducer + i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // Chaque producteur doit être reçu dans son ordre d'émission
+    std::vector<int> last(producers, -1);
+    long long received = 0;
+    bool ordered = true;
+    while (received < producers * perProducer) {
+        received += buffer.PopBatch([&](int& value) {
+            int producer = value / perProducer;
+            int index = value % perProducer;
+            if (index <= last[producer]) ordered = false;
+            last[producer] = index;
+        }, 64);
+    }
+
+    for (auto& thread : threads) thread.join();
+
+    ASSERT_TRUE(ordered);
+    ASSERT_TRUE(buffer.IsEmpty());
+}
+
+TEST_CASE(Logger, RingBuffer_DiscardOldest) {
+    nkentseu::logger::MPSCRingBuffer<int> buffer(4);
+    for (int i = 0; i < 4; ++i) {
+        buffer.TryPush(i);
+    }
+
+    ASSERT_TRUE(buffer.TryDiscardOldest());
+    ASSERT_TRUE(buffer.TryPush(4));
+
+    int value = -1;
+    ASSERT_TRUE(buffer.TryPop(value));
+    ASSERT_EQUAL(1, value);
+
+    // Vider puis vérifier qu'une file vide ne peut rien évincer
+    while (buffer.TryPop(value)) {}
+    ASSERT_EQUAL(4, value);
+    ASSERT_FALSE(buffer.TryDiscardOldest());
+}
+
+TEST_CASE(Logger, BroadcastRing_EveryConsumerSeesEveryElement) {
+    const int count = 20000;
+    nkentseu::logger::BroadcastRingBuffer<int> buffer(64, 3);
+
+    std::thread producer([&buffer] {
+        for (int i = 0; i < count; ++i) {
+            int value = i;
+            while (!buffer.TryPush(std::move(value))) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    // Trois consommateurs indépendants, chacun doit tout lire dans l'ordre
+    std::vector<long long> sums(3, 0);
+    std::vector<bool> ordered(3, true);
+    std::vector<std::thread> consumers;
+    for (size_t c = 0; c < 3; ++c) {
+        consumers.emplace_back([&, c] {
+            int expected = 0;
+            while (expected < count) {
+                size_t read = buffer.PopBatch(c, [&](int& value) {
+                    if (value != expected) ordered[c] = false;
+                    sums[c] += value;
+                    ++expected;
+                }, 16);
+                if (read == 0) std::this_thread::yield();
+            }
+        });
+    }
+
+    producer.join();
+    for (auto& consumer : consumers) consumer.join();
+
+    const long long total = static_cast<long long>(count) * (count - 1) / 2;
+    for (size_t c = 0; c < 3; ++c) {
+        ASSERT_TRUE(ordered[c]);
+        ASSERT_EQUAL(total, sums[c]);
+        ASSERT_EQUAL(0u, buffer.GetSkipped(c));
+    }
+    ASSERT_TRUE(buffer.IsEmpty());
+}
+
+TEST_CASE(Logger, BroadcastRing_LossyConsumerSkippedWhenFull) {
+    nkentseu::logger::BroadcastRingBuffer<int> buffer(4, 2);
+    buffer.SetLossy(1, true);
+
+    // Le consommateur 0 suit, le consommateur 1 ne lit jamais
+    int last = -1;
+    for (int i = 0; i < 10; ++i) {
+        int value = i;
+        ASSERT_TRUE(buffer.TryPush(std::move(value)));
+        buffer.PopBatch(0, [&last](int& v) { last = v; }, 8);
+    }
+    ASSERT_EQUAL(9, last);
+    ASSERT_EQUAL(6u, buffer.GetSkipped(1));
+
+    // Il reprend sur les 4 plus récents
+    std::vector<int> seen;
+    buffer.PopBatch(1, [&seen](int& v) { seen.push_back(v); }, 8);
+    ASSERT_EQUAL(4u, seen.size());
+    ASSERT_EQUAL(6, seen.front());
+
+    // Un consommateur bloquant retient les producteurs
+    buffer.SetLossy(1, false);
+    for (int i = 0; i < 4; ++i) {
+        int value = 100 + i;
+        ASSERT_TRUE(buffer.TryPush(std::move(value)));
+    }
+    int extra = 200;
+    ASSERT_FALSE(buffer.TryPush(std::move(extra)));
+}
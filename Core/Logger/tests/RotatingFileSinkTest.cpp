@@ -0,0 +1,111 @@
+#include <Logger/Sinks/RotatingFileSink.h>
+#include <Logger/Deflate.h>
+#include <Unitest/Unitest.h>
+#include "TestHelpers.h"
+#include <filesystem>
+#include <string>
+
+namespace {
+
+    using nkentseu::logger::test::MakeMessage;
+    using nkentseu::logger::test::TempDir;
+
+} // namespace
+
+TEST_CASE(Logger, RotatingFileSink_RotatesOnTrackedSize) {
+    TempDir dir("nk_rotating_sync");
+    const std::string path = dir.File("app.log");
+    {
+        // Lignes de 4 octets ("aaa\n"), rotation à partir de 8
+        nkentseu::logger::RotatingFileSink sink(path, 8, 2);
+        sink.SetPattern("%v");
+
+        sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, "aaa"));
+        ASSERT_EQUAL(4u, sink.GetTrackedSize());
+        sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, "bbb"));
+        ASSERT_EQUAL(0u, sink.GetTrackedSize());
+        sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, "ccc"));
+        sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, "ddd"));
+        sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, "eee"));
+        sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, "fff"));
+        sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, "ggg"));
+    }
+
+    // Deux sauvegardes conservées, la plus ancienne ("aaa bbb") a disparu
+    ASSERT_EQUAL(std::string("ggg\n"), TempDir::Read(path));
+    ASSERT_EQUAL(std::string("eee\nfff\n"), TempDir::Read(path + ".0"));
+    ASSERT_EQUAL(std::string("ccc\nddd\n"), TempDir::Read(path + ".1"));
+    ASSERT_FALSE(std::filesystem::exists(path + ".2"));
+}
+
+TEST_CASE(Logger, RotatingFileSink_BackgroundRotationKeepsOrder) {
+    TempDir dir("nk_rotating_background");
+    const std::string path = dir.File("app.log");
+    {
+        nkentseu::logger::RotatingFileSink sink(path, 8, 3);
+        sink.SetPattern("%v");
+        sink.SetBackgroundRotation(true);
+        ASSERT_TRUE(sink.IsBackgroundRotation());
+
+        const char* lines[] = { "l01", "l02", "l03", "l04", "l05", "l06", "l07", "l08", "l09" };
+        for (const char* line : lines) {
+            sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, line));
+        }
+        sink.WaitForBackgroundWork();
+
+        // Taille comptée en mémoire: une ligne depuis la dernière rotation
+        ASSERT_EQUAL(4u, sink.GetTrackedSize());
+    }
+
+    ASSERT_EQUAL(std::string("l09\n"), TempDir::Read(path));
+    ASSERT_EQUAL(std::string("l07\nl08\n"), TempDir::Read(path + ".0"));
+    ASSERT_EQUAL(std::string("l05\nl06\n"), TempDir::Read(path + ".1"));
+    ASSERT_EQUAL(std::string("l03\nl04\n"), TempDir::Read(path + ".2"));
+    ASSERT_FALSE(std::filesystem::exists(path + ".3"));
+
+    // Aucun nom d'attente ne reste
+    size_t fileCount = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(dir.path)) {
+        (void)entry;
+        ++fileCount;
+    }
+    ASSERT_EQUAL(4u, fileCount);
+}
+
+TEST_CASE(Logger, RotatingFileSink_CompressesBackups) {
+    TempDir dir("nk_rotating_compressed");
+    const std::string path = dir.File("app.log");
+    {
+        nkentseu::logger::RotatingFileSink sink(path, 8, 2);
+        sink.SetPattern("%v");
+        sink.SetCompression(true);
+        ASSERT_TRUE(sink.IsCompressionEnabled());
+        ASSERT_TRUE(sink.IsBackgroundRotation());
+
+        const char* lines[] = { "l01", "l02", "l03", "l04", "l05", "l06", "l07" };
+        for (const char* line : lines) {
+            sink.Log(MakeMessage(nkentseu::logger::LogLevel::Info, line));
+        }
+        sink.WaitForBackgroundWork();
+    }
+
+    auto gunzip = [](const std::string& file) {
+        const std::string compressed = TempDir::Read(file);
+        std::string content;
+        return nkentseu::logger::GzipDecompress(compressed.data(), compressed.size(), content)
+            ? content : std::string("<invalide>");
+    };
+
+    ASSERT_EQUAL(std::string("l07\n"), TempDir::Read(path));
+    ASSERT_EQUAL(std::string("l05\nl06\n"), gunzip(path + ".0.gz"));
+    ASSERT_EQUAL(std::string("l03\nl04\n"), gunzip(path + ".1.gz"));
+    ASSERT_FALSE(std::filesystem::exists(path + ".2.gz"));
+
+    // Ni sauvegarde en clair, ni fichier temporaire, ni nom d'attente
+    size_t fileCount = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(dir.path)) {
+        (void)entry;
+        ++fileCount;
+    }
+    ASSERT_EQUAL(3u, fileCount);
+}
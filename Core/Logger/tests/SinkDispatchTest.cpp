@@ -0,0 +1,154 @@
+#include <Logger/Logger.h>
+#include <Unitest/Unitest.h>
+#include "TestSinks.h"
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    // Sink thread-safe qui vérifie chaque ligne reçue
+    class CountingPreformattedSink : public nkentseu::logger::ISink {
+        public:
+            CountingPreformattedSink()
+                : m_Formatter(std::make_unique<nkentseu::logger::Formatter>()) {
+            }
+
+            void Log(const nkentseu::logger::LogMessage&) override {
+                count.fetch_add(1, std::memory_order_relaxed);
+            }
+            void LogFormatted(const nkentseu::logger::LogMessage& message, const std::string& formatted) override {
+                if (formatted != message.message.ToString()) {
+                    malformed.fetch_add(1, std::memory_order_relaxed);
+                }
+                count.fetch_add(1, std::memory_order_relaxed);
+            }
+            bool SupportsPreformatted() const override { return true; }
+            void Flush() override {}
+            void SetFormatter(std::unique_ptr<nkentseu::logger::Formatter>) override {}
+            void SetPattern(const std::string&) override {}
+            nkentseu::logger::Formatter* GetFormatter() const override { return m_Formatter.get(); }
+            std::string GetPattern() const override { return m_Formatter->GetPattern(); }
+
+            std::atomic<nkentseu::uint64> count{0};
+            std::atomic<nkentseu::uint64> malformed{0};
+
+        private:
+            std::unique_ptr<nkentseu::logger::Formatter> m_Formatter;
+    };
+
+} // namespace
+
+using nkentseu::logger::test::PreformattedRecordingSink;
+
+TEST_CASE(Logger, Dispatch_SamePatternFormattedOnce) {
+    nkentseu::logger::Logger logger("dispatch");
+    logger.SetPattern("[%n] %v");
+
+    auto first = std::make_shared<PreformattedRecordingSink>();
+    auto second = std::make_shared<PreformattedRecordingSink>();
+    auto third = std::make_shared<PreformattedRecordingSink>();
+    logger.AddSink(first);
+    logger.AddSink(second);
+    logger.AddSink(third);
+
+    logger.Info("hello %d", 7);
+
+    ASSERT_EQUAL(1u, first->Sources().size());
+    ASSERT_EQUAL(first->Sources()[0], second->Sources()[0]);
+    ASSERT_EQUAL(first->Sources()[0], third->Sources()[0]);
+    ASSERT_EQUAL(std::string("[dispatch] hello 7"), third->Lines()[0]);
+    ASSERT_EQUAL(0u, first->SelfFormatted());
+}
+
+TEST_CASE(Logger, Dispatch_ColorsFormattedSeparately) {
+    nkentseu::logger::Logger logger("dispatch");
+    logger.SetPattern("%^%v%$");
+
+    auto plain = std::make_shared<PreformattedRecordingSink>(false);
+    auto colored = std::make_shared<PreformattedRecordingSink>(true);
+    logger.AddSink(plain);
+    logger.AddSink(colored);
+
+    logger.Warn("careful");
+
+    ASSERT_EQUAL(std::string("careful"), plain->Lines()[0]);
+    ASSERT_CONTAINS(colored->Lines()[0], "\033[");
+    ASSERT_NOT_EQUAL(plain->Sources()[0], colored->Sources()[0]);
+}
+
+TEST_CASE(Logger, Dispatch_FilteredSinkDoesNotFormat) {
+    nkentseu::logger::Logger logger("dispatch");
+    logger.SetLevel(nkentseu::logger::LogLevel::Trace);
+
+    auto quiet = std::make_shared<PreformattedRecordingSink>();
+    quiet->SetLevel(nkentseu::logger::LogLevel::Error);
+    logger.AddSink(quiet);
+
+    logger.Info("ignored");
+    ASSERT_TRUE(quiet->Sources().empty());
+}
+
+TEST_CASE(Logger, Dispatch_PatternPropagatedAtConfiguration) {
+    nkentseu::logger::Logger logger("dispatch");
+    auto sink = std::make_shared<PreformattedRecordingSink>();
+    logger.SetPattern("[%n] %v");
+    logger.AddSink(sink);
+    ASSERT_EQUAL(std::string("[%n] %v"), sink->GetPattern());
+
+    logger.SetPattern("%v");
+    ASSERT_EQUAL(std::string("%v"), sink->GetPattern());
+
+    // Un pattern changé directement sur le sink n'est plus écrasé à chaque message
+    sink->SetPattern("<%v>");
+    logger.Info("kept");
+    ASSERT_EQUAL(std::string("<%v>"), sink->GetPattern());
+    ASSERT_EQUAL(std::string("kept"), sink->Lines()[0]);
+}
+
+TEST_CASE(Logger, Dispatch_SinksReplacedWhileThreadsLog) {
+    const int threadCount = 8;
+    const int messagesPerThread = 2000;
+
+    nkentseu::logger::Logger logger("dispatch-threads");
+    logger.SetPattern("%v");
+    auto stable = std::make_shared<CountingPreformattedSink>();
+    logger.AddSink(stable);
+
+    std::atomic<bool> go(false);
+    std::atomic<int> running(threadCount);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&] {
+            while (!go.load()) std::this_thread::yield();
+            for (int i = 0; i < messagesPerThread; ++i) {
+                logger.Info("message %d", i);
+            }
+            running.fetch_sub(1);
+        });
+    }
+
+    // Reconfiguration concurrente: les sinks ajoutés puis retirés ne bloquent
+    // jamais les threads qui loggent et ne sont jamais libérés en cours d'usage
+    std::thread configurator([&] {
+        while (!go.load()) std::this_thread::yield();
+        // Sur un seul cœur, les threads peuvent sinon tout logger pendant un ClearSinks
+        while (stable->count.load() == 0) std::this_thread::yield();
+        while (running.load() > 0) {
+            logger.AddSink(std::make_shared<CountingPreformattedSink>());
+            logger.SetPattern("%v");
+            logger.ClearSinks();
+            logger.AddSink(stable);
+        }
+    });
+
+    go = true;
+    for (auto& thread : threads) thread.join();
+    configurator.join();
+
+    ASSERT_EQUAL(1u, logger.GetSinkCount());
+    ASSERT_TRUE(stable->count.load() > 0);
+    ASSERT_EQUAL(0u, stable->malformed.load());
+}
@@ -0,0 +1,67 @@
+#include <Logger/Logger.h>
+#include <Unitest/Unitest.h>
+#include "TestSinks.h"
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using nkentseu::logger::LogLevel;
+using nkentseu::logger::test::RecordingSink;
+
+TEST_CASE(Logger, SourceContext_CarriesLocationPerCall) {
+    nkentseu::logger::Logger logger("source");
+    auto sink = std::make_shared<RecordingSink>();
+    logger.AddSink(sink);
+
+    const nkentseu::uint32 line = __LINE__;
+    nkentseu::logger::SourceContext(logger, NK_SOURCE_LOCATION).Warn("value %d", 7);
+    logger.Source("other.cpp", 12, "Other").Info(std::string("text"));
+    logger.Info("no source");
+
+    const auto messages = sink->Messages();
+    ASSERT_EQUAL(3u, messages.size());
+    ASSERT_EQUAL(std::string("value 7"), messages[0].message.ToString());
+    ASSERT_EQUAL(std::string(__FILE__), std::string(messages[0].sourceFile));
+    ASSERT_EQUAL(line + 1, messages[0].sourceLine);
+
+    ASSERT_EQUAL(std::string("other.cpp"), std::string(messages[1].sourceFile));
+    ASSERT_EQUAL(12u, messages[1].sourceLine);
+    ASSERT_EQUAL(std::string("Other"), std::string(messages[1].functionName));
+
+    // Aucun emplacement mémorisé d'un appel précédent
+    ASSERT_EQUAL(std::string(""), std::string(messages[2].sourceFile));
+    ASSERT_EQUAL(0u, messages[2].sourceLine);
+}
+
+TEST_CASE(Logger, SourceContext_ConcurrentCallersKeepTheirLocation) {
+    const int threadCount = 8;
+    const int messagesPerThread = 500;
+
+    nkentseu::logger::Logger logger("source-threads");
+    auto sink = std::make_shared<RecordingSink>();
+    logger.AddSink(sink);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&logger, t] {
+            // Une ligne source distincte par thread, reprise dans le texte
+            const nkentseu::uint32 line = 1000 + static_cast<nkentseu::uint32>(t);
+            for (int i = 0; i < messagesPerThread; ++i) {
+                logger.Source("worker.cpp", line, "Work").Info("%u", line);
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    ASSERT_EQUAL(static_cast<size_t>(threadCount * messagesPerThread), sink->Count());
+    size_t mismatches = 0;
+    for (const auto& message : sink->Messages()) {
+        if (std::strtoul(message.message.ToString().c_str(), nullptr, 10) != message.sourceLine) {
+            ++mismatches;
+        }
+    }
+    ASSERT_EQUAL(0u, mismatches);
+}
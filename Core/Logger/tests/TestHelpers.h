@@ -0,0 +1,119 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/tests/TestHelpers.h
+// DESCRIPTION: Outils partagés par les tests du module Logger.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Logger/LogMessage.h>
+#include <Logger/LogLevel.h>
+#include <Nkentseu/Types.h>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger::test
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+        namespace test {
+
+            /**
+             * @brief Construit un message du logger "test"
+             * @param level Niveau du message
+             * @param text Texte du message
+             * @param timestamp Horodatage en ns (0 = instant de création)
+             */
+            inline LogMessage MakeMessage(LogLevel level, const std::string& text, uint64 timestamp = 0) {
+                LogMessage message(level, text, "test");
+                if (timestamp != 0) {
+                    message.timestamp = timestamp;
+                }
+                return message;
+            }
+
+            /**
+             * @brief Lit tout le contenu d'un fichier (vide s'il n'existe pas)
+             */
+            inline std::string ReadFile(const std::string& path) {
+                std::ifstream stream(path, std::ios::binary);
+                std::ostringstream content;
+                content << stream.rdbuf();
+                return content.str();
+            }
+
+            // ---------------------------------------------------------------------
+            // STRUCTURE: TempFile
+            // DESCRIPTION: Fichier du répertoire temporaire, supprimé à la
+            //              construction (reste d'un test interrompu) et en fin de test.
+            // ---------------------------------------------------------------------
+            struct TempFile {
+                explicit TempFile(const char* name)
+                    : path((std::filesystem::temp_directory_path() / name).string()) {
+                    std::filesystem::remove(path);
+                }
+                ~TempFile() {
+                    std::error_code error;
+                    std::filesystem::remove(path, error);
+                }
+
+                TempFile(const TempFile&) = delete;
+                TempFile& operator=(const TempFile&) = delete;
+
+                /**
+                 * @brief Contenu actuel du fichier
+                 */
+                std::string Read() const { return ReadFile(path); }
+
+                std::string path;
+            };
+
+            // ---------------------------------------------------------------------
+            // STRUCTURE: TempDir
+            // DESCRIPTION: Répertoire temporaire vide, recréé à la construction et
+            //              supprimé avec son contenu en fin de test.
+            // ---------------------------------------------------------------------
+            struct TempDir {
+                explicit TempDir(const char* name)
+                    : path(std::filesystem::temp_directory_path() / name) {
+                    std::filesystem::remove_all(path);
+                    std::filesystem::create_directories(path);
+                }
+                ~TempDir() {
+                    std::error_code error;
+                    std::filesystem::remove_all(path, error);
+                }
+
+                TempDir(const TempDir&) = delete;
+                TempDir& operator=(const TempDir&) = delete;
+
+                /**
+                 * @brief Chemin d'un fichier du répertoire
+                 */
+                std::string File(const std::string& name) const {
+                    return (path / name).string();
+                }
+
+                /**
+                 * @brief Contenu d'un fichier (vide s'il n'existe pas)
+                 */
+                static std::string Read(const std::string& file) { return ReadFile(file); }
+
+                /**
+                 * @brief Remplace le contenu d'un fichier
+                 */
+                static void Write(const std::string& file, const std::string& content) {
+                    std::ofstream stream(file, std::ios::binary);
+                    stream << content;
+                }
+
+                std::filesystem::path path;
+            };
+
+        } // namespace test
+    } // namespace logger
+} // namespace nkentseu
@@ -0,0 +1,145 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/tests/TestSinks.h
+// DESCRIPTION: Sinks partagés par les tests du module Logger.
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Logger/Sink.h>
+#include <Logger/LogMessage.h>
+#include <Logger/Formatter.h>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// NAMESPACE: nkentseu::logger::test
+// -----------------------------------------------------------------------------
+namespace nkentseu {
+    namespace logger {
+        namespace test {
+
+            // ---------------------------------------------------------------------
+            // CLASSE: RecordingSink
+            // DESCRIPTION: Sink thread-safe qui conserve une copie de chaque
+            //              message reçu; les tests vérifient les champs voulus.
+            //              Log est virtuelle pour les variantes (porte, lenteur).
+            // ---------------------------------------------------------------------
+            class RecordingSink : public ISink {
+                public:
+                    void Log(const LogMessage& message) override {
+                        std::lock_guard<std::mutex> lock(m_Mutex);
+                        m_Messages.push_back(message);
+                    }
+                    void Flush() override {}
+                    void SetFormatter(std::unique_ptr<Formatter>) override {}
+                    void SetPattern(const std::string&) override {}
+                    Formatter* GetFormatter() const override { return nullptr; }
+                    std::string GetPattern() const override { return ""; }
+
+                    /**
+                     * @brief Nombre de messages reçus
+                     */
+                    size_t Count() const {
+                        std::lock_guard<std::mutex> lock(m_Mutex);
+                        return m_Messages.size();
+                    }
+
+                    /**
+                     * @brief Copie des messages reçus, dans l'ordre
+                     */
+                    std::vector<LogMessage> Messages() const {
+                        std::lock_guard<std::mutex> lock(m_Mutex);
+                        return m_Messages;
+                    }
+
+                    /**
+                     * @brief Textes des messages reçus, dans l'ordre
+                     */
+                    std::vector<std::string> Texts() const {
+                        std::lock_guard<std::mutex> lock(m_Mutex);
+                        std::vector<std::string> texts;
+                        texts.reserve(m_Messages.size());
+                        for (const LogMessage& message : m_Messages) {
+                            texts.push_back(message.message.ToString());
+                        }
+                        return texts;
+                    }
+
+                private:
+                    mutable std::mutex m_Mutex;
+                    std::vector<LogMessage> m_Messages;
+            };
+
+            // ---------------------------------------------------------------------
+            // CLASSE: PreformattedRecordingSink
+            // DESCRIPTION: RecordingSink qui accepte les lignes formatées par le
+            //              logger (SupportsPreformatted) et mémorise chaque ligne,
+            //              l'adresse du texte partagé reçu et les messages qu'il a
+            //              dû formater lui-même.
+            // ---------------------------------------------------------------------
+            class PreformattedRecordingSink : public RecordingSink {
+                public:
+                    explicit PreformattedRecordingSink(bool colors = false)
+                        : m_Formatter(std::make_unique<Formatter>())
+                        , m_Colors(colors) {
+                    }
+
+                    void Log(const LogMessage& message) override {
+                        RecordingSink::Log(message);
+                        std::lock_guard<std::mutex> lock(m_LineMutex);
+                        ++m_SelfFormatted;
+                        m_Lines.push_back(m_Formatter->Format(message, m_Colors));
+                    }
+                    void LogFormatted(const LogMessage& message, const std::string& formatted) override {
+                        RecordingSink::Log(message);
+                        std::lock_guard<std::mutex> lock(m_LineMutex);
+                        m_Sources.push_back(&formatted);
+                        m_Lines.push_back(formatted);
+                    }
+                    bool SupportsPreformatted() const override { return true; }
+                    bool WantsColors() const override { return m_Colors; }
+                    void SetFormatter(std::unique_ptr<Formatter> formatter) override { m_Formatter = std::move(formatter); }
+                    void SetPattern(const std::string& pattern) override { m_Formatter->SetPattern(pattern); }
+                    Formatter* GetFormatter() const override { return m_Formatter.get(); }
+                    std::string GetPattern() const override { return m_Formatter->GetPattern(); }
+
+                    /**
+                     * @brief Lignes reçues ou formatées, dans l'ordre
+                     */
+                    std::vector<std::string> Lines() const {
+                        std::lock_guard<std::mutex> lock(m_LineMutex);
+                        return m_Lines;
+                    }
+
+                    /**
+                     * @brief Adresses des textes reçus par LogFormatted
+                     */
+                    std::vector<const std::string*> Sources() const {
+                        std::lock_guard<std::mutex> lock(m_LineMutex);
+                        return m_Sources;
+                    }
+
+                    /**
+                     * @brief Nombre de messages formatés par le sink lui-même
+                     */
+                    size_t SelfFormatted() const {
+                        std::lock_guard<std::mutex> lock(m_LineMutex);
+                        return m_SelfFormatted;
+                    }
+
+                private:
+                    std::unique_ptr<Formatter> m_Formatter;
+                    bool m_Colors;
+                    mutable std::mutex m_LineMutex;
+                    std::vector<std::string> m_Lines;
+                    std::vector<const std::string*> m_Sources;
+                    size_t m_SelfFormatted = 0;
+            };
+
+        } // namespace test
+    } // namespace logger
+} // namespace nkentseu
@@ -0,0 +1,65 @@
+#include <Logger/Logger.h>
+#include <Logger/ThreadInfo.h>
+#include <Unitest/Unitest.h>
+#include "TestSinks.h"
+#include <cstring>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+using nkentseu::logger::test::RecordingSink;
+
+TEST_CASE(Logger, ThreadInfo_NameCachedAndSetExplicitly) {
+    nkentseu::logger::Logger logger("threads");
+    auto sink = std::make_shared<RecordingSink>();
+    logger.AddSink(sink);
+
+    std::thread worker([&logger] {
+        const nkentseu::uint32 index = nkentseu::logger::GetCurrentThreadInfo().index;
+        ASSERT_TRUE(index != 0);
+        ASSERT_EQUAL(index, nkentseu::logger::GetCurrentThreadInfo().index);
+
+        nkentseu::logger::SetCurrentThreadName("render");
+        logger.Info("first");
+
+        // Tronqué à la limite système (15 caractères)
+        nkentseu::logger::SetCurrentThreadName("a-very-long-thread-name");
+        logger.Info("second");
+    });
+    worker.join();
+
+    const auto messages = sink->Messages();
+    ASSERT_EQUAL(2u, messages.size());
+    ASSERT_EQUAL(messages[0].threadId, messages[1].threadId);
+    ASSERT_EQUAL(std::string("render"), std::string(messages[0].threadName));
+    ASSERT_EQUAL(std::string("a-very-long-thr"), std::string(messages[1].threadName));
+}
+
+TEST_CASE(Logger, ThreadInfo_SmallDistinctIndexPerThread) {
+    const int threadCount = 8;
+
+    nkentseu::logger::Logger logger("threads");
+    auto sink = std::make_shared<RecordingSink>();
+    logger.AddSink(sink);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&logger] {
+            for (int i = 0; i < 10; ++i) {
+                logger.Info("message %d", i);
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    std::set<nkentseu::uint32> indices;
+    for (const auto& message : sink->Messages()) {
+        indices.insert(message.threadId);
+    }
+    ASSERT_EQUAL(static_cast<size_t>(threadCount), indices.size());
+
+    // Attribués séquentiellement: bien en dessous d'une valeur de hachage
+    ASSERT_TRUE(*indices.rbegin() < 10000u);
+}
@@ -0,0 +1,83 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/tools/LogDecode/Main.cpp
+// DESCRIPTION: Décodeur des journaux écrits par BinarySink. Les messages sont
+//              formatés à la lecture, avec le pattern enregistré dans le
+//              fichier ou celui donné en option; les messages différés y
+//              reçoivent aussi leur texte (FormatDeferred).
+//              Usage: LogDecode [-p pattern] [--color] fichier...
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#include <Logger/BinaryLog.h>
+#include <Logger/DeferredFormat.h>
+#include <Logger/Formatter.h>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+    using namespace nkentseu::logger;
+
+    std::string pattern;
+    bool useColors = false;
+    std::vector<std::string> files;
+
+    for (int i = 1; i < argc; ++i) {
+        if ((std::strcmp(argv[i], "-p") == 0 || std::strcmp(argv[i], "--pattern") == 0) && i + 1 < argc) {
+            pattern = argv[++i];
+        } else if (std::strcmp(argv[i], "--color") == 0) {
+            useColors = true;
+        } else {
+            files.push_back(argv[i]);
+        }
+    }
+
+    if (files.empty()) {
+        std::fprintf(stderr, "Usage: %s [-p pattern] [--color] fichier...\n", argv[0]);
+        return 2;
+    }
+
+    int failures = 0;
+    Formatter formatter(pattern.empty() ? std::string(Formatter::DEFAULT_PATTERN) : pattern);
+    LogMessage message;
+    MessageBuffer text;
+    std::string line;
+
+    for (const std::string& filename : files) {
+        BinaryLogReader reader(filename);
+        if (!reader.IsOpen()) {
+            std::fprintf(stderr, "%s: journal binaire illisible\n", filename.c_str());
+            ++failures;
+            continue;
+        }
+
+        while (reader.Next(message)) {
+            // Sans -p, suivre le pattern enregistré par le sink
+            if (pattern.empty() && !reader.GetPattern().empty()) {
+                formatter.SetPattern(reader.GetPattern());
+            }
+
+            // Message différé: le printf enregistré est appliqué ici
+            if (message.IsDeferred()) {
+                FormatDeferred(message.deferredFormat, message.message.Data(), message.message.Size(), text);
+                message.message.Assign(text.Data(), text.Size());
+                message.deferredFormat = nullptr;
+            }
+
+            line.clear();
+            formatter.FormatTo(message, useColors, line);
+            line += '\n';
+            std::fwrite(line.data(), 1, line.size(), stdout);
+        }
+
+        if (reader.HasError()) {
+            std::fprintf(stderr, "%s: données invalides ou tronquées après %llu messages\n",
+                         filename.c_str(), static_cast<unsigned long long>(reader.GetRecordCount()));
+            ++failures;
+        }
+    }
+
+    return failures == 0 ? 0 : 1;
+}
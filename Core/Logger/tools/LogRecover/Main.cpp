@@ -0,0 +1,65 @@
+// -----------------------------------------------------------------------------
+// FICHIER: Core/Logger/tools/LogRecover/Main.cpp
+// DESCRIPTION: Outil de récupération des fichiers de MappedFileSink après un
+//              arrêt brutal: retire la préallocation et la ligne coupée.
+//              Usage: LogRecover [--dry-run] fichier...
+// AUTEUR: Rihen
+// DATE: 2026
+// -----------------------------------------------------------------------------
+
+#include <Logger/Sinks/MappedFileSink.h>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+
+int main(int argc, char* argv[]) {
+    using nkentseu::logger::MappedFileSink;
+
+    bool dryRun = false;
+    int fileCount = 0;
+    int failures = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--dry-run") == 0) {
+            dryRun = true;
+            continue;
+        }
+
+        const std::string filename = argv[i];
+        ++fileCount;
+
+        std::error_code error;
+        const uintmax_t fileSize = std::filesystem::file_size(filename, error);
+        const long long validLength = MappedFileSink::FindValidLength(filename);
+
+        if (error || validLength < 0) {
+            std::fprintf(stderr, "%s: lecture impossible\n", filename.c_str());
+            ++failures;
+            continue;
+        }
+
+        const unsigned long long removed = static_cast<unsigned long long>(fileSize) -
+                                           static_cast<unsigned long long>(validLength);
+        if (removed == 0) {
+            std::printf("%s: %lld octets, intact\n", filename.c_str(), validLength);
+            continue;
+        }
+
+        if (!dryRun && !MappedFileSink::Recover(filename)) {
+            std::fprintf(stderr, "%s: troncature impossible\n", filename.c_str());
+            ++failures;
+            continue;
+        }
+
+        std::printf("%s: %lld octets valides, %llu octets %s\n", filename.c_str(), validLength, removed,
+                    dryRun ? "à retirer" : "retirés");
+    }
+
+    if (fileCount == 0) {
+        std::fprintf(stderr, "Usage: %s [--dry-run] fichier...\n", argv[0]);
+        return 2;
+    }
+
+    return failures == 0 ? 0 : 1;
+}